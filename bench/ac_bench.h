@@ -0,0 +1,273 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*****************************************************************************************
+// File: ac_bench.h
+//
+// Description:
+//    Common harness for the ac_ipl C-model benchmarks in this directory. Each bench_ac_*.cpp
+//    program drives one kernel with a synthetic frame at one or more resolutions and prints
+//    one JSON object per (kernel, configuration, resolution) run on stdout, e.g.:
+//
+//    {"kernel":"ac_canny","config":"CDEPTH=8","resolution":"vga","width":640,"height":480,
+//     "pixels":307200,"seconds":0.41,"pixels_per_second":1.1e+06,"peak_rss_kb":10240,
+//     "stages":{"fill":0.02,"run":0.28,"drain":0.01}}
+//
+//    The stages are the phases of the harness: "fill" writes the synthetic frame into the
+//    input channel(s), "run" is the call(s) to the kernel top-level function and "drain"
+//    reads the output channel(s) back. pixels_per_second is computed from the "run" stage.
+//    peak_rss_kb is the high-water mark of the process resident set size at the end of the
+//    run, so it includes all runs done earlier by the same program.
+//
+//    Resolutions are selected on the command line by name (vga, 1080p, 4k) or as WxH, up to
+//    AC_BENCH_W_MAX x AC_BENCH_H_MAX. All named resolutions are run when none is given.
+//
+// Revision History:
+//    2025.4 - Initial version.
+//
+//*****************************************************************************************
+
+#ifndef _INCLUDED_AC_BENCH_H_
+#define _INCLUDED_AC_BENCH_H_
+
+#include <ac_int.h>
+#include <ac_channel.h>
+#include <ac_ipl/ac_pixels.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+namespace ac_bench
+{
+  // All benchmarks are built with these maximum dimensions, so that the 4k frames fit.
+  enum {
+    AC_BENCH_W_MAX = 3840,
+    AC_BENCH_H_MAX = 2160
+  };
+
+  struct resolution {
+    std::string name;
+    int width;
+    int height;
+    resolution(const std::string &n, int w, int h) : name(n), width(w), height(h) { }
+  };
+
+  // Parse the resolutions given on the command line. Exits on an unknown or too large resolution.
+  inline std::vector<resolution> parse_args(int argc, char *argv[])
+  {
+    const resolution named[] = {
+      resolution("vga",    640,  480),
+      resolution("1080p", 1920, 1080),
+      resolution("4k",    3840, 2160)
+    };
+    const int nNamed = sizeof(named)/sizeof(named[0]);
+
+    std::vector<resolution> res;
+    for (int a = 1; a < argc; a++) {
+      bool found = false;
+      for (int n = 0; n < nNamed; n++) {
+        if (named[n].name == argv[a]) {
+          res.push_back(named[n]);
+          found = true;
+        }
+      }
+      int w = 0, h = 0;
+      if (!found && sscanf(argv[a], "%dx%d", &w, &h) == 2) {
+        res.push_back(resolution(argv[a], w, h));
+        found = true;
+      }
+      if (!found || res.back().width <= 0 || res.back().height <= 0 ||
+          res.back().width > AC_BENCH_W_MAX || res.back().height > AC_BENCH_H_MAX) {
+        std::cerr << "Unsupported resolution: " << argv[a] << " (use vga, 1080p, 4k or WxH up to "
+                  << AC_BENCH_W_MAX << "x" << AC_BENCH_H_MAX << ")" << std::endl;
+        exit(1);
+      }
+    }
+    if (res.empty()) {
+      for (int n = 0; n < nNamed; n++) { res.push_back(named[n]); }
+    }
+    return res;
+  }
+
+  // Peak resident set size of the process, in kB.
+  inline long peak_rss_kb()
+  {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) { return long(pmc.PeakWorkingSetSize/1024); }
+    return 0;
+#else
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#if defined(__APPLE__)
+    return long(ru.ru_maxrss/1024); // bytes on macOS
+#else
+    return long(ru.ru_maxrss);      // kB on Linux
+#endif
+#endif
+  }
+
+  // Deterministic synthetic image: a diagonal gradient with a few hard edges and some
+  // pseudo-random texture, so that edge, corner and histogram kernels all have work to do.
+  // Returns component c (0 = R, 1 = G, 2 = B) of pixel (i, j).
+  inline unsigned synth(int i, int j, int c)
+  {
+    unsigned v = unsigned(i + 2*j + 37*c);
+    if (((i >> 5) ^ (j >> 5)) & 1) { v += 96; }
+    unsigned h = unsigned(i)*2654435761u ^ unsigned(j)*2246822519u ^ unsigned(c)*3266489917u;
+    h ^= h >> 15;
+    return (v + (h & 15)) & 0xff;
+  }
+
+  // Fill a pixel of any of the ac_ipl pixel types from the synthetic image. The value is the
+  // 8-bit synthetic value, wrapped to the bitwidth of the pixel component. eol marks the last
+  // pixel of a line, for the pixel types that carry a TLAST flag.
+  template <int W>
+  void make_pix(ac_int<W, false> &pix, int i, int j, bool eol)
+  {
+    // Grayscale: BT.601 luma of the synthetic RGB pixel.
+    pix = (299*synth(i, j, 0) + 587*synth(i, j, 1) + 114*synth(i, j, 2))/1000;
+  }
+
+  template <unsigned CDEPTH>
+  void make_pix(ac_ipl::RGB_1PPC<CDEPTH> &pix, int i, int j, bool eol)
+  {
+    pix.R = synth(i, j, 0);
+    pix.G = synth(i, j, 1);
+    pix.B = synth(i, j, 2);
+    pix.TUSER = (i == 0 && j == 0);
+    pix.TLAST = eol;
+  }
+
+  template <class T>
+  void make_pix(ac_ipl::RGB_imd<T> &pix, int i, int j, bool eol)
+  {
+    pix.R = synth(i, j, 0);
+    pix.G = synth(i, j, 1);
+    pix.B = synth(i, j, 2);
+  }
+
+  template <class T>
+  void make_pix(ac_ipl::RGB_pv<T> &pix, int i, int j, bool eol)
+  {
+    pix.set_R(synth(i, j, 0));
+    pix.set_G(synth(i, j, 1));
+    pix.set_B(synth(i, j, 2));
+  }
+
+  // Timing record for one benchmark run. Stages are timed with start()/stop() and the record is
+  // printed as a single JSON line by print().
+  class record
+  {
+  public:
+    record(const std::string &kernel, const std::string &config, const resolution &res) :
+      kernel_(kernel), config_(config), res_(res), running_(false) { }
+
+    void start(const std::string &stage) {
+      if (running_) { stop(); }
+      names_.push_back(stage);
+      running_ = true;
+      t0_ = std::chrono::steady_clock::now();
+    }
+
+    void stop() {
+      std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+      if (running_) { secs_.push_back(std::chrono::duration<double>(t1 - t0_).count()); }
+      running_ = false;
+    }
+
+    void print(std::ostream &os = std::cout) {
+      if (running_) { stop(); }
+      double total = 0, run = 0;
+      for (unsigned s = 0; s < secs_.size(); s++) {
+        total += secs_[s];
+        if (names_[s] == "run") { run += secs_[s]; }
+      }
+      double pixels = double(res_.width)*double(res_.height);
+      os << "{\"kernel\":\"" << kernel_ << "\",\"config\":\"" << config_ << "\",\"resolution\":\"" << res_.name
+         << "\",\"width\":" << res_.width << ",\"height\":" << res_.height << ",\"pixels\":" << long(pixels)
+         << ",\"seconds\":" << total << ",\"pixels_per_second\":" << (run > 0 ? pixels/run : 0)
+         << ",\"peak_rss_kb\":" << peak_rss_kb() << ",\"stages\":{";
+      for (unsigned s = 0; s < secs_.size(); s++) {
+        os << (s ? "," : "") << "\"" << names_[s] << "\":" << secs_[s];
+      }
+      os << "}}" << std::endl;
+    }
+
+  private:
+    std::string kernel_;
+    std::string config_;
+    resolution res_;
+    std::vector<std::string> names_;
+    std::vector<double> secs_;
+    std::chrono::steady_clock::time_point t0_;
+    bool running_;
+  };
+
+  // Write a synthetic width x height frame into a channel in raster order.
+  template <class T>
+  void fill(ac_channel<T> &ch, const resolution &res)
+  {
+    for (int i = 0; i < res.height; i++) {
+      for (int j = 0; j < res.width; j++) {
+        T pix;
+        make_pix(pix, i, j, j == res.width - 1);
+        ch.write(pix);
+      }
+    }
+  }
+
+  // Read back everything that is left in a channel. Returns the number of elements read.
+  template <class T>
+  long drain(ac_channel<T> &ch)
+  {
+    long n = 0;
+    while (ch.available(1)) {
+      ch.read();
+      n++;
+    }
+    return n;
+  }
+}
+
+#endif
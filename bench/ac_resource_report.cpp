@@ -0,0 +1,107 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*****************************************************************************************
+// File: ac_resource_report.cpp
+//
+// Description:
+//    Prints the compile-time resource and latency metadata (see ac_resource.h) of a set of
+//    ac_ipl kernel configurations, one AC_RESOURCE line per configuration, so that candidate
+//    configurations can be compared without a synthesis run. Edit the list in main() to
+//    report other configurations; nothing is simulated, so the program runs instantly.
+//
+// Revision History:
+//    2025.4 - Initial version.
+//
+//*****************************************************************************************
+#include <ac_ipl/ac_canny.h>
+#include <ac_ipl/ac_ctc.h>
+#include <ac_ipl/ac_delay_line.h>
+#include <ac_ipl/ac_denoise_filter.h>
+#include <ac_ipl/ac_dither.h>
+#include <ac_ipl/ac_dwt2_pyr.h>
+#include <ac_ipl/ac_gamma.h>
+#include <ac_ipl/ac_gaussian_pyr.h>
+#include <ac_ipl/ac_harris.h>
+#include <ac_ipl/ac_imhist.h>
+#include <ac_ipl/ac_localcontrastnorm.h>
+#include <ac_ipl/ac_opticalflow.h>
+#include <ac_ipl/ac_rgb2ycbcr.h>
+#include <ac_ipl/ac_transpose_tile.h>
+#include <ac_resource.h>
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  typedef ac_int<8, false> gsInType;
+  typedef ac_fixed<18, 8, false> gsOutType;
+  typedef ac_fixed<24, 12, true> dwtOutType;
+  typedef ac_ipl::RGB_imd<ac_int<8, false> > rgbInType;
+  typedef ac_ipl::RGB_imd<ac_fixed<18, 8, false> > rgbOutType;
+
+  ac_resource_report<ac_canny<8, 1920, 1080> >("ac_canny", "CDEPTH=8,1080p,DP");
+  ac_resource_report<ac_canny<8, 1920, 1080, true> >("ac_canny", "CDEPTH=8,1080p,SP");
+  ac_resource_report<ac_canny<10, 3840, 2160> >("ac_canny", "CDEPTH=10,4k,DP");
+  ac_resource_report<ac_canny<10, 3840, 2160, true> >("ac_canny", "CDEPTH=10,4k,SP");
+
+  ac_resource_report<ac_harris<ac_int<8, false>, ac_int<8, false>, 8, 1920, 1080> >("ac_harris", "CDEPTH=8,1080p,DP");
+  ac_resource_report<ac_harris<ac_int<10, false>, ac_int<10, false>, 10, 3840, 2160, true> >("ac_harris", "CDEPTH=10,4k,SP");
+
+  ac_resource_report<ac_denoise_filter<8, 1920, 1080> >("ac_denoise_filter", "CDEPTH=8,1080p,DP");
+  ac_resource_report<ac_denoise_filter<10, 3840, 2160, true> >("ac_denoise_filter", "CDEPTH=10,4k,SP");
+
+  ac_resource_report<ac_opticalflow<ac_int<8, false>, 8, 1920, 1080> >("ac_opticalflow", "CDEPTH=8,1080p,DP");
+  ac_resource_report<ac_opticalflow<ac_int<8, false>, 8, 1920, 1080, true> >("ac_opticalflow", "CDEPTH=8,1080p,SP");
+
+  ac_resource_report<ac_localcontrastnorm<8, 1920, 1080> >("ac_localcontrastnorm", "CDEPTH=8,1080p");
+
+  ac_resource_report<ac_gaussian_pyr<gsInType, gsOutType, 1920, 1080, 5> >("ac_gaussian_pyr", "GS,5_LEVELS,1080p,SP");
+  ac_resource_report<ac_gaussian_pyr<rgbInType, rgbOutType, 1920, 1080, 5> >("ac_gaussian_pyr", "RGB,5_LEVELS,1080p,SP");
+
+  ac_resource_report<ac_dwt2_pyr<AC_HAAR, gsInType, dwtOutType, 1920, 1080, 4, 24, 12> >("ac_dwt2_pyr", "HAAR,GS,4_LEVELS,1080p,SP");
+  ac_resource_report<ac_dwt2_pyr<AC_DB2, gsInType, dwtOutType, 1920, 1080, 4, 24, 12> >("ac_dwt2_pyr", "DB2,GS,4_LEVELS,1080p,SP");
+
+  ac_resource_report<ac_dither<ac_int<8, false>, ac_int<1, false>, 1920, 1080> >("ac_dither", "GS,8to1bpp,1080p,DP");
+  ac_resource_report<ac_dither<ac_ipl::RGB_1PPC<8>, ac_ipl::RGB_1PPC<3>, 1920, 1080, true> >("ac_dither", "RGB,8to3bpp,1080p,SP");
+
+  ac_resource_report<ac_ctc<8, 1920, 1080, 13700> >("ac_ctc", "CDEPTH=8,1080p");
+  ac_resource_report<ac_gamma<rgbInType, 8> >("ac_gamma", "RGB,CDEPTH=8");
+  ac_resource_report<ac_imhist<ac_ipl::RGB_1PPC<8>, 32, 1920, 1080> >("ac_imhist", "RGB,CDEPTH=8,1080p");
+  ac_resource_report<ac_csc::ac_rgb2ycbcr<ac_ipl::RGB_pv<ac_int<8, false> >, ac_ipl::YCbCr_pv<ac_int<8, false> >, 1080, 1920> >("ac_rgb2ycbcr", "BT601,CDEPTH=8");
+
+  ac_resource_report<ac_transpose_tile<ac_int<8, false>, 8, 1920, 1080> >("ac_transpose_tile", "TILE=8,1080p");
+  ac_resource_report<ac_tile_rasterizer<ac_int<8, false>, 8, 1920, 1080> >("ac_tile_rasterizer", "TILE=8,1080p");
+
+  // Delay line aligning the 8-bit input image with the ac_harris response.
+  typedef ac_harris<ac_int<8, false>, ac_int<8, false>, 8, 1920, 1080> harrisType;
+  ac_resource_report<ac_delay_line_for<harrisType, ac_int<8, false>, 1920, 1080>::type>("ac_delay_line", "ac_harris,CDEPTH=8,1080p");
+  return 0;
+}
@@ -0,0 +1,71 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_canny.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+template <unsigned CDEPTH>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  enum {
+    W_MAX = ac_bench::AC_BENCH_W_MAX,
+    H_MAX = ac_bench::AC_BENCH_H_MAX
+  };
+  typedef ac_canny<CDEPTH, W_MAX, H_MAX> kernelType;
+  typedef typename kernelType::pixInType pixInType;
+  typedef typename kernelType::pixOutType pixOutType;
+
+  ac_channel<pixInType>  streamIn;
+  ac_channel<pixOutType> streamOut;
+  kernelType *kernel = new kernelType;
+  ac_bench::record rec("ac_canny", config, res);
+
+  rec.start("fill");
+  ac_bench::fill(streamIn, res);
+  rec.start("run");
+  kernel->run(streamIn, streamOut, res.width, res.height, 5, 25);
+  rec.start("drain");
+  ac_bench::drain(streamOut);
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<8>("CDEPTH=8", res[r]);
+    bench_driver<10>("CDEPTH=10", res[r]);
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_dither.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+template <class IN_TYPE, class OUT_TYPE, bool USE_SP>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  enum {
+    W_MAX = ac_bench::AC_BENCH_W_MAX,
+    H_MAX = ac_bench::AC_BENCH_H_MAX
+  };
+  typedef ac_dither<IN_TYPE, OUT_TYPE, W_MAX, H_MAX, USE_SP, 64, 32, AC_TRN, AC_WRAP> kernelType;
+
+  ac_channel<IN_TYPE>  streamIn;
+  ac_channel<OUT_TYPE> streamOut;
+  kernelType *kernel = new kernelType;
+  ac_bench::record rec("ac_dither", config, res);
+
+  rec.start("fill");
+  ac_bench::fill(streamIn, res);
+  rec.start("run");
+  kernel->run(streamIn, streamOut, res.width, res.height);
+  rec.start("drain");
+  ac_bench::drain(streamOut);
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<ac_int<8, false>,    ac_int<1, false>,    true >("GS,8to1bpp,SP", res[r]);
+    bench_driver<ac_int<8, false>,    ac_int<1, false>,    false>("GS,8to1bpp,DP", res[r]);
+    bench_driver<ac_ipl::RGB_1PPC<8>, ac_ipl::RGB_1PPC<3>, true >("RGB,8to3bpp,SP", res[r]);
+    bench_driver<ac_ipl::RGB_1PPC<8>, ac_ipl::RGB_1PPC<3>, false>("RGB,8to3bpp,DP", res[r]);
+  }
+  return 0;
+}
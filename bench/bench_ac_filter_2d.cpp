@@ -0,0 +1,78 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_filter_2d.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+template <class pType, int KSIZE, int PADDING>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  enum {
+    W_MAX = ac_bench::AC_BENCH_W_MAX,
+    H_MAX = ac_bench::AC_BENCH_H_MAX
+  };
+  typedef ac_filter2d<pType, W_MAX, H_MAX, KSIZE, PADDING> kernelType;
+  typedef typename kernelType::filterConf confType;
+  typedef typename kernelType::typeOutput outType;
+
+  ac_channel<pType>    streamIn;
+  ac_channel<confType> configIn;
+  ac_channel<outType>  streamOut;
+  kernelType *kernel = new kernelType;
+  ac_bench::record rec("ac_filter2d", config, res);
+
+  rec.start("fill");
+  confType conf;
+  conf.width  = res.width;
+  conf.height = res.height;
+  configIn.write(conf);
+  // Box filter weights, loaded row by row ahead of the image.
+  for (int k = 0; k < KSIZE*KSIZE; k++) { streamIn.write(1); }
+  ac_bench::fill(streamIn, res);
+  rec.start("run");
+  kernel->run(streamIn, configIn, streamOut);
+  rec.start("drain");
+  ac_bench::drain(streamOut);
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<ac_int<16, false>, 3, 1>("KSIZE=3,PADDING=1", res[r]);
+    bench_driver<ac_int<16, false>, 5, 2>("KSIZE=5,PADDING=2", res[r]);
+  }
+  return 0;
+}
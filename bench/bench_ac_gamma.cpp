@@ -0,0 +1,69 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_gamma.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+template <class PIX_TYPE, unsigned CDEPTH>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  typedef ac_gamma<PIX_TYPE, CDEPTH> kernelType;
+
+  ac_channel<PIX_TYPE> streamIn;
+  ac_channel<PIX_TYPE> streamOut;
+  kernelType *kernel = new kernelType;
+  typename kernelType::gamma_in_type gamma = 0.22;
+  ac_bench::record rec("ac_gamma", config, res);
+
+  rec.start("fill");
+  ac_bench::fill(streamIn, res);
+  rec.start("run");
+  // ac_gamma processes all the pixels available in the input channel.
+  kernel->run(streamIn, streamOut, gamma);
+  rec.start("drain");
+  ac_bench::drain(streamOut);
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<ac_int<8, false>,                    8 >("GS,CDEPTH=8", res[r]);
+    bench_driver<ac_int<10, false>,                   10>("GS,CDEPTH=10", res[r]);
+    bench_driver<ac_ipl::RGB_imd<ac_int<8, false> >,  8 >("RGB,CDEPTH=8", res[r]);
+    bench_driver<ac_ipl::RGB_imd<ac_int<10, false> >, 10>("RGB,CDEPTH=10", res[r]);
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_gaussian_pyr.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+template <class IN_TYPE, class OUT_TYPE, int N_LEVELS, int MAX_FRAC_BITS, bool USE_SP>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  enum {
+    W_MAX = ac_bench::AC_BENCH_W_MAX,
+    H_MAX = ac_bench::AC_BENCH_H_MAX
+  };
+  typedef ac_gaussian_pyr<IN_TYPE, OUT_TYPE, W_MAX, H_MAX, N_LEVELS, MAX_FRAC_BITS, USE_SP> kernelType;
+
+  ac_channel<IN_TYPE>  streamIn;
+  ac_channel<OUT_TYPE> streamOut[N_LEVELS];
+  kernelType *kernel = new kernelType;
+  ac_bench::record rec("ac_gaussian_pyr", config, res);
+
+  rec.start("fill");
+  ac_bench::fill(streamIn, res);
+  rec.start("run");
+  kernel->run(streamIn, streamOut, res.width, res.height);
+  rec.start("drain");
+  for (int l = 0; l < N_LEVELS; l++) { ac_bench::drain(streamOut[l]); }
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  typedef ac_int<8, false> gsInType;
+  typedef ac_fixed<18, 8, false> gsOutType;
+  typedef ac_ipl::RGB_imd<ac_int<8, false> > rgbInType;
+  typedef ac_ipl::RGB_imd<ac_fixed<18, 8, false> > rgbOutType;
+
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<gsInType,  gsOutType,  5, 16, true >("GS,5_LEVELS,SP", res[r]);
+    bench_driver<gsInType,  gsOutType,  5, 16, false>("GS,5_LEVELS,DP", res[r]);
+    bench_driver<rgbInType, rgbOutType, 5, 16, true >("RGB,5_LEVELS,SP", res[r]);
+  }
+  return 0;
+}
@@ -0,0 +1,84 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_imhist.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+// This struct tells you whether the input image is an RGB image or not.
+template <class T>
+struct isRGB {
+  enum { val = false };
+};
+
+template <unsigned CDEPTH>
+struct isRGB<ac_ipl::RGB_1PPC<CDEPTH> > {
+  enum { val = true };
+};
+
+template <class IN_TYPE>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  enum {
+    W_MAX = ac_bench::AC_BENCH_W_MAX,
+    H_MAX = ac_bench::AC_BENCH_H_MAX,
+    // Bins must be able to hold the count of all pixels (of all three color components for RGB inputs).
+    OUT_MAX_VAL = isRGB<IN_TYPE>::val ? 3*W_MAX*H_MAX : W_MAX*H_MAX,
+    OUT_BW = ac::nbits<OUT_MAX_VAL>::val
+  };
+  typedef ac_imhist<IN_TYPE, OUT_BW, W_MAX, H_MAX> kernelType;
+  typedef ac_int<OUT_BW, false> OUT_TYPE;
+
+  ac_channel<IN_TYPE>  streamIn;
+  ac_channel<OUT_TYPE> streamOut;
+  kernelType *kernel = new kernelType;
+  ac_bench::record rec("ac_imhist", config, res);
+
+  rec.start("fill");
+  ac_bench::fill(streamIn, res);
+  rec.start("run");
+  kernel->run(streamIn, streamOut, res.width, res.height);
+  rec.start("drain");
+  ac_bench::drain(streamOut);
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<ac_int<8, false> >("GS,CDEPTH=8", res[r]);
+    bench_driver<ac_ipl::RGB_1PPC<8> >("RGB,CDEPTH=8", res[r]);
+  }
+  return 0;
+}
@@ -0,0 +1,78 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_opticalflow.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+template <unsigned CDEPTH, bool USE_SP>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  enum {
+    W_MAX = ac_bench::AC_BENCH_W_MAX,
+    H_MAX = ac_bench::AC_BENCH_H_MAX
+  };
+  typedef ac_int<CDEPTH, false> pixType;
+  typedef ac_opticalflow<pixType, CDEPTH, W_MAX, H_MAX, USE_SP> kernelType;
+
+  ac_channel<pixType> frameIn1, frameIn2, vx, vy;
+  kernelType *kernel = new kernelType;
+  ac_bench::record rec("ac_opticalflow", config, res);
+
+  rec.start("fill");
+  ac_bench::fill(frameIn1, res);
+  // The second frame is the first one moved right by one pixel.
+  for (int i = 0; i < res.height; i++) {
+    for (int j = 0; j < res.width; j++) {
+      pixType pix;
+      ac_bench::make_pix(pix, i, j - 1, j == res.width - 1);
+      frameIn2.write(pix);
+    }
+  }
+  rec.start("run");
+  kernel->run(frameIn1, frameIn2, vx, vy, res.width, res.height);
+  rec.start("drain");
+  ac_bench::drain(vx);
+  ac_bench::drain(vy);
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<8, false>("CDEPTH=8,DP", res[r]);
+    bench_driver<8, true >("CDEPTH=8,SP", res[r]);
+  }
+  return 0;
+}
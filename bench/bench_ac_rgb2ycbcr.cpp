@@ -0,0 +1,73 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_rgb2ycbcr.h>
+#include "ac_bench.h"
+
+using namespace std;
+
+// Each color standard limits the maximum image size (e.g. BT.601 is defined for SDTV only), so
+// resolutions that do not fit IMG_H_MAX x IMG_W_MAX are skipped for that configuration.
+template <unsigned CDEPTH, int IMG_H_MAX, int IMG_W_MAX, bool STUDIO_SWING, class STANDARD>
+void bench_driver(const char *config, const ac_bench::resolution &res)
+{
+  if (res.width > IMG_W_MAX || res.height > IMG_H_MAX) { return; }
+
+  typedef ac_ipl::RGB_pv<ac_int<CDEPTH, false> > pixInType;
+  typedef ac_ipl::YCbCr_pv<ac_int<CDEPTH, false> > pixOutType;
+  typedef ac_csc::ac_rgb2ycbcr<pixInType, pixOutType, IMG_H_MAX, IMG_W_MAX, AC_TRN, 18, STUDIO_SWING, STANDARD> kernelType;
+
+  ac_channel<pixInType>  streamIn;
+  ac_channel<pixOutType> streamOut;
+  kernelType *kernel = new kernelType;
+  ac_bench::record rec("ac_rgb2ycbcr", config, res);
+
+  rec.start("fill");
+  ac_bench::fill(streamIn, res);
+  rec.start("run");
+  kernel->cvtColor(streamIn, streamOut, res.height, res.width);
+  rec.start("drain");
+  ac_bench::drain(streamOut);
+  rec.print();
+
+  delete kernel;
+}
+
+int main(int argc, char *argv[])
+{
+  vector<ac_bench::resolution> res = ac_bench::parse_args(argc, argv);
+  for (unsigned r = 0; r < res.size(); r++) {
+    bench_driver<8,  576,  720,  false, ac_ipl::BT601<18>  >("BT601,CDEPTH=8", res[r]);
+    bench_driver<8,  1080, 1920, false, ac_ipl::BT709<18>  >("BT709,CDEPTH=8", res[r]);
+    bench_driver<10, 1080, 1920, true,  ac_ipl::BT709<18>  >("BT709,CDEPTH=10,STUDIO", res[r]);
+    bench_driver<10, 2160, 3840, false, ac_ipl::BT2020<18> >("BT2020,CDEPTH=10", res[r]);
+  }
+  return 0;
+}
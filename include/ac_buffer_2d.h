@@ -38,28 +38,66 @@
 #include <ac_int.h>
 #include <ac_fixed.h>
 #include <ac_window_1d_flag.h>
+#include <ac_resource.h>
+#include <ac_trace.h>
 #ifndef AC_WINDOW_CUSTOM
 #include <ac_window_structs.h>
 #endif
 
+// Defined in ac_window_structs.h. With AC_WINDOW_CUSTOM, a definition is only needed for the packed modes.
+template<typename T, int AC_N> struct ac_widthNx;
+
 #ifndef __SYNTHESIS__
 #include <cassert>
 #include <stdio.h>
 #endif
 
+// Line buffer word packing. AC_N pixels are stored in each line buffer word: 4, 8 or 16 with the AC_PACK4,
+// AC_PACK8 and AC_PACK16 modes, 2 for singleport RAMs, and 1 otherwise. The word is read on the first pixel
+// of each group of AC_N, and written back on the last one for singleport RAMs, or on every write for
+// dual-port RAMs, so that a line ending inside a word is stored in full.
+template<typename DTYPE, int AC_WMODE, int AC_N = (AC_WMODE&AC_PACK16) ? 16 : (AC_WMODE&AC_PACK8) ? 8 : (AC_WMODE&AC_PACK4) ? 4 : (AC_WMODE&AC_SINGLEPORT) ? 2 : 1>
+struct ac_linebuf_pack {
+  enum { N = AC_N };
+  typedef ac_widthNx<DTYPE, AC_N> ac_width_Nx_type;
+  typedef typename ac_width_Nx_type::data data;
+  static void set(int sel, DTYPE din, data &dout) { ac_width_Nx_type::set_part(sel, din, dout); }
+  static void get(int sel, data din, DTYPE &dout) { ac_width_Nx_type::get_part(sel, din, dout); }
+};
+
+template<typename DTYPE, int AC_WMODE>
+struct ac_linebuf_pack<DTYPE, AC_WMODE, 2> {
+  enum { N = 2 };
+  typedef ac_width2x<DTYPE, true> ac_width_2x_type;
+  typedef typename ac_width_2x_type::data data;
+  static void set(int sel, DTYPE din, data &dout) { ac_width_2x_type::set_half(sel==1, din, dout); }
+  static void get(int sel, data din, DTYPE &dout) { ac_width_2x_type::get_half(sel==1, din, dout); }
+};
+
+template<typename DTYPE, int AC_WMODE>
+struct ac_linebuf_pack<DTYPE, AC_WMODE, 1> {
+  enum { N = 1 };
+  typedef typename ac_width2x<DTYPE, false>::data data;
+  static void set(int sel, DTYPE din, data &dout) { }
+  static void get(int sel, data din, DTYPE &dout) { }
+};
+
 template<typename DTYPE, int AC_WMODE, int AC_NCOL, int AC_NROW>
 class ac_linebuf
 {
+  typedef ac_linebuf_pack<DTYPE, AC_WMODE> ac_pack_type;
+  typedef typename ac_pack_type::data linebuf_type;
   enum {
     IS_SINGLEPORT = bool(AC_WMODE&AC_SINGLEPORT),
-    AC_NCOL2 = (AC_NCOL/(IS_SINGLEPORT ? 2 : 1)) + int(AC_NCOL%2 != 0 && IS_SINGLEPORT),
+    AC_N = ac_pack_type::N,
+    logAC_N = ac::log2_ceil<AC_N>::val,
+    // Round up to a whole number of words if the column size is not a multiple of the packing factor.
+    AC_NCOL2 = (AC_NCOL + AC_N - 1)/AC_N,
   };
 
   ac_linebuf< DTYPE, AC_WMODE,AC_NCOL,AC_NROW-1> buf;
   ac_int<ac::nbits<AC_NCOL - 1>::val, false> addr_int;
-  ac_int<1,false> cnt;
-  typedef ac_width2x<DTYPE, IS_SINGLEPORT> ac_width_2x_type;
-  typedef typename ac_width_2x_type::data linebuf_type;
+  ac_int<ac::nbits<AC_N - 1>::val, false> cnt;
   linebuf_type data[AC_NCOL2];
   linebuf_type tmp_out;
   linebuf_type tmp_in;
@@ -74,38 +112,36 @@ public:
     }
   }
   
+  // Traces the line buffer words (level AC_TRACE_DEBUG, category AC_TRACE_CAT_BUFFER, see ac_trace.h).
   void print() {
-    #ifndef __SYNTHESIS__
+    #if AC_TRACE_ON
+    std::ostringstream row;
     for (int i=0; i<AC_NCOL2; i++)
-    { printf("%d  ",data[i].to_int()); }
-    printf("\n");
+    { row << data[i].to_int() << "  "; }
+    AC_TRACE(AC_TRACE_DEBUG, AC_TRACE_CAT_BUFFER, row.str());
     #endif
   }
   
   void access(DTYPE din[AC_NROW], DTYPE dout[AC_NROW], int addr, bool w[AC_NROW]) {
     addr_int = addr;
     #pragma hls_waive CNS
-    if (IS_SINGLEPORT) {
+    if (AC_N > 1) {
       // Force cnt to reset once you reach a new line.
       if (addr == 0) { cnt = 0; }
       if (w[AC_NROW-1]) {
-        if (cnt==1)
-        { ac_width_2x_type::set_half(1,din[AC_NROW-1],tmp_in); }
-        else
-        { ac_width_2x_type::set_half(0,din[AC_NROW-1],tmp_in); }
+        ac_pack_type::set(cnt.to_int(), din[AC_NROW-1], tmp_in);
       }
 
-      if ((cnt&1)==0) { //read on even
+      if (cnt==0) { //read on the first pixel of the word
         #pragma hls_waive UMR
-        tmp_out = data[addr_int>>1];
-      } else { //write on odd
-        if (w[AC_NROW-1]) {
-          data[addr_int>>1] = tmp_in;
-        }
+        tmp_out = data[addr_int>>logAC_N];
+      }
+      #pragma hls_waive CNS
+      if (w[AC_NROW-1] && (cnt==AC_N-1 || !IS_SINGLEPORT)) { //write on the last pixel of the word
+        data[addr_int>>logAC_N] = tmp_in;
       }
 
-      bool sel = (cnt==1)?1:0;
-      ac_width_2x_type::get_half(sel,tmp_out,dout[AC_NROW-1]);
+      ac_pack_type::get(cnt.to_int(), tmp_out, dout[AC_NROW-1]);
       cnt++;
     } else {
       #pragma hls_waive UMR
@@ -122,16 +158,18 @@ public:
 template<typename DTYPE, int AC_WMODE, int AC_NCOL>
 class ac_linebuf<DTYPE, AC_WMODE,AC_NCOL,1>
 {
+  typedef ac_linebuf_pack<DTYPE, AC_WMODE> ac_pack_type;
+  typedef typename ac_pack_type::data linebuf_type;
   enum {
     IS_SINGLEPORT = bool(AC_WMODE&AC_SINGLEPORT),
-    // Add an extra element to the linebuffer array if your column size is odd and if you're using singleport memories.
-    AC_NCOL2 = (AC_NCOL/(IS_SINGLEPORT ? 2 : 1)) + int(AC_NCOL%2 != 0 && IS_SINGLEPORT),
+    AC_N = ac_pack_type::N,
+    logAC_N = ac::log2_ceil<AC_N>::val,
+    // Round up to a whole number of words if the column size is not a multiple of the packing factor.
+    AC_NCOL2 = (AC_NCOL + AC_N - 1)/AC_N,
   };
 
   ac_int<ac::nbits<AC_NCOL - 1>::val, false> addr_int;
-  ac_int<1,false> cnt;
-  typedef ac_width2x<DTYPE, IS_SINGLEPORT> ac_width_2x_type;
-  typedef typename ac_width_2x_type::data linebuf_type;
+  ac_int<ac::nbits<AC_N - 1>::val, false> cnt;
   linebuf_type data[AC_NCOL2];
   linebuf_type tmp_out;
   linebuf_type tmp_in;
@@ -146,37 +184,35 @@ public:
     }
   }
   
+  // Traces the line buffer words (level AC_TRACE_DEBUG, category AC_TRACE_CAT_BUFFER, see ac_trace.h).
   void print() {
-    #ifndef __SYNTHESIS__
+    #if AC_TRACE_ON
+    std::ostringstream row;
     for (int i=0; i<AC_NCOL2; i++)
-    { printf("%d  ",data[i].to_int()); }
-    printf("\n");
+    { row << data[i].to_int() << "  "; }
+    AC_TRACE(AC_TRACE_DEBUG, AC_TRACE_CAT_BUFFER, row.str());
     #endif
   }
   
   void access(DTYPE din[1], DTYPE dout[1], int addr, bool w[1]) {
     addr_int = addr;
     #pragma hls_waive CNS
-    if (IS_SINGLEPORT) {
+    if (AC_N > 1) {
       // Force cnt to reset once you reach a new line.
       if (addr == 0) { cnt = 0; }
       if (w[0]) {
-        if (cnt==1)
-        { ac_width_2x_type::set_half(1,din[0],tmp_in); }
-        else
-        { ac_width_2x_type::set_half(0,din[0],tmp_in); }
+        ac_pack_type::set(cnt.to_int(), din[0], tmp_in);
       }
-      if ((cnt&1)==0) { //read on even
+      if (cnt==0) { //read on the first pixel of the word
         #pragma hls_waive UMR
-        tmp_out = data[addr_int>>1];
-      } else { //write on odd
-        if (w[0]) {
-          data[addr_int>>1] = tmp_in;
-        }
+        tmp_out = data[addr_int>>logAC_N];
+      }
+      #pragma hls_waive CNS
+      if (w[0] && (cnt==AC_N-1 || !IS_SINGLEPORT)) { //write on the last pixel of the word
+        data[addr_int>>logAC_N] = tmp_in;
       }
 
-      bool sel = (cnt==1)?1:0;
-      ac_width_2x_type::get_half(sel,tmp_out,dout[0]);
+      ac_pack_type::get(cnt.to_int(), tmp_out, dout[0]);
       cnt++;
     } else {
       #pragma hls_waive UMR
@@ -188,7 +224,11 @@ public:
   }
 };
 
-template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE=AC_DUALPORT>
+// ST is the line buffer storage type. Written pixels are converted to ST, with the quantization and
+// overflow modes of ST, and the stored values are converted back to DTYPE on read. The pixel being
+// written (row 0) is converted as well, so that all rows of the output hold the same values.
+#if defined(__SYNTHESIS__) || defined(AC_BUFFER_2D_HW_SIM)
+template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE=AC_DUALPORT, typename ST=DTYPE>
 class ac_buffer_2d
 {
 
@@ -199,15 +239,23 @@ class ac_buffer_2d
   int cptr;                     //points to current col written
   bool dummy[AC_NROW-1];
   DTYPE wout_[AC_NROW];             // This array is what really gets read
-  ac_linebuf< DTYPE, AC_WMODE,AC_NCOL,AC_NROW-1+AC_REWIND_VAL> data; //recursive line buffer class
+  ac_linebuf< ST, AC_WMODE,AC_NCOL,AC_NROW-1+AC_REWIND_VAL> data; //recursive line buffer class
   ac_int<logAC_NROW,false> sel;
   ac_int<logAC_NROW+1,true> sel1;
   DTYPE b[AC_NROW];
-  DTYPE t_tmp[AC_NROW-1+AC_REWIND_VAL];
+  ST t_tmp[AC_NROW-1+AC_REWIND_VAL];
   DTYPE t[AC_NROW];
   bool s[AC_NROW];
-  DTYPE data_tmp[AC_NROW];
+  ST data_tmp[AC_NROW];
 public:
+  // Line buffer resources, see ac_resource.h.
+  enum {
+    LB_LINES = AC_NROW-1+AC_REWIND_VAL,
+    LB_WORDS = (AC_NCOL + ac_linebuf_pack<ST, AC_WMODE>::N - 1)/ac_linebuf_pack<ST, AC_WMODE>::N,
+    LB_WORD_BITS = ac_linebuf_pack<ST, AC_WMODE>::N*ac_resource_bits<ST>::val,
+    LB_BITS = LB_LINES*LB_WORDS*LB_WORD_BITS,
+    LB_RAMS = LB_LINES
+  };
   ac_buffer_2d() : cptr(0), sel(AC_NROW-2+AC_REWIND_VAL), sel1(0) {
     #ifdef __SYNTHESIS__
 #pragma hls_unroll yes
@@ -226,29 +274,120 @@ public:
   void set_wout(int idx, DTYPE val) { wout_[idx] = val; }
   void write(DTYPE src, int i, bool w);
 
-  #ifndef __SYNTHESIS__
+  // Traces the stored lines and the read/write state (level AC_TRACE_DEBUG, category AC_TRACE_CAT_BUFFER).
   void print() {
-    DTYPE w[AC_NROW-1+AC_REWIND_VAL];
+    #if AC_TRACE_ON
+    ST w[AC_NROW-1+AC_REWIND_VAL];
     bool ss[AC_NROW-1+AC_REWIND_VAL];
     for (int i=0; i<AC_NROW-1+AC_REWIND_VAL; i++)
     { ss[i] = 0; }
 
     for (int i=0; i<AC_NROW-1+AC_REWIND_VAL; i++) {
+      std::ostringstream row;
       for (int j=0; j<AC_NCOL; j++) {
         data.access(w,w,j,ss);
-        printf("%d  ", w[i].to_int());
+        row << w[i].to_int() << "  ";
       }
-      printf("\n");
+      AC_TRACE(AC_TRACE_DEBUG, AC_TRACE_CAT_BUFFER, row.str());
     }
-    printf("sel = %d  sel1 = %d, cptr = %d\n   DATA %d \n", sel.to_int(), sel1.to_int(), cptr, data_tmp[0].to_int());
+    AC_TRACE(AC_TRACE_DEBUG, AC_TRACE_CAT_BUFFER, "sel = " << sel.to_int() << "  sel1 = " << sel1.to_int() << ", cptr = " << cptr << "   DATA " << data_tmp[0].to_int());
+    #endif
   }
-  #endif
 
   DTYPE get_wout(int idx) const { return wout_[idx]; }
 };
 
-template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE>
-inline  DTYPE &ac_buffer_2d<DTYPE, AC_NCOL,AC_NROW,AC_WMODE>::operator[] (int i)
+#else
+// Host-optimized C simulation model of ac_buffer_2d.
+//
+// All line buffers are kept in one contiguous array, and line_[] holds the index of the line buffer
+// at each output row position. At the start of each line, line_[] is rotated instead of copying the
+// outputs through t_tmp, t and b, and each write() reads every line buffer once at the current address.
+// The storage format, word packing and read-before-write behavior of ac_linebuf are reproduced
+// exactly, so the outputs are bit-identical to the synthesis model for every AC_WMODE. Define
+// AC_BUFFER_2D_HW_SIM to simulate the synthesis model instead.
+template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE=AC_DUALPORT, typename ST=DTYPE>
+class ac_buffer_2d
+{
+
+  enum {AC_REWIND_VAL = (AC_REWIND&AC_WMODE)?1:0 };
+  enum {
+    AC_NLINES = AC_NROW-1+AC_REWIND_VAL,
+    IS_SINGLEPORT = bool(AC_WMODE&AC_SINGLEPORT),
+    AC_N = ac_linebuf_pack<ST, AC_WMODE>::N,
+    logAC_N = ac::log2_ceil<AC_N>::val,
+    AC_NCOL2 = (AC_NCOL + AC_N - 1)/AC_N,
+    // Output row position of the line buffer that is written: the oldest row, or the newest row when rewinding.
+    AC_WPOS = AC_REWIND_VAL ? 0 : AC_NLINES-1,
+  };
+  typedef ac_linebuf_pack<ST, AC_WMODE> ac_pack_type;
+  typedef typename ac_pack_type::data linebuf_type;
+
+  int cptr;                     //points to current col written
+  bool dummy[AC_NROW-1];
+  DTYPE wout_[AC_NROW];             // This array is what really gets read
+  linebuf_type ring_[AC_NLINES*AC_NCOL2];  // Line buffers, stored contiguously
+  linebuf_type tmp_out_[AC_NLINES];        // Packed word read register of each line buffer
+  linebuf_type tmp_in_[AC_NLINES];         // Packed word write register of each line buffer
+  int line_[AC_NLINES];                    // Line buffer index at each output row position
+  int sel;
+  int cnt;
+public:
+  // Line buffer resources, see ac_resource.h.
+  enum {
+    LB_LINES = AC_NROW-1+AC_REWIND_VAL,
+    LB_WORDS = (AC_NCOL + ac_linebuf_pack<ST, AC_WMODE>::N - 1)/ac_linebuf_pack<ST, AC_WMODE>::N,
+    LB_WORD_BITS = ac_linebuf_pack<ST, AC_WMODE>::N*ac_resource_bits<ST>::val,
+    LB_BITS = LB_LINES*LB_WORDS*LB_WORD_BITS,
+    LB_RAMS = LB_LINES
+  };
+  ac_buffer_2d() : cptr(0), sel(AC_NROW-2+AC_REWIND_VAL), cnt(0) {
+    linebuf_type dummy_val;
+    for (int i=0; i<AC_NROW; i++) {
+      wout_[i] = DTYPE(0);
+    }
+    for (int i=0; i<AC_NLINES*AC_NCOL2; i++) {
+      ring_[i] = dummy_val;
+    }
+    for (int k=0; k<AC_NLINES; k++) {
+      line_[k] = k;
+    }
+  }
+  DTYPE &operator[]      (int i);
+  const DTYPE &operator[](int i) const ;
+  void set_dummy(int idx, bool val) { dummy[idx] = val; }
+  void set_cptr(int idx) {cptr = idx; }
+  void set_wout(int idx, DTYPE val) { wout_[idx] = val; }
+  void write(DTYPE src, int i, bool w);
+
+  // Traces the stored lines and the read/write state (level AC_TRACE_DEBUG, category AC_TRACE_CAT_BUFFER).
+  void print() {
+    #if AC_TRACE_ON
+    ST w;
+    for (int k=0; k<AC_NLINES; k++) {
+      std::ostringstream row;
+      for (int j=0; j<AC_NCOL; j++) {
+        #pragma hls_waive CNS
+        if (AC_N > 1) {
+          ac_pack_type::get(j%AC_N, ring_[line_[k]*AC_NCOL2 + (j>>logAC_N)], w);
+        } else {
+          w = ring_[line_[k]*AC_NCOL2 + j];
+        }
+        row << w.to_int() << "  ";
+      }
+      AC_TRACE(AC_TRACE_DEBUG, AC_TRACE_CAT_BUFFER, row.str());
+    }
+    AC_TRACE(AC_TRACE_DEBUG, AC_TRACE_CAT_BUFFER, "sel = " << sel << ", cptr = " << cptr);
+    #endif
+  }
+
+  DTYPE get_wout(int idx) const { return wout_[idx]; }
+};
+
+#endif
+
+template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE, typename ST>
+inline  DTYPE &ac_buffer_2d<DTYPE, AC_NCOL,AC_NROW,AC_WMODE,ST>::operator[] (int i)
 {
   #ifndef __SYNTHESIS__
   assert((i>=0) && (i<AC_NROW));
@@ -256,8 +395,8 @@ inline  DTYPE &ac_buffer_2d<DTYPE, AC_NCOL,AC_NROW,AC_WMODE>::operator[] (int i)
   return wout_[AC_NROW-1-i];
 }
 
-template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE>
-inline  const DTYPE &ac_buffer_2d<DTYPE, AC_NCOL,AC_NROW,AC_WMODE>::operator[](int i) const
+template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE, typename ST>
+inline  const DTYPE &ac_buffer_2d<DTYPE, AC_NCOL,AC_NROW,AC_WMODE,ST>::operator[](int i) const
 {
   #ifndef __SYNTHESIS__
   assert((i>=0) && (i<AC_NROW));
@@ -266,13 +405,16 @@ inline  const DTYPE &ac_buffer_2d<DTYPE, AC_NCOL,AC_NROW,AC_WMODE>::operator[](i
 }
 
 
-template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE>
-void ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE>::write(DTYPE src,int i, bool w)
+#if defined(__SYNTHESIS__) || defined(AC_BUFFER_2D_HW_SIM)
+template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE, typename ST>
+void ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE,ST>::write(DTYPE src,int i, bool w)
 {
   #ifndef __SYNTHESIS__
   assert((i>=0) && (i < AC_NCOL));
   #endif
-  ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE>::set_cptr(i);
+  ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE,ST>::set_cptr(i);
+  const ST srcST = src;
+  const DTYPE srcQ = DTYPE(srcST);
 
   if ((i==0) & w) {
     sel += 1;
@@ -288,7 +430,7 @@ void ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE>::write(DTYPE src,int i, bool w
 #pragma hls_unroll yes
   #endif
   for (int j=0; j<AC_NROW-1+AC_REWIND_VAL; j++)
-  { data_tmp[j] = src; }
+  { data_tmp[j] = srcST; }
 
   data.access(data_tmp,t_tmp,i,s);
 
@@ -296,7 +438,7 @@ void ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE>::write(DTYPE src,int i, bool w
 #pragma hls_unroll yes
   #endif
   for (int j=0; j<AC_NROW-1+AC_REWIND_VAL; j++)
-  { t[j] = t_tmp[j]; }
+  { t[j] = DTYPE(t_tmp[j]); }
 
   #pragma hls_waive CNS
   if (!AC_REWIND_VAL) {
@@ -307,17 +449,17 @@ void ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE>::write(DTYPE src,int i, bool w
       sel1 = sel-j;
       if (sel1<=0)
       { sel1 = sel1 + AC_NROW-1; }
-      b[sel1] = t_tmp[j];
+      b[sel1] = DTYPE(t_tmp[j]);
     }
     #pragma hls_waive CNS
-    b[0] =  w ? src : t[AC_NROW-1];
+    b[0] =  w ? srcQ : t[AC_NROW-1];
   } else {
     #ifdef __SYNTHESIS__
 #pragma hls_unroll yes
     #endif
     for (int j=0; j<AC_NROW; j++) {
       if (sel==j)
-      { t[j] = w ? src : t[j]; }
+      { t[j] = w ? srcQ : t[j]; }
     }
 
     #ifdef __SYNTHESIS__
@@ -335,7 +477,57 @@ void ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE>::write(DTYPE src,int i, bool w
 #pragma hls_unroll yes
   #endif
   for (int j=0; j<AC_NROW; j++)
-  { ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE>::set_wout(j,b[j]); }
+  { ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE,ST>::set_wout(j,b[j]); }
 }
 
+#else
+template<typename DTYPE, int AC_NCOL, int AC_NROW, int AC_WMODE, typename ST>
+void ac_buffer_2d<DTYPE,AC_NCOL,AC_NROW,AC_WMODE,ST>::write(DTYPE src,int i, bool w)
+{
+  assert((i>=0) && (i < AC_NCOL));
+  cptr = i;
+  const ST srcST = src;
+
+  if ((i==0) & w) {
+    sel = (sel == AC_NLINES-1) ? 0 : sel + 1;
+    // The line buffer that was just written becomes the newest stored row, and every other row moves down.
+    int last = line_[AC_NLINES-1];
+    for (int k=AC_NLINES-1; k>0; k--)
+    { line_[k] = line_[k-1]; }
+    line_[0] = last;
+  }
+
+  const int wl = line_[AC_WPOS];
+  #pragma hls_waive CNS
+  if (AC_N > 1) {
+    // Same schedule as ac_linebuf: read the packed word on the first pixel of the word, and write it on the
+    // last pixel (singleport) or on every write (dual-port).
+    if (i == 0) { cnt = 0; }
+    const int a = i >> logAC_N;
+    if (w) { ac_pack_type::set(cnt, srcST, tmp_in_[wl]); }
+    for (int k=0; k<AC_NLINES; k++) {
+      const int l = line_[k];
+      if (cnt == 0) { tmp_out_[l] = ring_[l*AC_NCOL2 + a]; }
+      ST v;
+      ac_pack_type::get(cnt, tmp_out_[l], v);
+      wout_[k+1-AC_REWIND_VAL] = DTYPE(v);
+    }
+    if (w && (cnt == AC_N-1 || !IS_SINGLEPORT)) { ring_[wl*AC_NCOL2 + a] = tmp_in_[wl]; }
+    cnt = (cnt == AC_N-1) ? 0 : cnt + 1;
+  } else {
+    for (int k=0; k<AC_NLINES; k++)
+    { wout_[k+1-AC_REWIND_VAL] = DTYPE(ST(ring_[line_[k]*AC_NCOL2 + i])); }
+    if (w) { ring_[wl*AC_NCOL2 + i] = srcST; }
+  }
+
+  #pragma hls_waive CNS
+  if (!AC_REWIND_VAL) {
+    wout_[0] = w ? DTYPE(srcST) : DTYPE(0);
+  } else if (w) {
+    wout_[0] = DTYPE(srcST);
+  }
+}
+
+#endif
+
 #endif
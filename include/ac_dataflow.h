@@ -0,0 +1,353 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_dataflow.h
+//
+// Description:
+//  Opt-in concurrent C simulation of hierarchical designs. In the default C simulation, the hls_design
+//  sub-blocks of a design run one after the other, so every internal channel holds a whole frame and a
+//  simulation uses a single core. With AC_DATAFLOW_THREADS defined (and __SYNTHESIS__ not defined), the
+//  sub-blocks that a top level run() calls between AC_DATAFLOW_BEGIN and AC_DATAFLOW_END each run on their
+//  own thread, and the internal channels between them are bounded lock-free single-producer,
+//  single-consumer FIFOs (ac_spsc_channel) of AC_DATAFLOW_FIFO_DEPTH (4096 by default) tokens, or of the
+//  depth set for the channel with AC_DATAFLOW_DEPTH:
+//    - a read from an empty FIFO waits for the producer, a write to a full FIFO waits for the consumer,
+//      as the blocks of the synthesized design do, so the memory of a simulation no longer grows with
+//      the frame size;
+//    - a hierarchical design uses up to one core per sub-block.
+//  The top level channels are not changed: the sub-block that reads (writes) a top level channel is the
+//  only thread that accesses it. The outputs are the same as with the sequential simulation.
+//
+//  Internal channels are declared with ac_dataflow_channel<T>::type, which is ac_spsc_channel<T> with
+//  AC_DATAFLOW_THREADS, and ac_channel<T> otherwise, e.g. for synthesis. Without AC_DATAFLOW_THREADS the
+//  macros below expand to the plain, sequential calls.
+//
+//  If all running sub-blocks of a design wait on their FIFOs for AC_DATAFLOW_DEADLOCK_MS (2000 by
+//  default) milliseconds, the simulation is stopped with a message. This happens if a sub-block reads
+//  more tokens than its producer writes, or if a FIFO is too shallow for a pair of reconvergent paths.
+//  A FIFO that is merely shallower than the occupancy profiled by ac_perf.h (AC_PERF_CHANNEL) stalls its
+//  producer, but does not deadlock. A design sets the depth of a channel that needs more (or fewer) tokens
+//  than the default in its constructor, with AC_DATAFLOW_DEPTH.
+//
+//  ac_dataflow_set_threads(false) runs the sub-blocks inline, one after the other, with FIFOs that grow
+//  as needed, e.g. to compare the threaded and the sequential schedule in one executable, or to debug a
+//  single thread.
+//
+// Usage:
+//    // On the compiler command line, with -pthread:
+//    #define AC_DATAFLOW_THREADS
+//    #include <ac_ipl/ac_canny.h>
+//
+//    // In a hierarchical design:
+//    typename ac_dataflow_channel<gaussOpType>::type P1; // Internal channel
+//    ...
+//    void run(ac_channel<pixInType> &streamIn, ac_channel<pixOutType> &streamOut, ...) {
+//      AC_DATAFLOW_BEGIN(df);
+//      AC_DATAFLOW_CALL(df, gaussFilter(streamIn, P1, widthIn, heightIn));
+//      AC_DATAFLOW_CALL(df, edgeFilter(P1, streamOut, widthIn, heightIn));
+//      AC_DATAFLOW_END(df);
+//    }
+//    // The sub-blocks take the internal channels as ac_dataflow_channel<T>::type references.
+//
+//    // An internal channel without a consumer (e.g. the interconnect output of the last pyramid level):
+//    AC_DATAFLOW_DISCARD(stream_inter, true);
+//
+//    // An internal channel that holds about one token per image line:
+//    AC_DATAFLOW_DEPTH(P1, H_MAX + 8);
+//
+// Notes:
+//  - AC_DATAFLOW_THREADS and AC_DATAFLOW_FIFO_DEPTH must be defined before the first include of a
+//    library header, and the same in every translation unit.
+//  - The design object must not be used by two threads at once, and run() returns after all the
+//    sub-blocks have finished, so the outputs are complete when it returns.
+//  - The counters of ac_perf.h and the profiler of ac_range.h are not thread-safe and can't be combined
+//    with AC_DATAFLOW_THREADS. The trace sink of ac_trace.h is.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_DATAFLOW_H
+#define __AC_DATAFLOW_H
+
+#include <ac_channel.h>
+
+#ifndef AC_DATAFLOW_FIFO_DEPTH
+#define AC_DATAFLOW_FIFO_DEPTH 4096
+#endif
+
+#ifndef AC_DATAFLOW_DEADLOCK_MS
+#define AC_DATAFLOW_DEADLOCK_MS 2000
+#endif
+
+#if defined(AC_DATAFLOW_THREADS) && !defined(__SYNTHESIS__)
+#define AC_DATAFLOW_ON 1
+#else
+#define AC_DATAFLOW_ON 0
+#endif
+
+#if AC_DATAFLOW_ON
+
+#if defined(AC_PERF_COUNTERS)
+#error "AC_DATAFLOW_THREADS can't be combined with AC_PERF_COUNTERS, the counters are not thread-safe."
+#endif
+#if defined(AC_RANGE_PROFILE)
+#error "AC_DATAFLOW_THREADS can't be combined with AC_RANGE_PROFILE, the profiler is not thread-safe."
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Runs the sub-blocks of one call of a hierarchical design, one thread per sub-block.
+class ac_dataflow
+{
+public:
+  ac_dataflow() : running_(0), blocked_(0) { }
+  ~ac_dataflow() { join(); }
+
+  template<class FUNC>
+  void spawn(FUNC func) {
+    if (!threads()) {
+      func();
+      return;
+    }
+    running_++;
+    threads_.push_back(std::thread(&ac_dataflow::stage<FUNC>, this, func));
+  }
+
+  void join() {
+    for (unsigned i = 0; i < threads_.size(); i++) {
+      threads_[i].join();
+    }
+    threads_.clear();
+  }
+
+  // Runs the sub-blocks on threads (true, the default) or inline (false).
+  static bool &threads() {
+    static bool t = true;
+    return t;
+  }
+
+  // Waits until ready() is true. Called by the FIFOs of the sub-block running on this thread.
+  template<class COND>
+  static void wait(COND ready, const char *what) {
+    for (int i = 0; i < 64; i++) {
+      if (ready()) { return; }
+    }
+    ac_dataflow *df = current();
+    if (!df) {
+      // Sequential schedule, or a FIFO accessed outside of a sub-block: nothing can make it ready.
+      fprintf(stderr, "ac_dataflow: %s outside of a running dataflow sub-block\n", what);
+      abort();
+    }
+    df->blocked_++;
+    std::chrono::steady_clock::time_point stuck = std::chrono::steady_clock::now();
+    bool allBlocked = false;
+    while (!ready()) {
+      std::this_thread::yield();
+      if (df->blocked_.load() != df->running_.load()) {
+        allBlocked = false;
+      } else if (!allBlocked) {
+        allBlocked = true;
+        stuck = std::chrono::steady_clock::now();
+      } else if (std::chrono::steady_clock::now() - stuck > std::chrono::milliseconds(AC_DATAFLOW_DEADLOCK_MS)) {
+        fprintf(stderr, "ac_dataflow: deadlock, all %d running sub-blocks are blocked (%s)\n", df->running_.load(), what);
+        abort();
+      }
+    }
+    df->blocked_--;
+  }
+
+  // Dataflow call that the current thread runs a sub-block of, 0 on other threads.
+  static ac_dataflow *&current() {
+    static thread_local ac_dataflow *df = 0;
+    return df;
+  }
+
+private:
+  template<class FUNC>
+  void stage(FUNC func) {
+    current() = this;
+    func();
+    current() = 0;
+    running_--;
+  }
+
+  std::vector<std::thread> threads_;
+  std::atomic<int> running_; // Sub-blocks that have not finished
+  std::atomic<int> blocked_; // Sub-blocks waiting on a FIFO
+};
+
+inline void ac_dataflow_set_threads(bool t) { ac_dataflow::threads() = t; }
+
+// Bounded lock-free FIFO between two sub-blocks, with the ac_channel methods used by the library blocks.
+// The ring has one unused slot, so head_ == tail_ means empty.
+template<class T>
+class ac_spsc_channel
+{
+public:
+  ac_spsc_channel() : buf_(AC_DATAFLOW_FIFO_DEPTH + 1), head_(0), tailCache_(0), tail_(0), headCache_(0), maxSize_(0), discard_(false) { }
+
+  void write(const T &t) {
+    if (discard_) { return; }
+    unsigned h = head_.load(std::memory_order_relaxed);
+    unsigned n = next(h);
+    if (n == tailCache_) {
+      tailCache_ = tail_.load(std::memory_order_acquire);
+      if (n == tailCache_) {
+        if (!ac_dataflow::current()) {
+          // No consumer thread: grow, as an ac_channel would.
+          grow();
+          write(t);
+          return;
+        }
+        ac_dataflow::wait([this, n]() { return n != (tailCache_ = tail_.load(std::memory_order_acquire)); }, "write to a full FIFO");
+      }
+    }
+    buf_[h] = t;
+    head_.store(n, std::memory_order_release);
+    unsigned s = (n + buf_.size() - tailCache_) % buf_.size();
+    if (s > maxSize_) { maxSize_ = s; }
+  }
+
+  T read() {
+    unsigned t = tail_.load(std::memory_order_relaxed);
+    if (t == headCache_) {
+      headCache_ = head_.load(std::memory_order_acquire);
+      if (t == headCache_) {
+        ac_dataflow::wait([this, t]() { return t != (headCache_ = head_.load(std::memory_order_acquire)); }, "read from an empty FIFO");
+      }
+    }
+    T v = buf_[t];
+    tail_.store(next(t), std::memory_order_release);
+    return v;
+  }
+
+  void read(T &t) { t = read(); }
+
+  bool nb_read(T &t) {
+    if (empty()) { return false; }
+    t = read();
+    return true;
+  }
+
+  unsigned size() const {
+    return (head_.load(std::memory_order_acquire) + buf_.size() - tail_.load(std::memory_order_acquire)) % buf_.size();
+  }
+  unsigned debug_size() const { return size(); }
+  bool available(unsigned n) const { return size() >= n; }
+  bool empty() const { return size() == 0; }
+
+  // Most tokens held at once, as seen by the producer. Meaningful after the sub-blocks have finished.
+  unsigned max_size() const { return maxSize_; }
+
+  // Drop all writes, for a channel that has no consumer in the design.
+  void set_discard(bool d) { discard_ = d; }
+
+  // Number of tokens the FIFO holds. Only changed while the FIFO is empty and no sub-block runs.
+  void set_depth(unsigned depth) {
+    if (!empty() || ac_dataflow::current()) {
+      fprintf(stderr, "ac_dataflow: set_depth() on a FIFO in use\n");
+      abort();
+    }
+    buf_.assign(depth + 1, T());
+    head_.store(0);
+    tail_.store(0);
+    tailCache_ = 0;
+    headCache_ = 0;
+  }
+  unsigned depth() const { return buf_.size() - 1; }
+
+private:
+  unsigned next(unsigned i) const { return (i + 1 == buf_.size()) ? 0 : i + 1; }
+
+  // Only called without a consumer thread.
+  void grow() {
+    unsigned s = size();
+    std::vector<T> b(2*buf_.size());
+    for (unsigned i = 0; i < s; i++) {
+      b[i] = buf_[(tail_.load() + i) % buf_.size()];
+    }
+    buf_.swap(b);
+    tail_.store(0);
+    head_.store(s);
+    tailCache_ = 0;
+    headCache_ = 0;
+  }
+
+  std::vector<T> buf_;
+  alignas(64) std::atomic<unsigned> head_; // Written by the producer
+  unsigned tailCache_;                     // Producer copy of tail_
+  alignas(64) std::atomic<unsigned> tail_; // Written by the consumer
+  unsigned headCache_;                     // Consumer copy of head_
+  unsigned maxSize_;
+  bool discard_;
+};
+
+template<class T, bool INTERNAL = true>
+struct ac_dataflow_channel
+{
+  typedef ac_spsc_channel<T> type;
+};
+
+#define AC_DATAFLOW_BEGIN(df) ac_dataflow df
+#define AC_DATAFLOW_CALL(df, ...) df.spawn([&]() { __VA_ARGS__; })
+#define AC_DATAFLOW_END(df) df.join()
+#define AC_DATAFLOW_DISCARD(chan, d) (chan).set_discard(d)
+#define AC_DATAFLOW_DEPTH(chan, depth) (chan).set_depth(depth)
+
+#else
+
+template<class T, bool INTERNAL = true>
+struct ac_dataflow_channel
+{
+  typedef ac_channel<T> type;
+};
+
+#define AC_DATAFLOW_BEGIN(df)
+#define AC_DATAFLOW_CALL(df, ...) __VA_ARGS__
+#define AC_DATAFLOW_END(df)
+#define AC_DATAFLOW_DISCARD(chan, d)
+#define AC_DATAFLOW_DEPTH(chan, depth)
+
+#endif
+
+// Top level channels (INTERNAL = false) stay ac_channel<T>, e.g. the input of the first level of a pyramid,
+// whose level blocks otherwise read an internal channel.
+template<class T>
+struct ac_dataflow_channel<T, false>
+{
+  typedef ac_channel<T> type;
+};
+
+#endif
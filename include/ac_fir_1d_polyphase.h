@@ -0,0 +1,213 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_fir_1d_polyphase.h
+//
+// Description:
+//  Polyphase 1D FIR filter bank for integer decimation and interpolation by AC_NPHASE. AC_NFILT filters
+//  of AC_NTAPS taps share one delay line, e.g. the high-pass and low-pass analysis filters of a wavelet
+//  transform. Only the outputs that are kept are computed:
+//
+//  - decimate() shifts in one input sample per call and evaluates one polyphase branch per call, i.e.
+//    ceil(AC_NTAPS/AC_NPHASE) multiplies per filter instead of AC_NTAPS. The partial sums are accumulated
+//    over AC_NPHASE calls, and decimate() returns true on the call that completes an output. Output m is
+//
+//      out[m] = sum(i = 0 .. AC_NTAPS-1) coeff[i]*x[m*AC_NPHASE - (AC_NTAPS-1) + i]
+//
+//    so coeff[AC_NTAPS-1] multiplies the newest sample, as in the ac_window based filters. Output m is
+//    complete after sample m*AC_NPHASE + AC_NPHASE-1 has been written.
+//
+//  - write() shifts in one input sample, after which interpolate(p), p = 0 .. AC_NPHASE-1, gives the
+//    AC_NPHASE outputs of the zero-stuffed upsampled signal for that input sample, with
+//    ceil(AC_NTAPS/AC_NPHASE) multiplies per output:
+//
+//      out[m*AC_NPHASE + p] = sum(j) coeff[AC_NTAPS-1-p-j*AC_NPHASE]*x[m-j]
+//
+//  A start-of-signal flag (sos) on the first sample of a signal clears the delay line, so samples before
+//  the start of the signal are taken as zero, and restarts the decimation phase.
+//
+// Usage:
+//    typedef ac_fixed<24,8,true> T;
+//    const T coeff[2][4] = {{...}, {...}};
+//    ac_fir_1d_polyphase<T, T, T, 4, 2, 2> fir;
+//    T out[2];
+//    ...
+//    if (fir.decimate(x, n == 0, coeff, out)) {
+//      hpOut.write(out[0]);
+//      lpOut.write(out[1]);
+//    }
+//
+//*********************************************************************************************************
+
+#ifndef __AC_FIR_1D_POLYPHASE_H
+#define __AC_FIR_1D_POLYPHASE_H
+
+#include <ac_int.h>
+
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+template<class T, class COEF_T, class ACC_T, int AC_NTAPS, int AC_NPHASE, int AC_NFILT = 1>
+class ac_fir_1d_polyphase
+{
+public:
+  enum {
+    AC_NSUB = (AC_NTAPS + AC_NPHASE - 1)/AC_NPHASE, // Taps per polyphase branch
+    AC_NDELAY = AC_NSUB*AC_NPHASE                   // Delay line length
+  };
+
+  ac_fir_1d_polyphase();
+  bool decimate(const T &src, bool sos, const COEF_T (&coeff)[AC_NFILT][AC_NTAPS], ACC_T (&out)[AC_NFILT]);
+  void write(const T &src, bool sos);
+  void interpolate(int p, const COEF_T (&coeff)[AC_NFILT][AC_NTAPS], ACC_T (&out)[AC_NFILT]) const;
+
+private:
+  void shift(const T &src, bool sos);
+
+  T   data_[AC_NDELAY];  // Delay line, data_[i] is x[n-i]
+  ACC_T acc_[AC_NFILT];  // Partial sums of the decimated outputs
+  ac_int<ac::nbits<AC_NPHASE>::val, false> phase_; // Decimation phase of the last sample
+};
+
+template<class T, class COEF_T, class ACC_T, int AC_NTAPS, int AC_NPHASE, int AC_NFILT>
+ac_fir_1d_polyphase<T,COEF_T,ACC_T,AC_NTAPS,AC_NPHASE,AC_NFILT>::ac_fir_1d_polyphase() : phase_(0)
+{
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i = 0; i < AC_NDELAY; i++) {
+    data_[i] = 0;
+  }
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int f = 0; f < AC_NFILT; f++) {
+    acc_[f] = 0;
+  }
+}
+
+template<class T, class COEF_T, class ACC_T, int AC_NTAPS, int AC_NPHASE, int AC_NFILT>
+void ac_fir_1d_polyphase<T,COEF_T,ACC_T,AC_NTAPS,AC_NPHASE,AC_NFILT>::shift(const T &src, bool sos)
+{
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i = AC_NDELAY - 1; i > 0; i--) {
+    data_[i] = sos ? T(0) : data_[i - 1];
+  }
+  data_[0] = src;
+}
+
+template<class T, class COEF_T, class ACC_T, int AC_NTAPS, int AC_NPHASE, int AC_NFILT>
+bool ac_fir_1d_polyphase<T,COEF_T,ACC_T,AC_NTAPS,AC_NPHASE,AC_NFILT>::decimate(
+  const T      &src,                           // Input sample
+  bool         sos,                            // Start of signal
+  const COEF_T (&coeff)[AC_NFILT][AC_NTAPS],   // Filter coefficients
+  ACC_T        (&out)[AC_NFILT]                // Filter outputs, valid when true is returned
+)
+{
+  shift(src, sos);
+  if (sos) {
+    phase_ = 0;
+  }
+
+  // In phase p of output m, the samples at delay line positions AC_NPHASE-1 + j*AC_NPHASE are
+  // x[m*AC_NPHASE - k], with k = AC_NPHASE-1-p + j*AC_NPHASE. The same positions are therefore read in
+  // every phase, and only the coefficients AC_NTAPS-1-k change with the phase.
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int f = 0; f < AC_NFILT; f++) {
+    ACC_T partial = 0;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int j = 0; j < AC_NSUB; j++) {
+      int i = AC_NTAPS - AC_NPHASE + phase_ - j*AC_NPHASE;
+      if (i >= 0) {
+        ACC_T prod = data_[AC_NPHASE - 1 + j*AC_NPHASE]*coeff[f][i];
+        partial += prod;
+      }
+    }
+    if (phase_ == 0) {
+      acc_[f] = partial;
+    } else {
+      acc_[f] += partial;
+    }
+    out[f] = acc_[f];
+  }
+
+  bool valid = (phase_ == AC_NPHASE - 1);
+  if (valid) {
+    phase_ = 0;
+  } else {
+    phase_++;
+  }
+  return valid;
+}
+
+template<class T, class COEF_T, class ACC_T, int AC_NTAPS, int AC_NPHASE, int AC_NFILT>
+void ac_fir_1d_polyphase<T,COEF_T,ACC_T,AC_NTAPS,AC_NPHASE,AC_NFILT>::write(const T &src, bool sos)
+{
+  shift(src, sos);
+}
+
+template<class T, class COEF_T, class ACC_T, int AC_NTAPS, int AC_NPHASE, int AC_NFILT>
+void ac_fir_1d_polyphase<T,COEF_T,ACC_T,AC_NTAPS,AC_NPHASE,AC_NFILT>::interpolate(
+  int          p,                              // Output phase, 0 .. AC_NPHASE-1
+  const COEF_T (&coeff)[AC_NFILT][AC_NTAPS],   // Filter coefficients
+  ACC_T        (&out)[AC_NFILT]                // Filter outputs
+) const
+{
+  #ifndef __SYNTHESIS__
+  assert((0 <= p) && (p < AC_NPHASE));
+  #endif
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int f = 0; f < AC_NFILT; f++) {
+    ACC_T sum = 0;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int j = 0; j < AC_NSUB; j++) {
+      int i = AC_NTAPS - 1 - p - j*AC_NPHASE;
+      if (i >= 0) {
+        ACC_T prod = data_[j]*coeff[f][i];
+        sum += prod;
+      }
+    }
+    out[f] = sum;
+  }
+}
+
+#endif
@@ -0,0 +1,115 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_frame_flags.h
+//
+// Description:
+//  Derives the sof/eof/sol/eol window flags from the flags embedded in an AXI4-Stream video pixel, i.e.
+//  TUSER (start of frame) and TLAST (end of line), as carried by RGB_1PPC and RGB_2PPC. No width or
+//  height ports are needed, and the frame size can change from one frame to the next.
+//
+//  The end of frame is not marked in the stream: a frame ends with the TLAST pixel that is followed by a
+//  TUSER pixel. ac_frame_flags therefore reads one pixel ahead of the pixel that it returns: prime() reads
+//  the first pixel of the stream, outside of the pixel loop, and each read() returns the held pixel and
+//  reads the next one, so a pipelined loop that calls read() does one channel read per iteration. After the
+//  last frame of a stream, the source must send the first pixel of a new frame (or a single TUSER pixel) so
+//  that the last pixel of that frame can be returned with eof set. In hardware, the decoder otherwise waits
+//  for that pixel; in C simulation, read() checks that the pixel is in the channel.
+//
+//  Only the input of a design needs the lookahead: the blocks behind it can pass the decoded flags, eof
+//  included, on their internal channels (see ac_stencil_2d_flag_source in ac_stencil_2d.h).
+//
+// Usage:
+//    ac_frame_flags<RGB_1PPC<8> > frameIn; // Must persist across frames, e.g. as a class member.
+//    ...
+//    RGB_1PPC<8> pix;
+//    bool sof, eof, sol, eol;
+//    if (!frameIn.primed()) { frameIn.prime(streamIn); } // Before the pixel loop
+//    ...
+//    frameIn.read(streamIn, pix, sof, eof, sol, eol);    // In the pixel loop
+//    win.write(pix, sof, eof, sol, eol);
+//
+//*********************************************************************************************************
+
+#ifndef __AC_FRAME_FLAGS_H
+#define __AC_FRAME_FLAGS_H
+
+#include <ac_channel.h>
+
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+template<class IN_TYPE>
+class ac_frame_flags
+{
+public:
+  ac_frame_flags() : primed_(false), eolPrev(true) { }
+  bool primed() const { return primed_; }
+  void prime(ac_channel<IN_TYPE> &streamIn);
+  void read(ac_channel<IN_TYPE> &streamIn, IN_TYPE &pix, bool &sof, bool &eof, bool &sol, bool &eol);
+
+private:
+  IN_TYPE next;    // Lookahead pixel
+  bool    primed_; // Has the lookahead pixel been read?
+  bool    eolPrev; // Was the previous pixel the last pixel of a line?
+};
+
+// Read the first pixel of the stream into the lookahead pixel.
+template<class IN_TYPE>
+void ac_frame_flags<IN_TYPE>::prime(ac_channel<IN_TYPE> &streamIn)
+{
+  next = streamIn.read();
+  primed_ = true;
+  #ifndef __SYNTHESIS__
+  assert(next.TUSER && "The first pixel of the stream must have TUSER set.");
+  #endif
+}
+
+// Return the lookahead pixel, along with its frame flags, and read the next one. prime() must have been
+// called first.
+template<class IN_TYPE>
+void ac_frame_flags<IN_TYPE>::read(ac_channel<IN_TYPE> &streamIn, IN_TYPE &pix, bool &sof, bool &eof, bool &sol, bool &eol)
+{
+  #ifndef __SYNTHESIS__
+  assert(primed_ && "prime() must be called before the first read().");
+  assert(streamIn.available(1) && "Incomplete stream: the last frame must be followed by a TUSER pixel, e.g. the first pixel of the next frame.");
+  #endif
+  pix = next;
+  next = streamIn.read();
+  sof = pix.TUSER;
+  sol = sof || eolPrev;
+  eol = pix.TLAST;
+  eof = eol && next.TUSER;
+  eolPrev = eol;
+}
+
+#endif
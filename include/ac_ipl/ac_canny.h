@@ -34,6 +34,10 @@
 #include <ac_int.h>
 #include <ac_fixed.h>
 #include <ac_window_2d_flag.h>
+#include <ac_stencil_2d.h>
+#include <ac_perf.h>
+#include <ac_range.h>
+#include <ac_dataflow.h>
 #include <ac_math/ac_sqrt_pwl.h>
 #include <ac_math/ac_reciprocal_pwl.h>
 #include <ac_math/ac_atan_pwl.h>
@@ -49,6 +53,7 @@ public:
   typedef ac_int<1, false> pixOutType;
   typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
   typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
+  typedef ac_int<16, false> nFramesInType;
 
   #pragma hls_design interface
   void CCS_BLOCK(run) (
@@ -57,12 +62,19 @@ public:
     const widthInType      widthIn,     // Input width
     const heightInType     heightIn,    // Input height
     const pixInType        threshLowIn, // Lower threshold for hysteresis
-    const pixInType        threshUppIn  // Upper threshold for hysteresis
+    const pixInType        threshUppIn, // Upper threshold for hysteresis
+    const nFramesInType    nFramesIn = 1 // Number of frames streamed back to back, all of widthIn x heightIn
   ) {
-    gaussFilter(streamIn, P1, widthIn, heightIn);
-    edgeFilter(P1, P2, P3, widthIn, heightIn);
-    NMS(P2, P3, P4, widthIn, heightIn);
-    hysThresh(P4, streamOut, widthIn, heightIn, threshLowIn, threshUppIn);
+    AC_PERF_CHANNEL(P1, "ac_canny::P1");
+    AC_PERF_CHANNEL(P2, "ac_canny::P2");
+    AC_PERF_CHANNEL(P3, "ac_canny::P3");
+    AC_PERF_CHANNEL(P4, "ac_canny::P4");
+    AC_DATAFLOW_BEGIN(df);
+    AC_DATAFLOW_CALL(df, gaussFilter(streamIn, P1, widthIn, heightIn, nFramesIn));
+    AC_DATAFLOW_CALL(df, edgeFilter(P1, P2, P3, widthIn, heightIn, nFramesIn));
+    AC_DATAFLOW_CALL(df, NMS(P2, P3, P4, widthIn, heightIn, nFramesIn));
+    AC_DATAFLOW_CALL(df, hysThresh(P4, streamOut, widthIn, heightIn, threshLowIn, threshUppIn, nFramesIn));
+    AC_DATAFLOW_END(df);
   }
 
   ac_canny() { }
@@ -88,18 +100,141 @@ private:
   // 0/0b00: 0 degrees, 1/0b01: 45 degrees, 2/0b10: 90 degrees, 3/0b11: 135 degrees.
   // A 2-bit ac_int value is hence deemed suitable to store edge angle values.
   typedef ac_int<2, false> angOpType;
+  // The pre-calculated bitwidths for the output of edge detected depend on the supplied 3x3 sobel edge filter implementation.
+  // Any other implmentation might require different bitwidths.
+  typedef ac_fixed<magOpType::width, magOpType::i_width, true> edgeFiltOpType;
+  typedef ac_fixed<NFRAC_BITS, 0, false> gaussCoeffType;
+  typedef ac_int<3, true> edgeCoeffType;
+
+  // Internal channel types, bounded FIFOs in a threaded C simulation (see ac_dataflow.h).
+  typedef typename ac_dataflow_channel<gaussOpType>::type gaussChanType;
+  typedef typename ac_dataflow_channel<magOpType>::type   magChanType;
+  typedef typename ac_dataflow_channel<angOpType>::type   angChanType;
+  typedef typename ac_dataflow_channel<pixInType>::type   nmsChanType;
+
+  // Window types of the stages.
+  typedef ac_window_2d_flag<pixInType, 5, 5, W_MAX, FILT_WMODE>   gaussWindType;
+  typedef ac_window_2d_flag<gaussOpType, 3, 3, W_MAX, FILT_WMODE> edgeWindType;
+  // The NMS window holds the edge magnitude (bits 0 to magOpType::width - 1) and the edge angle of a pixel.
+  typedef ac_int<magOpType::width + angOpType::width, false>      nmsPixType;
+  typedef ac_window_2d_flag<nmsPixType, 3, 3, W_MAX, OTHER_WMODE> nmsWindType;
+  typedef ac_window_2d_flag<pixInType, 3, 3, W_MAX, OTHER_WMODE>  hysWindType;
+
+public:
+  // Resources and latency of this configuration, see ac_resource.h. The multipliers are the 5x5 Gaussian
+  // filter, the two 3x3 Sobel filters, Gx*Gx, Gy*Gy and abs(Gy)*abs(1/Gx), and the square root, reciprocal
+  // and arctangent PWL functions.
+  enum {
+    LB_BITS = gaussWindType::LB_BITS + edgeWindType::LB_BITS + nmsWindType::LB_BITS + hysWindType::LB_BITS,
+    LB_RAMS = gaussWindType::LB_RAMS + edgeWindType::LB_RAMS + nmsWindType::LB_RAMS + hysWindType::LB_RAMS,
+    MULTIPLIERS = 5*5 + 2*3*3 + 3 + 3,
+    LATENCY_LINES = gaussWindType::LATENCY_LINES + edgeWindType::LATENCY_LINES + nmsWindType::LATENCY_LINES + hysWindType::LATENCY_LINES,
+    LATENCY_PIXELS = gaussWindType::LATENCY_PIXELS + edgeWindType::LATENCY_PIXELS + nmsWindType::LATENCY_PIXELS + hysWindType::LATENCY_PIXELS
+  };
+
+private:
+
+  // Functors called by ac_stencil_2d for every valid window of the gaussFilter(), edgeFilter(), NMS() and
+  // hysThresh() stages. Each one computes the output of its stage and writes it to the stage output(s).
+  struct gaussFiltOut {
+    ac_canny                &canny;
+    const gaussCoeffType    (&B)[5][5];
+    gaussChanType           &gaussOut;
+    gaussFiltOut(ac_canny &c, const gaussCoeffType (&b)[5][5], gaussChanType &o) : canny(c), B(b), gaussOut(o) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      gaussOpType gaussOp = canny.template windFilt<gaussOpType>(B, acWindObj);
+      AC_RANGE_TRACK("ac_canny::gaussOp", gaussOp);
+      AC_PERF_WRITE(gaussOut);
+      gaussOut.write(gaussOp);
+    }
+  };
+
+  struct edgeFiltOut {
+    ac_canny              &canny;
+    const edgeCoeffType   (&KGx)[3][3];
+    const edgeCoeffType   (&KGy)[3][3];
+    magChanType           &magOut;
+    angChanType           &angOut;
+    edgeFiltOut(ac_canny &c, const edgeCoeffType (&kx)[3][3], const edgeCoeffType (&ky)[3][3], magChanType &m, angChanType &a)
+      : canny(c), KGx(kx), KGy(ky), magOut(m), angOut(a) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      // Calculate horizontal and vertical image derivatives.
+      edgeFiltOpType Gx = canny.template windFilt<edgeFiltOpType>(KGx, acWindObj);
+      edgeFiltOpType Gy = canny.template windFilt<edgeFiltOpType>(KGy, acWindObj);
+      AC_RANGE_TRACK("ac_canny::Gx", Gx);
+      AC_RANGE_TRACK("ac_canny::Gy", Gy);
+      magOpType magOp;
+      angOpType angOp;
+      // Calculate magnitude of the edge, as well as its direction.
+      canny.edgeOpCalc(Gx, Gy, magOp, angOp);
+      AC_RANGE_TRACK("ac_canny::magOp", magOp);
+      AC_PERF_WRITE(magOut);
+      magOut.write(magOp);
+      AC_PERF_WRITE(angOut);
+      angOut.write(angOp);
+    }
+  };
+
+  struct NMSOut {
+    ac_canny    &canny;
+    nmsChanType &NMS_magOut;
+    NMSOut(ac_canny &c, nmsChanType &o) : canny(c), NMS_magOut(o) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      pixInType NMS_magOut_temp;
+      // Calculate NMS output using NMS_outCalc function.
+      canny.NMS_outCalc(acWindObj, eol, NMS_magOut_temp);
+      AC_PERF_WRITE(NMS_magOut);
+      NMS_magOut.write(NMS_magOut_temp);
+    }
+  };
+
+  // Input source of the NMS() stencil: packs the edge magnitude and angle of a pixel into one window pixel.
+  struct NMSIn : ac_stencil_2d_source {
+    magChanType &magOut;
+    angChanType &angOut;
+    NMSIn(magChanType &m, angChanType &a) : magOut(m), angOut(a) { }
+    nmsPixType read() {
+      AC_PERF_READ(magOut);
+      magOpType magOp = magOut.read();
+      AC_PERF_READ(angOut);
+      angOpType angOp = angOut.read();
+      nmsPixType pix;
+      pix.set_slc(0, magOp.template slc<magOpType::width>(0));
+      pix.set_slc(magOpType::width, angOp);
+      return pix;
+    }
+  };
+
+  struct hysThreshOut {
+    ac_canny               &canny;
+    const pixInType        threshLowIn;
+    const pixInType        threshUppIn;
+    ac_channel<pixOutType> &streamOut;
+    hysThreshOut(ac_canny &c, const pixInType lo, const pixInType hi, ac_channel<pixOutType> &o) : canny(c), threshLowIn(lo), threshUppIn(hi), streamOut(o) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      // The hysteresis edge tracking output is the final output of the canny edge detector.
+      AC_PERF_WRITE(streamOut);
+      streamOut.write(canny.hysCalc(acWindObj, threshLowIn, threshUppIn));
+    }
+  };
 
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void gaussFilter(
     ac_channel<pixInType>   &streamIn,
-    ac_channel<gaussOpType> &gaussOut, // Gaussian filter output.
+    gaussChanType           &gaussOut, // Gaussian filter output.
     const widthInType       widthIn,
-    const heightInType      heightIn
+    const heightInType      heightIn,
+    const nFramesInType     nFramesIn
   ) {
+    AC_PERF_SCOPE("ac_canny::gaussFilter");
     const unsigned GK_SZ = 5;
 
-    const ac_fixed<NFRAC_BITS, 0, false> B[GK_SZ][GK_SZ] = {
+    const gaussCoeffType B[GK_SZ][GK_SZ] = {
       {0.012146, 0.026110, 0.033697, 0.026110, 0.012146},
       {0.026110, 0.056127, 0.072438, 0.056127, 0.026110},
       {0.033697, 0.072438, 0.093487, 0.072438, 0.033697},
@@ -107,226 +242,78 @@ private:
       {0.012146, 0.026110, 0.033697, 0.026110, 0.012146}
     };
 
-    // Declare window object to store input pixel values for gaussian filtering.
-    ac_window_2d_flag<pixInType, GK_SZ, GK_SZ, W_MAX, FILT_WMODE> acWindObj;
-
-    ac_int<ac::nbits<H_MAX>::val, false> i = 0;
-    ac_int<ac::nbits<W_MAX>::val, false> j = 0;
-
-    bool inRead = true, eofOut = false;
-
-    #pragma hls_pipeline_init_interval 1
-    GAUSS_PROC_LOOP: do {
-      pixInType pixIn = inRead ? streamIn.read() : pixInType(0);
-      // Calculate sof, eof, sol and eol based on image coordinates.
-      bool sol = (j == 0);
-      bool sof = (i == 0) && sol;
-      bool eol = (j == widthIn - 1);
-      bool eof = (i == heightIn - 1) && eol;
-      // Write input frame value to the window object.
-      acWindObj.write(pixIn, sof, eof, sol, eol);
-      if (eof) {
-        inRead = false; // Stop reading input channel after valid image region.
-      }
-      j++; // Update column counter after every pixel received.
-      if (j == widthIn) {
-        j = 0; // Max. possible j value = widthIn - 1.
-        i++; // Update row counter after every line received.
-        if (i == heightIn) {
-          i = 0; // Max. possible i value = heightIn - 1.
-        }
-      }
-
-      bool sofOut, solOut, eolOut;
-      acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
-      if (acWindObj.valid()) {
-        // If the window has ramped up, call windFilt() to produce a filtered output.
-        gaussOpType gaussOp = windFilt<gaussOpType> (B, acWindObj);
-        gaussOut.write(gaussOp);
-      }
-    } while (!eofOut); // Stop processing once the entire image output has been read.
+    // The stencil engine streams the input through a 5x5 window and calls gaussFiltOut for every valid window.
+    gaussFiltOut func(*this, B, gaussOut);
+    ac_stencil_2d<pixInType, GK_SZ, GK_SZ, W_MAX, FILT_WMODE, gaussFiltOut> stencil;
+    stencil.run(streamIn, widthIn, heightIn, nFramesIn, func);
   }
 
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void edgeFilter(
-    ac_channel<gaussOpType> &gaussOut, // Gaussian filter output.
-    ac_channel<magOpType>   &magOut,   // Edge magnitude output.
-    ac_channel<angOpType>   &angOut,   // Edge angle/direction output.
+    gaussChanType           &gaussOut, // Gaussian filter output.
+    magChanType             &magOut,   // Edge magnitude output.
+    angChanType             &angOut,   // Edge angle/direction output.
     const widthInType       widthIn,
-    const heightInType      heightIn
+    const heightInType      heightIn,
+    const nFramesInType     nFramesIn
   ) {
-    // The pre-calculated bitwidths for the output of edge detected depend on the supplied 3x3 sobel edge filter implementation.
-    // Any other implmentation might require different bitwidths.
-    typedef ac_fixed<magOpType::width, magOpType::i_width, true> edgeFiltOpType;
-
+    AC_PERF_SCOPE("ac_canny::edgeFilter");
     // Define kernels for edge detect filter. In this case, two 3x3 sobel edge detect kernels are used.
     const unsigned EK_SZ = 3;
-    const ac_int<3, true> KGx[EK_SZ][EK_SZ] = {
+    const edgeCoeffType KGx[EK_SZ][EK_SZ] = {
       {1, 0, -1},
       {2, 0, -2},
       {1, 0, -1}
     };
-    const ac_int<3, true> KGy[EK_SZ][EK_SZ] = {
+    const edgeCoeffType KGy[EK_SZ][EK_SZ] = {
       {-1, -2, -1},
       { 0,  0,  0},
       { 1,  2,  1}
     };
     
-    // Declare window object to store input pixel values for edge detection.
-    ac_window_2d_flag<gaussOpType, EK_SZ, EK_SZ, W_MAX, FILT_WMODE> acWindObj;
-
-    ac_int<ac::nbits<H_MAX>::val, false> i = 0;
-    ac_int<ac::nbits<W_MAX>::val, false> j = 0;
-
-    bool inRead = true, eofOut = false;
-    
-    // The mechanism by which EDGE_PROC_LOOP operates to read input values and flush out all filtered outputs
-    // is very similar to the mechanism of GAUSS_PROC_LOOP. Please refer to the functioning of
-    // that, to get a better understanding of how the edge detection loop works.
-    #pragma hls_pipeline_init_interval 1
-    EDGE_PROC_LOOP: do {
-      gaussOpType gaussOp = inRead ? gaussOut.read() : gaussOpType(0.0);
-      bool sol = (j == 0);
-      bool sof = (i == 0) && sol;
-      bool eol = (j == widthIn - 1);
-      bool eof = (i == heightIn - 1) && eol;
-      acWindObj.write(gaussOp, sof, eof, sol, eol);
-      if (eof) {
-        inRead = false;
-      }
-      j++;
-      if (j == widthIn) {
-        j = 0;
-        i++;
-        if (i == heightIn) {
-          i = 0;
-        }
-      }
-
-      bool sofOut, solOut, eolOut;
-      acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
-      if (acWindObj.valid()) {
-        // Calculate horizontal and vertical image derivatives.
-        edgeFiltOpType Gx = windFilt<edgeFiltOpType> (KGx, acWindObj);
-        edgeFiltOpType Gy = windFilt<edgeFiltOpType> (KGy, acWindObj);
-        magOpType magOp;
-        angOpType angOp;
-        // Calculate magnitude of the edge, as well as its direction.
-        edgeOpCalc(Gx, Gy, magOp, angOp);
-        magOut.write(magOp);
-        angOut.write(angOp);
-      }
-    } while (!eofOut); // Stop processing once the entire image output has been read.
+    // Stream the Gaussian filter output through a 3x3 window, as in gaussFilter().
+    edgeFiltOut func(*this, KGx, KGy, magOut, angOut);
+    ac_stencil_2d<gaussOpType, EK_SZ, EK_SZ, W_MAX, FILT_WMODE, edgeFiltOut> stencil;
+    stencil.run(gaussOut, widthIn, heightIn, nFramesIn, func);
   }
 
   // Non-maximum suppression block.
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void NMS(
-    ac_channel<magOpType> &magOut,
-    ac_channel<angOpType> &angOut,
-    ac_channel<pixInType> &NMS_magOut, // Non-maximum suppressed (NMS) magnitude output.
+    magChanType           &magOut,
+    angChanType           &angOut,
+    nmsChanType           &NMS_magOut, // Non-maximum suppressed (NMS) magnitude output.
     const widthInType     widthIn,
-    const heightInType    heightIn
+    const heightInType    heightIn,
+    const nFramesInType   nFramesIn
   ) {
-    // A 3x3 window is used for storing edge magnitude values, and a 2x2 window is used to store edge
-    // angle values, with the design only using the top left window value for non-maximum suppression.
-    // Both windows assume zero padding.
-    ac_window_2d_flag<magOpType, 3, 3, W_MAX, OTHER_WMODE> acWindMagObj(0.0);
-    ac_window_2d_flag<angOpType, 2, 2, W_MAX, OTHER_WMODE> acWindAngObj(0.0);
-
-    ac_int<ac::nbits<H_MAX>::val, false> i = 0;
-    ac_int<ac::nbits<W_MAX>::val, false> j = 0;
-
-    bool inRead = true, eofOut = false;
-    
-    // The mechanism by which NMS_PROC_LOOP operates to read input values and flush out all outputs
-    // is very similar to the mechanism of GAUSS_PROC_LOOP. Please refer to the functioning of
-    // that, to get a better understanding of how the NMS processing loop works.
-    #pragma hls_pipeline_init_interval 1
-    NMS_PROC_LOOP: do {
-      magOpType magOp = inRead ? magOut.read() : magOpType(0.0);
-      angOpType angOp = inRead ? angOut.read() : angOpType(0);
-      bool sol = (j == 0);
-      bool sof = (i == 0) && sol;
-      bool eol = (j == widthIn - 1);
-      bool eof = (i == heightIn - 1) && eol;
-      acWindMagObj.write(magOp, sof, eof, sol, eol);
-      acWindAngObj.write(angOp, sof, eof, sol, eol);
-      if (eof) {
-        inRead = false;
-      }
-      j++;
-      if (j == widthIn) {
-        j = 0;
-        i++;
-        if (i == heightIn) {
-          i = 0;
-        }
-      }
-
-      bool sofOut, solOut, eolOut;
-      acWindMagObj.readFlags(sofOut, eofOut, solOut, eolOut);
-      if (acWindMagObj.valid()) {
-        pixInType NMS_magOut_temp;
-        // Calculate NMS output using NMS_outCalc function.
-        NMS_outCalc(acWindMagObj, acWindAngObj, NMS_magOut_temp);
-        NMS_magOut.write(NMS_magOut_temp);
-      }
-    } while (!eofOut); // Stop processing once the entire image output has been read.
+    AC_PERF_SCOPE("ac_canny::NMS");
+    // The edge magnitude and angle of each pixel are streamed through a 3x3 window, whose pixels hold
+    // both values. The window assumes zero padding, and only the angle of the center pixel is used.
+    NMSIn src(magOut, angOut);
+    NMSOut func(*this, NMS_magOut);
+    ac_stencil_2d<nmsPixType, 3, 3, W_MAX, OTHER_WMODE, NMSOut> stencil(0);
+    stencil.run(src, widthIn, heightIn, nFramesIn, func);
   }
 
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void hysThresh(
-    ac_channel<pixInType>  &NMS_magOut,
+    nmsChanType            &NMS_magOut,
     ac_channel<pixOutType> &streamOut, // Output of the canny edge detector/hysteresis edge tracker.
     const widthInType      widthIn,
     const heightInType     heightIn,
     const pixInType        threshLowIn,
-    const pixInType        threshUppIn
+    const pixInType        threshUppIn,
+    const nFramesInType    nFramesIn
   ) {
-    // Window object used for blob analysis. Also assumes zero padding.
-    ac_window_2d_flag<pixInType, 3, 3, W_MAX, OTHER_WMODE> acWindObj(0);
-
-    ac_int<ac::nbits<H_MAX>::val, false> i = 0;
-    ac_int<ac::nbits<W_MAX>::val, false> j = 0;
-
-    bool inRead = true, eofOut = false;
-    
-    // The mechanism by which HYS_PROC_LOOP operates to read input values and flush out all outputs
-    // is very similar to the mechanism of GAUSS_PROC_LOOP. Please refer to the functioning of
-    // that, to get a better understanding of how the hysterisis thresholding loop works.
-    #pragma hls_pipeline_init_interval 1
-    HYS_PROC_LOOP: do {
-      pixInType NMS_op = inRead ? NMS_magOut.read() : pixInType(0);
-      bool sol = (j == 0);
-      bool sof = (i == 0) && sol;
-      bool eol = (j == widthIn - 1);
-      bool eof = (i == heightIn - 1) && eol;
-      acWindObj.write(NMS_op, sof, eof, sol, eol);
-      if (eof) {
-        inRead = false;
-      }
-      j++;
-      if (j == widthIn) {
-        j = 0;
-        i++;
-        if (i == heightIn) {
-          i = 0;
-        }
-      }
-
-      bool sofOut, solOut, eolOut;
-      acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
-      if (acWindObj.valid()) {
-        // The hysCalc() function calculates the hysteresis edge tracking output.
-        pixOutType hysOp = hysCalc(acWindObj, threshLowIn, threshUppIn);
-        // The hysteresis edge tracking output is the final output of the canny edge detector.
-        streamOut.write(hysOp);
-      }
-    } while (!eofOut); // Stop processing once the entire image output has been read.
+    AC_PERF_SCOPE("ac_canny::hysThresh");
+    // Window used for blob analysis. Also assumes zero padding.
+    hysThreshOut func(*this, threshLowIn, threshUppIn, streamOut);
+    ac_stencil_2d<pixInType, 3, 3, W_MAX, OTHER_WMODE, hysThreshOut> stencil(0);
+    stencil.run(NMS_magOut, widthIn, heightIn, nFramesIn, func);
   }
 
 // Carry out filtering with kernel and window values.
@@ -392,8 +379,8 @@ private:
 // Calculate NMS output.
   template <int IN_WMODE>
   void NMS_outCalc(
-    const ac_window_2d_flag<magOpType, 3, 3, W_MAX, IN_WMODE> &acWindMagObj,
-    const ac_window_2d_flag<angOpType, 2, 2, W_MAX, IN_WMODE> &acWindAngObj,
+    const ac_window_2d_flag<nmsPixType, 3, 3, W_MAX, IN_WMODE> &acWindObj,
+    const bool eol, // The center pixel is in the last column
     pixInType &NMS_magOut_temp
   ) {
     magOpType acWindMagOut[3][3], NMS_magOutFi;
@@ -402,12 +389,12 @@ private:
     NMS_OP_ROW_LOOP: for (int r = 0; r < 3; r++) {
       #pragma hls_unroll yes
       NMS_OP_COL_LOOP: for (int c = 0; c < 3; c++) {
-        acWindMagOut[r][c] = acWindMagObj(r - 1, c - 1);
+        acWindMagOut[r][c].set_slc(0, acWindObj(r - 1, c - 1).template slc<magOpType::width>(0));
       }
     }
-    // The window for the edge angle outputs is a 2x2 window. The top left value coincides with the angle output for the center of the
-    // 3x3 magnitude window.
-    angOpType acWindAngOut = acWindAngObj(-1, -1);
+    // The edge angle is only needed for the center pixel of the window. In the last column, the angle is
+    // the zero padding, as with the 2x2 angle window that was used before the angle was added to the window.
+    angOpType acWindAngOut = eol ? angOpType(0) : angOpType(acWindObj(0, 0).template slc<angOpType::width>(magOpType::width));
     // Carry out non-maximal suppression with the center pixel and two of the neighboring pixel values. The neighboring pixel values
     // are chosen based on the orientation of the edge.
     if (acWindAngOut == 0) {
@@ -463,10 +450,10 @@ private:
     return hysOp;
   }
 
-  ac_channel<gaussOpType> P1; // Interconnect channel with gaussian filter output.
-  ac_channel<magOpType>   P2; // Interconnect channel with magnitude output from edge detector
-  ac_channel<angOpType>   P3; // Interconnect channel with angle output from edge detector
-  ac_channel<pixInType>   P4; // Interconnect channel with NMS magnitude output
+  gaussChanType P1; // Interconnect channel with gaussian filter output.
+  magChanType   P2; // Interconnect channel with magnitude output from edge detector
+  angChanType   P3; // Interconnect channel with angle output from edge detector
+  nmsChanType   P4; // Interconnect channel with NMS magnitude output
 };
 
 #endif // #ifndef _INCLUDED_AC_CANNY_H_
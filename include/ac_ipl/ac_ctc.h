@@ -95,6 +95,8 @@
 #include <ac_fixed.h>
 #include <ac_ipl/ac_pixels.h>
 #include <ac_channel.h>
+#include <ac_resource.h>
+#include <ac_perf.h>
 #include <ac_math/ac_div.h>
 #include <mc_scverify.h>
 
@@ -129,6 +131,16 @@ public:
   typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
   typedef ac_int<ac::nbits<TEMP_MAX>::val, false> tempInType;
 
+  // Resources and latency of this configuration, see ac_resource.h. The pixel loop scales each color
+  // component with one multiplier; the white point ratios are divided once per frame.
+  enum {
+    LB_BITS = 0,
+    LB_RAMS = 0,
+    MULTIPLIERS = 3,
+    LATENCY_LINES = 0,
+    LATENCY_PIXELS = 0
+  };
+
 #pragma hls_pipeline_init_interval 1
 #pragma hls_design interface
   void CCS_BLOCK(run) (
@@ -138,6 +150,7 @@ public:
     const heightInType  heightIn,   // Input height
     const tempInType    tempIn      // Input color temperature
   ) {
+    AC_PERF_SCOPE("ac_ctc::run");
     AC_ASSERT(tempIn <= TEMP_MAX, "Input color temperature must not exceed maximum supported color temperature.");
     AC_ASSERT(tempIn >= tempLimitLow, "Input color temperature must not fall below minimum supported by design.");
 
@@ -178,6 +191,8 @@ public:
 
 #pragma hls_pipeline_init_interval 1
     CTC_LOOP: for (unsigned i = 0; i < H_MAX*W_MAX; i++) {
+      AC_PERF_ITER();
+      AC_PERF_READ(streamIn);
       IO_TYPE pixIn = streamIn.read(), pixOut;
       // Multiply input RGB values with the relevant ratios.
       pixOut.R = (ac_fixed<CDEPTH, CDEPTH, false, AC_RND, AC_SAT>(ratio.R*pixIn.R)).to_int();
@@ -197,6 +212,8 @@ public:
           maxRGBSum = RGBSum;
         }
       }
+      AC_PERF_VALID();
+      AC_PERF_WRITE(streamOut);
       streamOut.write(pixOut);
       if (i == widthIn*heightIn - 1) { break; }
     }
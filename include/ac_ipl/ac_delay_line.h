@@ -0,0 +1,192 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//***************************************************************************
+// File: ac_delay_line.h
+//
+// Description:
+//    The ac_delay_line block delays a raster stream by AC_LINES lines and
+//    AC_PIXELS pixels, i.e. by AC_LINES*widthIn + AC_PIXELS pixels. It is used
+//    to align a side stream with the output of a windowed kernel, e.g. to
+//    merge the ac_harris response with the original image: with the latency
+//    of the kernel as the delay, the i-th output of the delay line is written
+//    in the same iteration as the i-th output of the kernel, in a design where
+//    both blocks run concurrently at one pixel per clock.
+//
+//    The delay is implemented with a single circular buffer of
+//    AC_LINES*W_MAX + AC_PIXELS words (read before write at the same address),
+//    which is the number of pixels in flight, so no more memory is used than
+//    the alignment requires. After the last input pixel, the block flushes
+//    the buffer to the output.
+//
+// Usage:
+//    typedef ac_harris<ac_int<8, false>, ac_int<8, false>, 8, 1920, 1080> harrisType;
+//    ac_delay_line_for<harrisType, ac_int<8, false>, 1920, 1080>::type alignInst;
+//    // or: ac_delay_line<ac_int<8, false>, harrisType::LATENCY_LINES, harrisType::LATENCY_PIXELS, 1920, 1080>
+//
+//    alignInst.run(imageIn, imageAligned, widthIn, heightIn);
+//
+// Notes:
+//    The latency of the ac_ipl kernels and of the window classes is given by
+//    their LATENCY_LINES and LATENCY_PIXELS enums (see ac_resource.h). For
+//    ac_window_2d_flag_ppc, the delay in writes of AC_PPC-pixel groups is
+//    LATENCY_LINES*widthIn/AC_PPC + LATENCY_PIXELS/AC_PPC.
+//
+//    The delay is counted in pixels of the stream, not in clock cycles: the
+//    extra flushing iterations at the end of each line of
+//    ac_window_2d_flag_flush_support are not included, since they do not
+//    carry pixels.
+//
+// Revision History:
+//
+//***************************************************************************
+
+#ifndef _INCLUDED_AC_DELAY_LINE_H_
+#define _INCLUDED_AC_DELAY_LINE_H_
+
+#include <ac_int.h>
+#include <ac_channel.h>
+#include <ac_perf.h>
+#include <ac_resource.h>
+#include <mc_scverify.h>
+
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+// The design uses static_asserts, which are only supported by C++11 or later compiler standards.
+// The #error directive below informs the user if they're not using those standards.
+#if (defined(__GNUC__) && (__cplusplus < 201103L))
+#error Please use C++11 or a later standard for compilation.
+#endif
+#if (defined(_MSC_VER) && (_MSC_VER < 1920) && !defined(__EDG__))
+#error Please use Microsoft VS 2019 or a later standard for compilation.
+#endif
+
+// ac_delay_line template parameters:
+// T:         Pixel type
+// AC_LINES:  Delay in lines
+// AC_PIXELS: Delay in pixels, in addition to the lines
+// W_MAX:     Max. supported width
+// H_MAX:     Max. supported height
+template <class T, int AC_LINES, int AC_PIXELS, unsigned W_MAX, unsigned H_MAX>
+class ac_delay_line
+{
+  static_assert(AC_LINES >= 0 && AC_PIXELS >= 0, "The delay must not be negative.");
+
+public:
+  // Dimension types are bitwidth-constrained according to the max dimensions possible.
+  typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
+  typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
+
+  enum {
+    DEPTH_MAX = AC_LINES*W_MAX + AC_PIXELS // Delay for the max. width, in pixels
+  };
+
+  // Resources and latency of this configuration, see ac_resource.h.
+  enum {
+    LB_BITS = DEPTH_MAX*ac_resource_bits<T>::val,
+    LB_RAMS = DEPTH_MAX > 0 ? 1 : 0,
+    MULTIPLIERS = 0,
+    LATENCY_LINES = AC_LINES,
+    LATENCY_PIXELS = AC_PIXELS
+  };
+
+  ac_delay_line() { }
+
+  #pragma hls_pipeline_init_interval 1
+  #pragma hls_design interface
+  void CCS_BLOCK(run)(
+    ac_channel<T>      &streamIn,  // Input stream
+    ac_channel<T>      &streamOut, // Delayed output stream
+    const widthInType  widthIn,    // Input width
+    const heightInType heightIn    // Input height
+  ) {
+    AC_PERF_SCOPE("ac_delay_line::run");
+    #ifndef __SYNTHESIS__
+    assert(widthIn <= W_MAX && heightIn <= H_MAX);
+    #endif
+
+    const unsigned depth = AC_LINES*widthIn + AC_PIXELS;
+    const unsigned nPix = widthIn*heightIn;
+    ac_int<ac::nbits<DEPTH_MAX>::val, false> ptr = 0;
+
+    // Each iteration reads the oldest pixel from the buffer before the incoming pixel overwrites it. The
+    // first depth iterations only fill the buffer, the last depth iterations only flush it.
+    #pragma hls_pipeline_init_interval 1
+    DELAY_LOOP: for (unsigned i = 0; i < W_MAX*H_MAX + DEPTH_MAX; i++) {
+      AC_PERF_ITER();
+      T pixIn, pixOut;
+      if (i < nPix) {
+        AC_PERF_READ(streamIn);
+        pixIn = streamIn.read();
+      } else {
+        AC_PERF_FLUSH();
+      }
+
+      #pragma hls_waive CNS
+      if (DEPTH_MAX == 0) {
+        pixOut = pixIn;
+      } else {
+        pixOut = mem[ptr];
+        mem[ptr] = pixIn;
+        if (ptr == depth - 1) {
+          ptr = 0;
+        } else {
+          ptr++;
+        }
+      }
+
+      if (i >= depth) {
+        AC_PERF_VALID();
+        AC_PERF_WRITE(streamOut);
+        streamOut.write(pixOut);
+      } else {
+        AC_PERF_RAMPUP();
+      }
+
+      if (i == nPix + depth - 1) {
+        break;
+      }
+    }
+  }
+
+private:
+  T mem[DEPTH_MAX > 0 ? DEPTH_MAX : 1]; // Circular delay buffer
+};
+
+// Delay line that aligns a stream of type T with the output of KERNEL, e.g. an ac_ipl kernel or a window
+// class, from the LATENCY_LINES and LATENCY_PIXELS enums of KERNEL.
+template <class KERNEL, class T, unsigned W_MAX, unsigned H_MAX>
+struct ac_delay_line_for {
+  typedef ac_delay_line<T, KERNEL::LATENCY_LINES, KERNEL::LATENCY_PIXELS, W_MAX, H_MAX> type;
+};
+
+#endif
@@ -38,6 +38,8 @@
 #include <ac_int.h>
 #include <ac_fixed.h>
 #include <ac_window_2d_flag.h>
+#include <ac_stencil_2d.h>
+#include <ac_perf.h>
 #include <ac_channel.h>
 #include <mc_scverify.h>
 
@@ -50,6 +52,7 @@ public:
   typedef ac_int<CDEPTH, false> pixOutType;
   typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
   typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
+  typedef ac_int<16, false> nFramesInType;
 
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design interface
@@ -57,8 +60,10 @@ public:
     ac_channel<pixInType>  &streamIn,   // Pixel input stream
     ac_channel<pixOutType> &streamOut,  // Pixel output stream
     const widthInType      widthIn,     // Input width
-    const heightInType     heightIn    // Input height
+    const heightInType     heightIn,   // Input height
+    const nFramesInType    nFramesIn = 1 // Number of frames streamed back to back, all of widthIn x heightIn
   ) {
+    AC_PERF_SCOPE("ac_denoise_filter::run");
     const unsigned WN_SZ = 3;
 
     enum {
@@ -66,48 +71,36 @@ public:
       OTHER_WMODE = USE_SINGLEPORT ? AC_BOUNDARY | AC_SINGLEPORT : AC_BOUNDARY,
     };
 
-    // Declare window object to store input pixel values for gaussian filtering.
-    ac_window_2d_flag<pixInType, WN_SZ, WN_SZ, W_MAX, FILT_WMODE> acWindObj;
-
-    ac_int<ac::nbits<H_MAX>::val, false> i = 0;
-    ac_int<ac::nbits<W_MAX>::val, false> j = 0;
-
-    bool inRead = true, eofOut = false;
-
-    #pragma hls_pipeline_init_interval 1
-    GAUSS_PROC_LOOP: do {
-      pixInType pixIn = inRead ? streamIn.read() : pixInType(0);
-      // Calculate sof, eof, sol and eol based on image coordinates.
-      bool sol = (j == 0);
-      bool sof = (i == 0) && sol;
-      bool eol = (j == widthIn - 1);
-      bool eof = (i == heightIn - 1) && eol;
-      // Write input frame value to the window object.
-      acWindObj.write(pixIn, sof, eof, sol, eol);
-      if (eof) {
-        inRead = false; // Stop reading input channel after valid image region.
-      }
-      j++; // Update column counter after every pixel received.
-      if (j == widthIn) {
-        j = 0; // Max. possible j value = widthIn - 1.
-        i++; // Update row counter after every line received.
-        if (i == heightIn) {
-          i = 0; // Max. possible i value = heightIn - 1.
-        }
-      }
-
-      bool sofOut, solOut, eolOut;
-      acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
-      if (acWindObj.valid()) {
-        // If the window has ramped up, call medianFilt() to produce a filtered output.
-        pixOutType medianOp = medianFilt<pixInType> (acWindObj);
-        streamOut.write(medianOp);
-      }
-    } while (!eofOut); // Stop processing once the entire image output has been read.
+    // The stencil engine streams the input through a 3x3 window and calls medianOut for every valid window.
+    medianOut func(*this, streamOut);
+    ac_stencil_2d<pixInType, WN_SZ, WN_SZ, W_MAX, FILT_WMODE, medianOut> stencil;
+    stencil.run(streamIn, widthIn, heightIn, nFramesIn, func);
   }
 
   ac_denoise_filter() { }
 
+  // Resources and latency of this configuration, see ac_resource.h. The 3x3 median filter has no multipliers.
+  typedef ac_window_2d_flag<pixInType, 3, 3, W_MAX, USE_SINGLEPORT ? AC_MIRROR | AC_SINGLEPORT : AC_MIRROR> windType;
+  enum {
+    LB_BITS = windType::LB_BITS,
+    LB_RAMS = windType::LB_RAMS,
+    MULTIPLIERS = 0,
+    LATENCY_LINES = windType::LATENCY_LINES,
+    LATENCY_PIXELS = windType::LATENCY_PIXELS
+  };
+
+  // Stencil functor: writes the median of each window to the output stream.
+  struct medianOut {
+    ac_denoise_filter      &filt;
+    ac_channel<pixOutType> &streamOut;
+    medianOut(ac_denoise_filter &f, ac_channel<pixOutType> &o) : filt(f), streamOut(o) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      AC_PERF_WRITE(streamOut);
+      streamOut.write(filt.template medianFilt<pixInType>(acWindObj));
+    }
+  };
+
 // Carry out filtering with kernel and window values.
   template<class pixInType, int K_SZ, int IN_WMODE>
   pixOutType medianFilt(
@@ -89,6 +89,8 @@
 #include <ac_fixed.h>
 #include <ac_ipl/ac_pixels.h>
 #include <ac_channel.h>
+#include <ac_resource.h>
+#include <ac_perf.h>
 #include <mc_scverify.h>
 
 // The design uses static_asserts, which are only supported by C++11 or later compiler standards.
@@ -173,6 +175,17 @@ public:
   typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
   typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
 
+  // Resources and latency of this configuration, see ac_resource.h. The single line buffer holds the errors
+  // diffused to the next row, and each channel needs 3 multipliers for the windowCoeffs, one for nextPixCoeff
+  // and one for the maxValRatio scaling in quantize(). Every pixel is output in the same iteration it is read.
+  enum {
+    LB_BITS = W_MAX*ac_resource_bits<typename stDef::pSumType>::val,
+    LB_RAMS = 1,
+    MULTIPLIERS = 5*ac_resource_channels<IN_TYPE>::val,
+    LATENCY_LINES = 0,
+    LATENCY_PIXELS = 0
+  };
+
 #pragma hls_pipeline_init_interval 1
 #pragma hls_design interface
   void CCS_BLOCK(run) (
@@ -181,6 +194,7 @@ public:
     const widthInType    widthIn,    // Input width
     const heightInType   heightIn    // Input height
   ) {
+    AC_PERF_SCOPE("ac_dither::run");
     AC_ASSERT(use_dp || widthIn%2 == 0, "Input width must be even to allow usage of singleport memory.");
 
     // Cofficients used for diffusing the quantization error to the next row {3/16, 5/16, 1/16}
@@ -208,6 +222,7 @@ public:
       buff2XType buff2X;
 #pragma hls_pipeline_init_interval 1
       COL_LOOP: for (unsigned j = 0; j < W_MAX + 1; j++) {
+        AC_PERF_ITER();
         // An extra iteration is added at the end of COL_LOOP (i.e. when j == widthIn) to make sure that the last partial sum gets loaded to RAM.
         // The if-else condition below makes sure that this loading to RAM is the only thing that happens at the end of COL_LOOP.
         if (j != widthIn) {
@@ -238,6 +253,7 @@ public:
             }
           }
           // Read from input channel
+          AC_PERF_READ(streamIn);
           IN_TYPE pixIn = streamIn.read();
           // pixInter: stores the accumulation of diffused quantization errors from the pixel's neighbors.
           // quantError: Quantization error
@@ -250,6 +266,8 @@ public:
           // Initialize TUSER and TLAST for output pixel stream, if using RGB inputs/outputs.
           setPixFlags(pixIn, pixOut);
           // Write output to the streamOut port.
+          AC_PERF_VALID();
+          AC_PERF_WRITE(streamOut);
           streamOut.write(pixOut);
           // Update pSumPrevPix for the next pixel
           pSumPrevPix = quantError*nextPixCoeff;
@@ -275,15 +293,19 @@ public:
               }
             }
           }
-        } else if (!noRAMWrite) { // Extra iteration.
+        } else { // Extra iteration.
+          AC_PERF_FLUSH();
+          AC_PERF_RAMPUP();
+          if (!noRAMWrite) {
 #pragma hls_waive CNS
-          if (use_dp) {
+            if (use_dp) {
 #pragma hls_waive ABW
-            lineBuffer_DP[j - 1] = ShiftReg[1];
-          } else {
-            buff2X = buff2XConcat(pSumType(ShiftReg[0]), pSumType(ShiftReg[1]));
+              lineBuffer_DP[j - 1] = ShiftReg[1];
+            } else {
+              buff2X = buff2XConcat(pSumType(ShiftReg[0]), pSumType(ShiftReg[1]));
 #pragma hls_waive ABW
-            lineBuffer_SP[(widthIn >> 1) - 1] = buff2X;
+              lineBuffer_SP[(widthIn >> 1) - 1] = buff2X;
+            }
           }
         }
         if (j == widthIn) { break; } // Account for extra iteration added to complete writing to RAM.
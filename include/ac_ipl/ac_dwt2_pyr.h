@@ -54,8 +54,10 @@
 #include <ac_int.h>
 #include <ac_fixed.h>
 #include <ac_channel.h>
+#include <ac_dataflow.h>
 #include <ac_ipl/ac_pixels.h>
 #include <ac_window_2d_flag_flush_support.h>
+#include <ac_perf.h>
 
 // The design uses static_asserts, which are only supported by C++11 or later compiler standards.
 // The #error directive below informs the user if they're not using those standards.
@@ -189,17 +191,22 @@ public:
   // accumulator type.
   typedef typename st_def::acc_type acc_type;
   typedef out_struct<OUT_TYPE> OUT_ST_TYPE;
+  // Channel types. The input of level 1 is the top level input, the other channels are internal, i.e. bounded
+  // FIFOs in a threaded C simulation (see ac_dataflow.h).
+  typedef typename ac_dataflow_channel<IN_TYPE, (LEVEL_CNT > 0)>::type in_chan_type;
+  typedef typename ac_dataflow_channel<acc_type>::type inter_chan_type;
 
   ac_dwt2_pyr_block() { }
 
   #pragma hls_design interface
   void run (
-    ac_channel<IN_TYPE>  &stream_in, // Input stream.
-    ac_channel<acc_type> &stream_inter, // Interconnect output stream.
+    in_chan_type         &stream_in, // Input stream.
+    inter_chan_type      &stream_inter, // Interconnect output stream.
     ac_channel<OUT_ST_TYPE> &stream_out, // Stream that sends output to external consumer.
     const W_IN_TYPE w_in, // Dimension input: Level 1 input width.
     const H_IN_TYPE h_in // Dimension input: Level 1 input height.
   ) {
+    AC_PERF_SCOPE_N("ac_dwt2_pyr::level", LEVEL_CNT + 1);
     // The number of bits required for storing dimension inputs reduces by 1 at every level, due to halving of dimension values. Store
     // the dimension input values in variables which take this reduction into account.
     ac_int<ac::nbits<IN_W_MAX>::val, false> w_in_lev = (w_in >> LEVEL_CNT);
@@ -217,59 +224,87 @@ public:
     AC_ASSERT(h_in_lev > K_SZ, (char *)input_height_assert_msg.c_str());
     #endif
 
+    // The window is written with continuous lines: the last outputs of each line are produced while the next line is written,
+    // so that only the last line is followed by flushing iterations. With singleport linebuffers, each line of odd width still
+    // needs one extra write to complete the last memory word.
+    const bool sp_gap = USE_SP && (w_in_lev%2 != 0);
+    // Output row/column parity. Only the outputs in odd rows and columns are kept, to downsample by 2 across both dimensions.
+    bool row_odd = false;
+    bool col_odd = false;
+
     #pragma hls_pipeline_init_interval 1
-    ROW_LOOP: for (int i = 0; i < IN_H_MAX + K_SZ/2 - 1; i++) {
+    ROW_LOOP: for (int i = 0; i < IN_H_MAX + win_type::flushItRow + 1; i++) {
       bool eof_out; // EOF value for output frame. Since this value is used to break out of ROW_LOOP, we must declare it as a variable in ROW_LOOP and not COL_LOOP.
+      // The last row only holds the flushing iterations of the last line.
+      const bool flush_row = (i >= h_in_lev + win_type::flushItRow);
       #pragma hls_pipeline_init_interval 1
-      COL_LOOP: for (int j = 0; j < IN_W_MAX + K_SZ/2 - 1; j++) {
+      COL_LOOP: for (int j = 0; j < IN_W_MAX + 1; j++) {
+        AC_PERF_ITER();
         IN_TYPE pix_in;
         // Fill in streaming pixel inputs if we're in the image region.
         if (i < h_in_lev && j < w_in_lev) {
+          AC_PERF_READ(stream_in);
           pix_in = stream_in.read();
         } else {
+          AC_PERF_FLUSH();
           pix_in = 0.0;
         }
         // Set framing signals for input pixel based on loop iterator variables.
-        bool sol_in = (j == 0);
+        bool sol_in = !flush_row && (j == 0);
         bool sof_in = (i == 0 && sol_in);
-        bool eol_in = (j == w_in_lev - 1);
+        bool eol_in = !flush_row && (j == w_in_lev - 1);
         bool eof_in = (i == h_in_lev - 1 && eol_in);
         // Write value to window object/linebuffers.
         win_inst.write(pix_in, sof_in, eof_in, sol_in, eol_in);
         bool sof_out, sol_out, eol_out; // Framing signals for output.
         win_inst.readFlags(sof_out, eof_out, sol_out, eol_out);
 
-        if (win_inst.valid() && i%2 == int(K_SZ%4 != 0) && j%2 == int(K_SZ%4 != 0)) {
-          out_struct<acc_type> acc_var;
-          acc_var.out_ap = 0.0;
-          acc_var.out_ho = 0.0;
-          acc_var.out_ve = 0.0;
-          acc_var.out_di = 0.0;
-          // Window values are stored in temporary array to enable easy debugging via GDB.
-          IN_TYPE win_arr[K_SZ][K_SZ];
-          #pragma hls_unroll yes
-          DWT2_PYR_FILT_ROW: for (int r = 0; r < K_SZ; r++) {
+        if (win_inst.valid()) {
+          AC_PERF_VALID();
+          if (sol_out) {
+            col_odd = false;
+          }
+          if (row_odd && col_odd) {
+            out_struct<acc_type> acc_var;
+            acc_var.out_ap = 0.0;
+            acc_var.out_ho = 0.0;
+            acc_var.out_ve = 0.0;
+            acc_var.out_di = 0.0;
+            // Window values are stored in temporary array to enable easy debugging via GDB.
+            IN_TYPE win_arr[K_SZ][K_SZ];
             #pragma hls_unroll yes
-            DWT2_PYR_FILT_COL: for (int c = 0; c < K_SZ; c++) {
-              win_arr[r][c] = win_inst(r - K_SZ/2, c - K_SZ/2); // Fill in window values into temp. array.
-              kernel_values_type k_v_i;
-              acc_var.out_ap += win_arr[r][c]*kernel_type(k_v_i.k_ap[r][c]);
-              acc_var.out_ho += win_arr[r][c]*kernel_type(k_v_i.k_ho[r][c]);
-              acc_var.out_ve += win_arr[r][c]*kernel_type(k_v_i.k_ve[r][c]);
-              acc_var.out_di += win_arr[r][c]*kernel_type(k_v_i.k_di[r][c]);
+            DWT2_PYR_FILT_ROW: for (int r = 0; r < K_SZ; r++) {
+              #pragma hls_unroll yes
+              DWT2_PYR_FILT_COL: for (int c = 0; c < K_SZ; c++) {
+                win_arr[r][c] = win_inst(r - K_SZ/2, c - K_SZ/2); // Fill in window values into temp. array.
+                kernel_values_type k_v_i;
+                acc_var.out_ap += win_arr[r][c]*kernel_type(k_v_i.k_ap[r][c]);
+                acc_var.out_ho += win_arr[r][c]*kernel_type(k_v_i.k_ho[r][c]);
+                acc_var.out_ve += win_arr[r][c]*kernel_type(k_v_i.k_ve[r][c]);
+                acc_var.out_di += win_arr[r][c]*kernel_type(k_v_i.k_di[r][c]);
+              }
             }
+            AC_PERF_WRITE(stream_inter);
+            stream_inter.write(acc_var.out_ap);
+            OUT_ST_TYPE out_st_inst;
+            out_st_inst.out_ap = acc_var.out_ap;
+            out_st_inst.out_ho = acc_var.out_ho;
+            out_st_inst.out_ve = acc_var.out_ve;
+            out_st_inst.out_di = acc_var.out_di;
+            AC_PERF_WRITE(stream_out);
+            stream_out.write(out_st_inst);
+          }
+          col_odd = !col_odd;
+          if (eol_out) {
+            row_odd = !row_odd;
           }
-          stream_inter.write(acc_var.out_ap);
-          OUT_ST_TYPE out_st_inst;
-          out_st_inst.out_ap = acc_var.out_ap;
-          out_st_inst.out_ho = acc_var.out_ho;
-          out_st_inst.out_ve = acc_var.out_ve;
-          out_st_inst.out_di = acc_var.out_di;
-          stream_out.write(out_st_inst);
+        } else {
+          AC_PERF_RAMPUP();
         }
 
-        if (eol_out) {
-          break; // Break once we've reached rightmost pixel of output frame.
+        const bool last_it = flush_row ? (j == win_type::flushItCol - 1) : (j == w_in_lev - 1 + int(sp_gap));
+        if (eof_out || last_it) {
+          break; // Break once we've written the last iteration of the line, or reached the last pixel of the output frame.
         }
       }
       if (eof_out) {
@@ -291,6 +326,19 @@ private:
 
   typedef typename st_def::kernel_type kernel_type;  
   typedef ac_window_2d_flag_flush_support<IN_TYPE, K_SZ, K_SZ, AC_MAX(IN_W_MAX, K_SZ + 1), win_mode> win_type;
+
+public:
+  // Resources and latency of this level, see ac_resource.h. The latency is in pixels of the level input.
+  // Each window is filtered with the four subband kernels.
+  enum {
+    LB_BITS = win_type::LB_BITS,
+    LB_RAMS = win_type::LB_RAMS,
+    MULTIPLIERS = 4*K_SZ*K_SZ*ac_resource_channels<IN_TYPE>::val,
+    LATENCY_LINES = win_type::LATENCY_LINES,
+    LATENCY_PIXELS = win_type::LATENCY_PIXELS
+  };
+
+private:
   // Instantiate ac_window.
   win_type win_inst;
 };
@@ -337,47 +385,53 @@ public:
     const H_IN_TYPE h_in // Dimension input: height.
   ) {
     // Call all level blocks with the correct input/output variables.
-    ac_dwt2_pyr_block_inst_0.run(stream_in, stream_inter[0], stream_out[0], w_in, h_in);
+    AC_DATAFLOW_BEGIN(df);
+    AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_0.run(stream_in, stream_inter[0], stream_out[0], w_in, h_in));
     #pragma hls_waive CNS
     if (N_LEVELS >= 2) {
-      ac_dwt2_pyr_block_inst_1.run(stream_inter[0], stream_inter[1], stream_out[1], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_1.run(stream_inter[0], stream_inter[1], stream_out[1], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 3) {
-      ac_dwt2_pyr_block_inst_2.run(stream_inter[1], stream_inter[2], stream_out[2], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_2.run(stream_inter[1], stream_inter[2], stream_out[2], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 4) {
-      ac_dwt2_pyr_block_inst_3.run(stream_inter[2], stream_inter[3], stream_out[3], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_3.run(stream_inter[2], stream_inter[3], stream_out[3], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 5) {
-      ac_dwt2_pyr_block_inst_4.run(stream_inter[3], stream_inter[4], stream_out[4], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_4.run(stream_inter[3], stream_inter[4], stream_out[4], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 6) {
-      ac_dwt2_pyr_block_inst_5.run(stream_inter[4], stream_inter[5], stream_out[5], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_5.run(stream_inter[4], stream_inter[5], stream_out[5], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 7) {
-      ac_dwt2_pyr_block_inst_6.run(stream_inter[5], stream_inter[6], stream_out[6], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_6.run(stream_inter[5], stream_inter[6], stream_out[6], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 8) {
-      ac_dwt2_pyr_block_inst_7.run(stream_inter[6], stream_inter[7], stream_out[7], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_7.run(stream_inter[6], stream_inter[7], stream_out[7], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 9) {
-      ac_dwt2_pyr_block_inst_8.run(stream_inter[7], stream_inter[8], stream_out[8], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_8.run(stream_inter[7], stream_inter[8], stream_out[8], w_in, h_in));
     }
     #pragma hls_waive CNS
     if (N_LEVELS >= 10) {
-      ac_dwt2_pyr_block_inst_9.run(stream_inter[8], stream_inter[9], stream_out[9], w_in, h_in);
+      AC_DATAFLOW_CALL(df, ac_dwt2_pyr_block_inst_9.run(stream_inter[8], stream_inter[9], stream_out[9], w_in, h_in));
     }
-
+    AC_DATAFLOW_END(df);
   }
 
-  ac_dwt2_pyr() { }
+  ac_dwt2_pyr() {
+    // The interconnect output of the last level has no consumer. Without AC_DATAFLOW_THREADS, this expands to nothing.
+    for (int i = 0; i < 10; i++) {
+      AC_DATAFLOW_DISCARD(stream_inter[i], i == N_LEVELS - 1);
+    }
+  }
 
 private:
   // Declare max input and output widths for each level.
@@ -408,19 +462,63 @@ private:
 
   typedef typename dwt2_pyr_type_info<DWT_FN_VAL, OUT_TYPE, 0, ACC_W, ACC_I>::acc_type inter_type;
 
-  ac_dwt2_pyr_block<DWT_FN_VAL, IN_TYPE,    OUT_TYPE, W_IN_TYPE, H_IN_TYPE,  IN_W_MAX_0,  IN_H_MAX_0, 0, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_0;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_0, OUT_H_MAX_0, 1, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_1;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_1, OUT_H_MAX_1, 2, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_2;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_2, OUT_H_MAX_2, 3, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_3;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_3, OUT_H_MAX_3, 4, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_4;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_4, OUT_H_MAX_4, 5, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_5;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_5, OUT_H_MAX_5, 6, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_6;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_6, OUT_H_MAX_6, 7, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_7;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_7, OUT_H_MAX_7, 8, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_8;
-  ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_8, OUT_H_MAX_8, 9, ACC_W, ACC_I, USE_SP> ac_dwt2_pyr_block_inst_9;
+  // Level block types.
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, IN_TYPE,    OUT_TYPE, W_IN_TYPE, H_IN_TYPE,  IN_W_MAX_0,  IN_H_MAX_0, 0, ACC_W, ACC_I, USE_SP> block_type_0;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_0, OUT_H_MAX_0, 1, ACC_W, ACC_I, USE_SP> block_type_1;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_1, OUT_H_MAX_1, 2, ACC_W, ACC_I, USE_SP> block_type_2;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_2, OUT_H_MAX_2, 3, ACC_W, ACC_I, USE_SP> block_type_3;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_3, OUT_H_MAX_3, 4, ACC_W, ACC_I, USE_SP> block_type_4;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_4, OUT_H_MAX_4, 5, ACC_W, ACC_I, USE_SP> block_type_5;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_5, OUT_H_MAX_5, 6, ACC_W, ACC_I, USE_SP> block_type_6;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_6, OUT_H_MAX_6, 7, ACC_W, ACC_I, USE_SP> block_type_7;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_7, OUT_H_MAX_7, 8, ACC_W, ACC_I, USE_SP> block_type_8;
+  typedef ac_dwt2_pyr_block<DWT_FN_VAL, inter_type, OUT_TYPE, W_IN_TYPE, H_IN_TYPE, OUT_W_MAX_8, OUT_H_MAX_8, 9, ACC_W, ACC_I, USE_SP> block_type_9;
+
+public:
+  // Resources and latency of this configuration, see ac_resource.h. The line buffers and multipliers are
+  // summed over the N_LEVELS levels, and the latency is the one of the first level output.
+  enum {
+    LB_BITS =
+      block_type_0::LB_BITS +
+      (N_LEVELS >= 2 ? int(block_type_1::LB_BITS) : 0) +
+      (N_LEVELS >= 3 ? int(block_type_2::LB_BITS) : 0) +
+      (N_LEVELS >= 4 ? int(block_type_3::LB_BITS) : 0) +
+      (N_LEVELS >= 5 ? int(block_type_4::LB_BITS) : 0) +
+      (N_LEVELS >= 6 ? int(block_type_5::LB_BITS) : 0) +
+      (N_LEVELS >= 7 ? int(block_type_6::LB_BITS) : 0) +
+      (N_LEVELS >= 8 ? int(block_type_7::LB_BITS) : 0) +
+      (N_LEVELS >= 9 ? int(block_type_8::LB_BITS) : 0) +
+      (N_LEVELS >= 10 ? int(block_type_9::LB_BITS) : 0),
+    LB_RAMS =
+      block_type_0::LB_RAMS +
+      (N_LEVELS >= 2 ? int(block_type_1::LB_RAMS) : 0) +
+      (N_LEVELS >= 3 ? int(block_type_2::LB_RAMS) : 0) +
+      (N_LEVELS >= 4 ? int(block_type_3::LB_RAMS) : 0) +
+      (N_LEVELS >= 5 ? int(block_type_4::LB_RAMS) : 0) +
+      (N_LEVELS >= 6 ? int(block_type_5::LB_RAMS) : 0) +
+      (N_LEVELS >= 7 ? int(block_type_6::LB_RAMS) : 0) +
+      (N_LEVELS >= 8 ? int(block_type_7::LB_RAMS) : 0) +
+      (N_LEVELS >= 9 ? int(block_type_8::LB_RAMS) : 0) +
+      (N_LEVELS >= 10 ? int(block_type_9::LB_RAMS) : 0),
+    MULTIPLIERS = block_type_0::MULTIPLIERS + (N_LEVELS - 1)*block_type_1::MULTIPLIERS,
+    LATENCY_LINES = block_type_0::LATENCY_LINES,
+    LATENCY_PIXELS = block_type_0::LATENCY_PIXELS
+  };
+
+private:
+  block_type_0 ac_dwt2_pyr_block_inst_0;
+  block_type_1 ac_dwt2_pyr_block_inst_1;
+  block_type_2 ac_dwt2_pyr_block_inst_2;
+  block_type_3 ac_dwt2_pyr_block_inst_3;
+  block_type_4 ac_dwt2_pyr_block_inst_4;
+  block_type_5 ac_dwt2_pyr_block_inst_5;
+  block_type_6 ac_dwt2_pyr_block_inst_6;
+  block_type_7 ac_dwt2_pyr_block_inst_7;
+  block_type_8 ac_dwt2_pyr_block_inst_8;
+  block_type_9 ac_dwt2_pyr_block_inst_9;
 
   // Declare interconnect channels.
-  ac_channel<inter_type> stream_inter[10];
+  typename ac_dataflow_channel<inter_type>::type stream_inter[10];
 };
 
 #endif
@@ -35,7 +35,9 @@
 //    The ac_dwt_a block is designed to calculate the Discrete Wavelet
 //    Transform for a 1-Dimension signal. The design is a sample-based
 //    streaming design. The output is down sampled by two. The High-Pass and
-//    Low-Pass filters are implemented in Direct Form.
+//    Low-Pass filters are implemented as a polyphase filter bank
+//    (ac_fir_1d_polyphase), which only evaluates the outputs that are kept
+//    after down sampling.
 //
 //                                                               Resampled Output Signal
 //                                 +--------------------+                    |
@@ -80,6 +82,9 @@
 #include <ac_int.h>
 #include <ac_fixed.h>
 #include <ac_channel.h>
+#include <ac_resource.h>
+#include <ac_fir_1d_polyphase.h>
+#include <ac_perf.h>
 #include <mc_scverify.h>
 
 // The design uses static_asserts, which are only supported by C++11 or later compiler standards.
@@ -104,16 +109,26 @@ class ac_dwt_a
 public:
   typedef ac_fixed< BPS, BPS, 0 > inputType;
 
+  // Resources and latency of this configuration, see ac_resource.h. The signal is one dimensional: the
+  // "line buffer" is the low-pass output buffer, and the first high-pass output follows the second sample.
+  enum {
+    LB_BITS = ( LENGTH / 2 ) * BPS,
+    LB_RAMS = 1,
+    MULTIPLIERS = 2 * NFT,
+    LATENCY_LINES = 0,
+    LATENCY_PIXELS = 1
+  };
+
 
 public: // Constructor
   // Constant Filter Coefficients for Daubechies 4 Wavelet
+  // coeff[0] is the High-Pass filter and coeff[1] the Low-Pass filter.
   ac_dwt_a():
-    coeff_H{ -0.129409522551260, -0.224143868042013, 0.836516303737808, -0.482962913144534 },
-    coeff_L{  0.482962913144534,  0.836516303737808, 0.224143868042013, -0.129409522551260 } {
+    coeff{ { -0.129409522551260, -0.224143868042013, 0.836516303737808, -0.482962913144534 },
+           {  0.482962913144534,  0.836516303737808, 0.224143868042013, -0.129409522551260 } } {
     count = 0;
     buff_add = 0;
     ac::init_array< AC_VAL_DC >( buffer_lp, LENGTH / 2 );
-    ac::init_array< AC_VAL_0 >( shift_reg, NFT );
   }
 
 public: // Top level interface to the design
@@ -126,60 +141,37 @@ public: // Top level interface to the design
   void CCS_BLOCK( run )( ac_channel< inputType > &input,
                          ac_channel< inputType > &output,
                          ac_int< ac::nbits< LENGTH >::val, 0 > dyn_len ) {
-    multType mult_out_h[ NFT ];
-    multType mult_out_l[ NFT ];
-
+    // run() processes one sample per call, so the performance counters are recorded per sample (see ac_perf.h).
+    AC_PERF_SCOPE("ac_dwt_a::run");
+    AC_PERF_ITER();
     // Read input channel
+    AC_PERF_READ(input);
     inputType inp_tmp = input.read();
 
-    // Shift Register Loop
-#pragma hls_unroll yes
-    SHIFT_LOOP: for (int sft_itr = ( NFT - 1 ); sft_itr > 0; sft_itr--) {
-      shift_reg[ sft_itr ] = shift_reg[ sft_itr - 1 ];
-    }
-    shift_reg[0] = inp_tmp;
-    // Masking number is set according to given mask table for boundary
-    if (count<NFT) {
-      masking=((1<<(count+1))-1);
-    } else {
-      masking=15;
-    }
-
-    // Filter Multiplication Loop compute multiplication array.
-#pragma hls_unroll yes
-    MULT_LOOP: for ( int mul_itr = 0; mul_itr < NFT; mul_itr++ ) {
-      mult_out_h[ mul_itr ] = shift_reg[ mul_itr ] * coeff_H[ NFT - 1 - mul_itr ] * masking[ mul_itr ];
-      mult_out_l[ mul_itr ] = shift_reg[ mul_itr ] * coeff_L[ NFT - 1 - mul_itr ] * masking[ mul_itr ];
-    }
-    multType acc_h, acc_l;
-
-    // Reseting Accumulator register
-    acc_h = 0;
-    acc_l = 0;
-    // Accumulator loop generate adder trees for filters
-#pragma hls_unroll yes
-    ACC_LOOP: for ( int acc_itr = 0; acc_itr < NFT; acc_itr++ ) {
-      acc_h += mult_out_h[ acc_itr ];
-      acc_l += mult_out_l[ acc_itr ];
-    }
-
-    // Decimating odd samples results in
-    if (!( count[0] )) {
-      // Writing Output to Channel
-      output.write((inputType_rnd_sat)(acc_h));
+    // The polyphase filter bank only evaluates the outputs of the even samples, which are kept after
+    // decimation. The outputs of even sample 2m are complete once odd sample 2m+1 has been written.
+    // Clearing the delay line at the start of the signal masks the taps before the first sample.
+    multType fir_out[ 2 ];
+    if (fir.decimate(multType(inp_tmp), count == 0, coeff, fir_out)) {
+      AC_PERF_VALID();
+      // Writing High Pass filter output to Channel
+      AC_PERF_WRITE(output);
+      output.write((inputType_rnd_sat)(fir_out[ 0 ]));
       // Buffring Low Pass filter output
-      buffer_lp[buff_add] = (inputType_rnd_sat)(acc_l);
+      buffer_lp[buff_add] = (inputType_rnd_sat)(fir_out[ 1 ]);
       buff_add++;
       if (buff_add == ( dyn_len >>1 )) { buff_add = 0; }
-    } else {
       if (count == ( dyn_len - 1 )) {
         buff_add = 0;
         // Flushing LP Buffer to output channel
         LPF_LOOP: for ( int iter = 0; iter < LENGTH / 2; iter++ ) {
+          AC_PERF_WRITE(output);
           output.write(buffer_lp[ iter ]);
           if ( iter == ((dyn_len>>1) - 1)) { break; }
         }
       }
+    } else {
+      AC_PERF_RAMPUP();
     }
     count++;
     if (count == dyn_len) { count = 0; }
@@ -193,10 +185,9 @@ private: // Internal types
 private: // Data
   // Buffer for Decimated Low-Pass signal
   inputType buffer_lp[ LENGTH / 2 ];
-  multType shift_reg[ NFT ];
-  const multType coeff_H[ NFT ];
-  const multType coeff_L[ NFT ];
-  ac_int< NFT,0 > masking;
+  // Polyphase High-Pass/Low-Pass filter bank, decimating by two
+  ac_fir_1d_polyphase< multType, multType, multType, NFT, 2, 2 > fir;
+  const multType coeff[ 2 ][ NFT ];
   ac_int< ac::nbits< LENGTH + 1 >::val, 0 > count;
   ac_int< ac::nbits< LENGTH / 2 >::val, 0 > buff_add;
 
@@ -38,6 +38,7 @@
 //  If gamma_in is 1 (the default), the mapping is linear.
 //  If gamma_in is less than 1, the mapping is weighted toward higher (brighter) output values which can also be called gamma_in encoding or gamma_in compression.
 //  Conversely If gamma_in is greater than 1, the mapping is weighted toward lower (darker) output values or is called gamma_in decoding or gamma_in expansion.
+//  The intermediate values of each pixel are traced at level AC_TRACE_PIXEL in category AC_TRACE_CAT_GAMMA (see ac_trace.h).
 //*********************************************************************************************************
 
 #ifndef _INCLUDED_GAMMA_H_
@@ -45,6 +46,9 @@
 
 #include <ac_int.h>
 #include <ac_channel.h>
+#include <ac_resource.h>
+#include <ac_perf.h>
+#include <ac_trace.h>
 #include <stdio.h>
 
 #include <ac_math/ac_div.h>
@@ -70,6 +74,16 @@ Define the IO Types, and the gamma value type
   typedef PIX_TYP pix_rgb;
   typedef ac_fixed<gamma_in_width, gamma_in_integer_bits, false, AC_TRN> gamma_in_type;
 
+  // Resources and latency of this configuration, see ac_resource.h. ac_pow_pwl takes a piecewise-linear
+  // log2, a multiplication by gamma_in and a piecewise-linear pow2 for each color component.
+  enum {
+    LB_BITS = 0,
+    LB_RAMS = 0,
+    MULTIPLIERS = 3*ac_resource_channels<PIX_TYP>::val,
+    LATENCY_LINES = 0,
+    LATENCY_PIXELS = 0
+  };
+
   ac_gamma() {};
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design interface
@@ -78,12 +92,17 @@ Define the IO Types, and the gamma value type
     ac_channel<PIX_TYP> &ImageOut, // PixelOut
     gamma_in_type &gamma_in // Gamma value applied
   ) {
+    AC_PERF_SCOPE("ac_gamma::run");
     #ifndef __SYNTHESIS__
     while (ImageIn.available(1))
     #endif
     {
+      AC_PERF_ITER();
+      AC_PERF_READ(ImageIn);
       ImgIn=ImageIn.read(); // Pixel Read
       gamma_correction<255,CDEPTH>(ImgIn, ImgOut, gamma_in); // Gamma function call.
+      AC_PERF_VALID();
+      AC_PERF_WRITE(ImageOut);
       ImageOut.write(ImgOut); // Pixel Written oput
     }
   }
@@ -110,15 +129,12 @@ Gamma correction function for Grayscale image, speciallized based on the type of
     Sub = Shi-Pow; // adjust to accuracy.
     pixOut= Sub.to_int();
 
-    #ifndef DEBUG
-    cout << "==========================Debug========================"<< endl;
-    cout << "RGB_IN              " << pixIn << endl;
-    cout << "Divide by 255       " << Div << endl;
-    cout << "Pow to gamma_in "	   << Pow << endl;
-    cout << "Shift by 8       "    << Shi << endl;
-    cout << "Sub by 256 " 		   << Sub << endl;
-    cout << "RGB_OUT             " << pixOut << endl;
-    #endif
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "RGB_IN              " << pixIn);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Divide by 255       " << Div);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Pow to gamma_in     " << Pow);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Shift by 8          " << Shi);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Sub by 256          " << Sub);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "RGB_OUT             " << pixOut);
 
   };
 
@@ -164,15 +180,12 @@ Gamma correction function for RGB image, speciallized based on the type of the P
 
     // =========== = ====================== //
 
-    #ifdef DEBUG
-    cout << "==========================RGB Debug========================"<< endl;
-    cout << "RGB_IN              " << pixIn.R << " - " << pixIn.G << " - " << pixIn.B << endl;
-    cout << "Divide by 255       " << Div.R << " - " << Div.G << " - " << Div.B << endl;
-    cout << "Pow to gamma_in "	   << Pow.R << " - " << Pow.G << " - " << Pow.B << endl;
-    cout << "Shift by 8       "    << Shi.R << " - " << Shi.G << " - " << Shi.B << endl;
-    cout << "Sub by 256 " 		   << Sub.R << " - " << Sub.G << " - " << Sub.B << endl;
-    cout << "RGB_OUT _Design     " << pixOut.R << " - " << pixOut.G << " - " << pixOut.B << endl;
-    #endif
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "RGB_IN              " << pixIn.R << " - " << pixIn.G << " - " << pixIn.B);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Divide by 255       " << Div.R << " - " << Div.G << " - " << Div.B);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Pow to gamma_in     " << Pow.R << " - " << Pow.G << " - " << Pow.B);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Shift by 8          " << Shi.R << " - " << Shi.G << " - " << Shi.B);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "Sub by 256          " << Sub.R << " - " << Sub.G << " - " << Sub.B);
+    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "RGB_OUT             " << pixOut.R << " - " << pixOut.G << " - " << pixOut.B);
   }
 };
 
@@ -36,7 +36,12 @@
 #include <ac_fixed.h>
 #include <ac_ipl/ac_pixels.h>
 #include <ac_window_2d_flag.h>
+#include <ac_window_2d_flag_mc.h>
+#include <ac_stencil_2d.h>
 #include <ac_math/ac_reciprocal_pwl.h>
+#include <ac_perf.h>
+#include <ac_range.h>
+#include <ac_dataflow.h>
 #include <ac_channel.h>
 #include <mc_scverify.h>
 
@@ -86,6 +91,7 @@ public:
   typedef ac_int<2, false>                     componentType;
   typedef ac_int<3, false>                     epsilonType;
   typedef ac_int<14, false>                    thresholdType;
+  typedef ac_int<16, false>                    nFramesInType;
 
   #pragma hls_design interface
   void CCS_BLOCK(run) (
@@ -95,12 +101,20 @@ public:
     const heightInType   heightIn,    // Input height
     const componentType  component,    // Component type
     const epsilonType    epsilon,
-    const thresholdType  threshold
+    const thresholdType  threshold,
+    const nFramesInType  nFramesIn = 1 // Number of frames streamed back to back, all of widthIn x heightIn
   ) {
-    intensity(streamIn, P1, P2, widthIn, heightIn, component);
-    harrisresponse(P1, P2, P3, widthIn, heightIn, epsilon);
-    localmaxima(P3, P4, P5, widthIn, heightIn);
-    thresholding(P4, P5, streamOut, widthIn, heightIn, threshold);
+    AC_PERF_CHANNEL(P1, "ac_harris::P1");
+    AC_PERF_CHANNEL(P2, "ac_harris::P2");
+    AC_PERF_CHANNEL(P3, "ac_harris::P3");
+    AC_PERF_CHANNEL(P4, "ac_harris::P4");
+    AC_PERF_CHANNEL(P5, "ac_harris::P5");
+    AC_DATAFLOW_BEGIN(df);
+    AC_DATAFLOW_CALL(df, intensity(streamIn, P1, P2, widthIn, heightIn, component, nFramesIn));
+    AC_DATAFLOW_CALL(df, harrisresponse(P1, P2, P3, widthIn, heightIn, epsilon, nFramesIn));
+    AC_DATAFLOW_CALL(df, localmaxima(P3, P4, P5, widthIn, heightIn, nFramesIn));
+    AC_DATAFLOW_CALL(df, thresholding(P4, P5, streamOut, widthIn, heightIn, threshold, nFramesIn));
+    AC_DATAFLOW_END(df);
   }
 
   ac_harris() { }
@@ -112,17 +126,156 @@ private:
   typedef ac_fixed<NFRAC_BITS + (2*CDEPTH) + 4, (2*CDEPTH) + 4, true> gaussOpType; // Type for Gaussian filter output .
   typedef ac_fixed<NFRAC_BITS + (4*CDEPTH) + 10, (4*CDEPTH) + 10, true> HarrisResType;
 
+  // Internal channel types, bounded FIFOs in a threaded C simulation (see ac_dataflow.h).
+  typedef typename ac_dataflow_channel<IntensityType>::type intensityChanType;
+  typedef typename ac_dataflow_channel<HarrisResType>::type harrisChanType;
+
+  // Window types of the stages. The Ix*Ix, Iy*Iy and Ix*Iy planes (planes 0, 1 and 2) of the Gaussian
+  // window share the window control logic.
+  typedef ac_window_planes<IntensitySqType, 3>                                    gaussPixType;
+  typedef ac_window_2d_flag<CompType, EK_SZ, EK_SZ, W_MAX, INTERNAL_WMODE>        intensityWindType;
+  typedef ac_window_2d_flag<gaussPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE>    gaussWindType;
+  typedef ac_window_2d_flag<HarrisResType, EK_SZ, EK_SZ, W_MAX, INTERNAL_WMODE>   maximaWindType;
+
+public:
+  // Resources and latency of this configuration, see ac_resource.h. The multipliers are the two 3x3
+  // derivative masks, Ix*Iy, Ix*Ix and Iy*Iy, the three 5x5 Gaussian filters, the two products of the
+  // determinant, num*recden and the reciprocal PWL function.
+  enum {
+    LB_BITS = intensityWindType::LB_BITS + gaussWindType::LB_BITS + maximaWindType::LB_BITS,
+    LB_RAMS = intensityWindType::LB_RAMS + gaussWindType::LB_RAMS + maximaWindType::LB_RAMS,
+    MULTIPLIERS = 2*EK_SZ*EK_SZ + 3 + 3*GK_SZ*GK_SZ + 2 + 1 + 1,
+    LATENCY_LINES = intensityWindType::LATENCY_LINES + gaussWindType::LATENCY_LINES + maximaWindType::LATENCY_LINES,
+    LATENCY_PIXELS = intensityWindType::LATENCY_PIXELS + gaussWindType::LATENCY_PIXELS + maximaWindType::LATENCY_PIXELS
+  };
+
+private:
+
+  // Input sources of the intensity() and harrisresponse() stencils (see ac_stencil_2d.h).
+  // intensityIn extracts the selected component of the input pixels.
+  struct intensityIn : ac_stencil_2d_source {
+    ac_harris             &harris;
+    ac_channel<IN_TYPE>   &streamIn;
+    const componentType   component;
+    intensityIn(ac_harris &h, ac_channel<IN_TYPE> &i, const componentType c) : harris(h), streamIn(i), component(c) { }
+    CompType read() {
+      AC_PERF_READ(streamIn);
+      IN_TYPE pixIn = streamIn.read();
+      CompType comp;
+      harris.extractcomp(pixIn, comp, component);
+      return comp;
+    }
+  };
+
+  // responseIn reads Ix and Iy, and returns the Ix*Ix, Iy*Iy and Ix*Iy products.
+  struct responseIn : ac_stencil_2d_source {
+    intensityChanType &intensityx;
+    intensityChanType &intensityy;
+    responseIn(intensityChanType &x, intensityChanType &y) : intensityx(x), intensityy(y) { }
+    gaussPixType read() {
+      AC_PERF_READ(intensityx);
+      IntensityType   Ix  = intensityx.read();
+      AC_PERF_READ(intensityy);
+      IntensityType   Iy  = intensityy.read();
+      IntensitySqType Ixy = Ix*Iy;
+      IntensitySqType Ixx = Ix*Ix;
+      IntensitySqType Iyy = Iy*Iy;
+      AC_RANGE_TRACK("ac_harris::Ixy", Ixy);
+      AC_RANGE_TRACK("ac_harris::Ixx", Ixx);
+      AC_RANGE_TRACK("ac_harris::Iyy", Iyy);
+      gaussPixType pix;
+      pix[0] = Ixx;
+      pix[1] = Iyy;
+      pix[2] = Ixy;
+      return pix;
+    }
+  };
+
+  // Functors called by ac_stencil_2d for every valid window of the intensity(), harrisresponse() and
+  // localmaxima() stages. Each one computes the output of its stage and writes it to the stage output(s).
+  struct intensityOut {
+    ac_harris               &harris;
+    const ac_int<2, true>   (&Dx)[EK_SZ][EK_SZ];
+    const ac_int<2, true>   (&Dy)[EK_SZ][EK_SZ];
+    intensityChanType       &intensityx;
+    intensityChanType       &intensityy;
+    intensityOut(ac_harris &h, const ac_int<2, true> (&dx)[EK_SZ][EK_SZ], const ac_int<2, true> (&dy)[EK_SZ][EK_SZ], intensityChanType &x, intensityChanType &y)
+      : harris(h), Dx(dx), Dy(dy), intensityx(x), intensityy(y) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      // Calculate horizontal and vertical image intensities.
+      IntensityType   Ix  = harris.template windFilt<IntensityType> (Dx, acWindObj);
+      IntensityType   Iy  = harris.template windFilt<IntensityType> (Dy, acWindObj);
+      AC_RANGE_TRACK("ac_harris::Ix", Ix);
+      AC_RANGE_TRACK("ac_harris::Iy", Iy);
+      AC_PERF_WRITE(intensityx);
+      intensityx.write(Ix);
+      AC_PERF_WRITE(intensityy);
+      intensityy.write(Iy);
+    }
+  };
+
+  struct responseOut {
+    typedef ac_fixed<(2*CDEPTH) + 6, (2*CDEPTH) + 6, true> InterType;
+    ac_harris                         &harris;
+    const ac_fixed<NFRAC_BITS, 0, false> (&B)[GK_SZ][GK_SZ];
+    const epsilonType                 epsilon;
+    harrisChanType                    &harrisres;
+    responseOut(ac_harris &h, const ac_fixed<NFRAC_BITS, 0, false> (&b)[GK_SZ][GK_SZ], const epsilonType e, harrisChanType &o)
+      : harris(h), B(b), epsilon(e), harrisres(o) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      ac_fixed<48, 3, true> recden;
+      // Gaussian filtering of the Ix*Ix, Iy*Iy and Ix*Iy planes.
+      gaussOpType   gaussOpxx  = harris.template windFilt<gaussOpType> (B, acWindObj, 0);
+      gaussOpType   gaussOpyy  = harris.template windFilt<gaussOpType> (B, acWindObj, 1);
+      gaussOpType   gaussOpxy  = harris.template windFilt<gaussOpType> (B, acWindObj, 2);
+      AC_RANGE_TRACK("ac_harris::gaussOpxx", gaussOpxx);
+      AC_RANGE_TRACK("ac_harris::gaussOpyy", gaussOpyy);
+      AC_RANGE_TRACK("ac_harris::gaussOpxy", gaussOpxy);
+
+      // Calculating Harris Response which is given by 2*(det(A))/(trace(A)+epsilon)
+      HarrisResType num = 2*((gaussOpxx*gaussOpyy) - (gaussOpxy*gaussOpxy));
+      InterType     den = gaussOpxx + gaussOpyy + epsilon;
+      ac_math::ac_reciprocal_pwl(den, recden);
+      HarrisResType response = num * recden;
+      AC_RANGE_TRACK("ac_harris::num", num);
+      AC_RANGE_TRACK("ac_harris::den", den);
+      AC_RANGE_TRACK("ac_harris::recden", recden);
+      AC_RANGE_TRACK("ac_harris::response", response);
+      AC_PERF_WRITE(harrisres);
+      harrisres.write(response);
+    }
+  };
+
+  struct maximaOut {
+    ac_harris         &harris;
+    harrisChanType    &harrisrescopy;
+    harrisChanType    &maxima;
+    maximaOut(ac_harris &h, harrisChanType &c, harrisChanType &m) : harris(h), harrisrescopy(c), maxima(m) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      // Get the local maxima in the EK_SZxEK_SZ neighbourhood.
+      HarrisResType maxval = harris.template maximum<HarrisResType> (acWindObj);
+      AC_PERF_WRITE(maxima);
+      maxima.write(maxval);
+      AC_PERF_WRITE(harrisrescopy);
+      harrisrescopy.write(acWindObj(1 - (EK_SZ/2), 1 - (EK_SZ/2)));
+    }
+  };
+
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void intensity(
     ac_channel<IN_TYPE>          &streamIn,
-    ac_channel<IntensityType>    &intensityx,
-    ac_channel<IntensityType>    &intensityy,
+    intensityChanType            &intensityx,
+    intensityChanType            &intensityy,
     const widthInType            widthIn,
     const heightInType           heightIn,
-    const componentType          component
+    const componentType          component,
+    const nFramesInType          nFramesIn
   ) {
-    CompType comp;
+    AC_PERF_SCOPE("ac_harris::intensity");
     // Define derivative masks.
     const ac_int<2, true> Dx[EK_SZ][EK_SZ] = {
       {-1, 0, 1},
@@ -134,55 +287,26 @@ private:
       { 0,  0,  0},
       { 1,  1,  1}
     };
-    // Declare window object to store input pixel values. The window uses zero padding.
-    ac_window_2d_flag<CompType, EK_SZ, EK_SZ, W_MAX, INTERNAL_WMODE> acWindObj(0);
-
-    // Because the window needs (EK_SZ/2) input rows to ramp up and start producing outputs,
-    // extra cycles are provided for after all the inputs are read, to flush out
-    // all valid filter outputs. This is done by adding an extra (EK_SZ/2) iterations for
-    // INIT_ROW_LOOP and INIT_COL_LOOP.
-    #pragma hls_pipeline_init_interval 1
-    INT_ROW_LOOP: for (unsigned i = 0; i < H_MAX + (EK_SZ/2); i++) {
-      #pragma hls_pipeline_init_interval 1
-      INT_COL_LOOP: for (unsigned j = 0; j < W_MAX + (EK_SZ/2); j++) {
-        bool prod_output = (i != heightIn + (EK_SZ/2) - 1 && j < widthIn) || (i == heightIn + (EK_SZ/2) - 1);
-        if (i < heightIn && j < widthIn) {
-          IN_TYPE pixIn = streamIn.read();
-          extractcomp(pixIn, comp, component);
-          bool sol = (j == 0);
-          bool sof = (i == 0) && sol;
-          bool eol = (j == widthIn - 1);
-          bool eof = (i == heightIn - 1) && eol;
-          acWindObj.write(comp, sof, eof, sol, eol);
-          // acWindInObj.write(pixIn, sof, eof, sol, eol);
-        } else if (prod_output) {
-          bool sol = (j == 0);
-          bool eol = (j == widthIn - 1);
-          acWindObj.write(0.0, false, false, sol, eol);
-        }
-        if (acWindObj.valid() && prod_output) {
-          // Calculate horizontal and vertical image intensities.
-          IntensityType   Ix  = windFilt<IntensityType> (Dx, acWindObj);
-          IntensityType   Iy  = windFilt<IntensityType> (Dy, acWindObj);
-          intensityx.write(Ix);
-          intensityy.write(Iy);
-        }
-        if (j == widthIn + (EK_SZ/2) - 1) { break; }
-      }
-      if (i == heightIn + (EK_SZ/2) - 1) { break; }
-    }
+    // The stencil engine streams the selected component of the input through a 3x3 window, which uses
+    // zero padding, and calls intensityOut for every valid window.
+    intensityIn src(*this, streamIn, component);
+    intensityOut func(*this, Dx, Dy, intensityx, intensityy);
+    ac_stencil_2d<CompType, EK_SZ, EK_SZ, W_MAX, INTERNAL_WMODE, intensityOut> stencil(0);
+    stencil.run(src, widthIn, heightIn, nFramesIn, func);
   }
 
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void harrisresponse(
-    ac_channel<IntensityType>    &intensityx,
-    ac_channel<IntensityType>    &intensityy,
-    ac_channel<HarrisResType>    &harrisres,
+    intensityChanType            &intensityx,
+    intensityChanType            &intensityy,
+    harrisChanType               &harrisres,
     const widthInType            widthIn,
     const heightInType           heightIn,
-    const epsilonType            epsilon
+    const epsilonType            epsilon,
+    const nFramesInType          nFramesIn
   ) {
+    AC_PERF_SCOPE("ac_harris::harrisresponse");
     // 5x5 Gaussain filter
     const ac_fixed<NFRAC_BITS, 0, false> B[GK_SZ][GK_SZ] = {
       {0.00296902, 0.01330621, 0.02193823, 0.01330621, 0.00296902},
@@ -191,146 +315,73 @@ private:
       {0.01330621, 0.05963430, 0.09832033, 0.05963430, 0.01330621},
       {0.00296902, 0.01330621, 0.02193823, 0.01330621, 0.00296902}
     };
-    typedef ac_fixed<(2*CDEPTH) + 6, (2*CDEPTH) + 6, true> InterType;
-    ac_fixed<48, 3, true> recden;
-    // Declare window object,  to store pixel values for gaussian filtering.
-    // The window object uses zero padding by default.
-    ac_window_2d_flag<IntensitySqType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE>   acWindxxObj(0);
-    ac_window_2d_flag<IntensitySqType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE>   acWindyyObj(0);
-    ac_window_2d_flag<IntensitySqType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE>   acWindxyObj(0);
-
-    // The below windowing is similar to the one above. Please refer to the intensity function.
-    #pragma hls_pipeline_init_interval 1
-    HAR_ROW_LOOP: for (unsigned i = 0; i < H_MAX + (GK_SZ/2); i++) {
-      #pragma hls_pipeline_init_interval 1
-      HAR_COL_LOOP: for (unsigned j = 0; j < W_MAX + (GK_SZ/2); j++) {
-        // The extra GK_SZ/2 iterations for HAR_COL_LOOP only get used up at the very end, when flushing
-        // Gaussian outputs that are a result of zero padding to the bottom right of the image.
-        // The flag below ensures that the extra iterations are used up at the right time.
-        bool prod_output = (i != heightIn + (GK_SZ/2) - 1 && j < widthIn) || (i == heightIn + (GK_SZ/2) - 1);
-        if (i < heightIn && j < widthIn) { // Used to prevent excessive input channel reads.
-          IntensityType   Ix  = intensityx.read();
-          IntensityType   Iy  = intensityy.read();
-          IntensitySqType Ixy = Ix*Iy;
-          IntensitySqType Ixx = Ix*Ix;
-          IntensitySqType Iyy = Iy*Iy;
-          // Calculate sof, eof, sol and eol based on image coordinates.
-          bool sol = (j == 0);
-          bool sof = (i == 0) && sol;
-          bool eol = (j == widthIn - 1);
-          bool eof = (i == heightIn - 1) && eol;
-          // Write input frame value to the window object.
-          acWindxxObj.write(Ixx, sof, eof, sol, eol);
-          acWindyyObj.write(Iyy, sof, eof, sol, eol);
-          acWindxyObj.write(Ixy, sof, eof, sol, eol);
-        } else if (prod_output) {
-          // sof and eof values will both be false, because we're no longer
-          // receiving input pixel values.
-          bool sol = (j == 0);
-          bool eol = (j == widthIn - 1);
-          // The .write function in this case only serves to advance the pointers of the window object.
-          // The pixel value being passed to it (0) is a dummy value.
-          acWindxxObj.write(0, false, false, sol, eol);
-          acWindyyObj.write(0, false, false, sol, eol);
-          acWindxyObj.write(0, false, false, sol, eol);
-        }
-        if (acWindxxObj.valid() && acWindyyObj.valid() && acWindxyObj.valid() && prod_output) {
-          // If the window has ramped up, call windFilt() to produce a filtered output.
-          gaussOpType   gaussOpxx  = windFilt<gaussOpType> (B, acWindxxObj);
-          gaussOpType   gaussOpyy  = windFilt<gaussOpType> (B, acWindyyObj);
-          gaussOpType   gaussOpxy  = windFilt<gaussOpType> (B, acWindxyObj);
-
-          // Calculating Harris Response which is given by 2*(det(A))/(trace(A)+epsilon)
-          HarrisResType num = 2*((gaussOpxx*gaussOpyy) - (gaussOpxy*gaussOpxy));
-          InterType     den = gaussOpxx + gaussOpyy + epsilon;
-          ac_math::ac_reciprocal_pwl(den, recden);
-          HarrisResType response = num * recden;
-          harrisres.write(response);
-        }
-        if (j == widthIn + (GK_SZ/2) - 1) { break; }
-      }
-      if (i == heightIn + (GK_SZ/2) - 1) { break; }
-    }
+    // Stream the Ix*Ix, Iy*Iy and Ix*Iy products through one 5x5 window of gaussPixType, which uses zero
+    // padding, as in intensity().
+    responseIn src(intensityx, intensityy);
+    responseOut func(*this, B, epsilon, harrisres);
+    ac_stencil_2d<gaussPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE, responseOut> stencil(0);
+    stencil.run(src, widthIn, heightIn, nFramesIn, func);
   }
 
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void localmaxima(
-    ac_channel<HarrisResType>    &harrisres,
-    ac_channel<HarrisResType>    &harrisrescopy,
-    ac_channel<HarrisResType>    &maxima,
+    harrisChanType               &harrisres,
+    harrisChanType               &harrisrescopy,
+    harrisChanType               &maxima,
     const widthInType            widthIn,
-    const heightInType           heightIn
+    const heightInType           heightIn,
+    const nFramesInType          nFramesIn
   ) {
-    ac_window_2d_flag<HarrisResType, EK_SZ, EK_SZ, W_MAX, INTERNAL_WMODE> acWindObj(0.0);
-    // The below windowing is similar to the one above. Please refer to the intensity function.
-    #pragma hls_pipeline_init_interval 1
-    LOC_ROW_LOOP: for (unsigned i = 0; i < H_MAX + (EK_SZ/2); i++) {
-      #pragma hls_pipeline_init_interval 1
-      LOC_COL_LOOP: for (unsigned j = 0; j < W_MAX + (EK_SZ/2); j++) {
-        // The extra EK_SZ/2 iterations for LOC_COL_LOOP only get used up at the very end, when flushing
-        // outputs that are a result of zero padding to the bottom right of the image.
-        // The flag below ensures that the extra iterations are used up at the right time.
-        bool prod_output = (i != heightIn + (EK_SZ/2) - 1 && j < widthIn) || (i == heightIn + (EK_SZ/2) - 1);
-        if (i < heightIn && j < widthIn) { // Used to prevent excessive input channel reads.
-          HarrisResType response  = harrisres.read();
-
-          // Calculate sof, eof, sol and eol based on image coordinates.
-          bool sol = (j == 0);
-          bool sof = (i == 0) && sol;
-          bool eol = (j == widthIn - 1);
-          bool eof = (i == heightIn - 1) && eol;
-          // Write input frame value to the window object.
-          acWindObj.write(response, sof, eof, sol, eol);
-        } else if (prod_output) {
-          // sof and eof values will both be false, because we're no longer
-          // receiving input pixel values.
-          bool sol = (j == 0);
-          bool eol = (j == widthIn - 1);
-          // The .write function in this case only serves to advance the pointers of the window object.
-          // The pixel value being passed to it (0) is a dummy value.
-          acWindObj.write(0.0, false, false, sol, eol);
-        }
-        if (acWindObj.valid() && prod_output) {
-          // If the window has ramped up, call the maximum function to get the local maxima in the EK_SZxEK_SZ neighbourhood.
-          HarrisResType maxval = maximum<HarrisResType> (acWindObj);
-          maxima.write(maxval);
-          harrisrescopy.write(acWindObj(1 - (EK_SZ/2), 1 - (EK_SZ/2)));
-        }
-        if (j == widthIn + (EK_SZ/2) - 1) { break; }
-      }
-      if (i == heightIn + (EK_SZ/2) - 1) { break; }
-    }
+    AC_PERF_SCOPE("ac_harris::localmaxima");
+    // Stream the Harris response through a 3x3 window, which uses zero padding, as in intensity().
+    maximaOut func(*this, harrisrescopy, maxima);
+    ac_stencil_2d<HarrisResType, EK_SZ, EK_SZ, W_MAX, INTERNAL_WMODE, maximaOut> stencil(0.0);
+    stencil.run(harrisres, widthIn, heightIn, nFramesIn, func);
   }
 
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void thresholding(
-    ac_channel<HarrisResType>    &harrisrescopy,
-    ac_channel<HarrisResType>    &maxima,
+    harrisChanType               &harrisrescopy,
+    harrisChanType               &maxima,
     ac_channel<OUT_TYPE>         &streamOut,
     const widthInType            widthIn,
     const heightInType           heightIn,
-    const thresholdType          threshold
+    const thresholdType          threshold,
+    const nFramesInType          nFramesIn
   ) {
+    AC_PERF_SCOPE("ac_harris::thresholding");
+    // The frames are processed back to back in one loop, i and j are the row and column in the current frame.
+    heightInType  i = 0;
+    widthInType   j = 0;
+    nFramesInType f = 0;
     #pragma hls_pipeline_init_interval 1
-    THR_ROW_LOOP: for (unsigned i = 0; i < H_MAX; i++) {
-      #pragma hls_pipeline_init_interval 1
-      THR_COL_LOOP: for (unsigned j = 0; j < W_MAX; j++) {
+    THR_LOOP: do {
+      AC_PERF_ITER();
+      AC_PERF_READ(harrisrescopy);
+      HarrisResType response = harrisrescopy.read();
+      AC_PERF_READ(maxima);
+      HarrisResType maxval   = maxima.read();
+      OUT_TYPE output;
 
-        HarrisResType response = harrisrescopy.read();
-        HarrisResType maxval   = maxima.read();
-        OUT_TYPE output;
+      // If the response is equal to the local maxima and greater than threshold, corner is detected. If corner is detected, then call color
+      // function to color the corner points
+      OUT_TYPE outval = ((response.to_int()) == (maxval.to_int()) && response > threshold)?(color<OUT_TYPE>(output,i,j,widthIn)):(OUT_TYPE)0;
+      AC_PERF_VALID();
+      AC_PERF_WRITE(streamOut);
+      streamOut.write(outval);
 
-        // If the response is equal to the local maxima and greater than threshold, corner is detected. If corner is detected, then call color
-        // function to color the corner points
-        OUT_TYPE outval = ((response.to_int()) == (maxval.to_int()) && response > threshold)?(color<OUT_TYPE>(output,i,j,widthIn)):(OUT_TYPE)0;
-        streamOut.write(outval);
-
-        if (j == widthIn - 1) { break; }
+      j++;
+      if (j == widthIn) {
+        j = 0;
+        i++;
+        if (i == heightIn) {
+          i = 0;
+          f++;
+        }
       }
-      if (i == heightIn - 1) { break; }
-    }
+    } while (f != nFramesIn);
   }
 
   // Carry out filtering with the window values.
@@ -354,6 +405,26 @@ private:
     return filtOp;
   }
 
+  // Carry out filtering with the values of plane p of a window of ac_window_planes.
+  template<class filtOpType, class acWindType, class kType, int K_SZ>
+  filtOpType windFilt(
+    const kType (&kernel)[K_SZ][K_SZ],
+    const ac_window_2d_flag<ac_window_planes<acWindType, 3>, K_SZ, K_SZ, W_MAX, INTERNAL_WMODE> &acWindObj,
+    const int p
+  ) {
+    filtOpType filtOp = 0.0;
+    acWindType acWindOut[K_SZ][K_SZ];
+    #pragma hls_unroll yes
+    CONV_OP_ROW_LOOP: for (int r = 0; r < int(K_SZ); r++) {
+      #pragma hls_unroll yes
+      CONV_OP_COL_LOOP: for (int c = 0; c < int(K_SZ); c++) {
+        acWindOut[r][c] = acWindObj(r - (K_SZ/2), c - (K_SZ/2))[p];
+        filtOp += acWindOut[r][c]*kernel[r][c];
+      }
+    }
+    return filtOp;
+  }
+
   // Find the local maxima value.
   template<class maxType, class acWindType, int K_SZ>
   maxType maximum(
@@ -401,11 +472,11 @@ private:
     return outval;
   }
 
-  ac_channel<IntensityType>   P1; // Interconnect channel with intensity output in x direction
-  ac_channel<IntensityType>   P2; // Interconnect channel with intensity output in y direction
-  ac_channel<HarrisResType>   P3; // Interconnect channel with harris response
-  ac_channel<HarrisResType>   P4; // Interconnect channel with copy of harris response
-  ac_channel<HarrisResType>   P5; // Interconnect channel with local maxima values
+  intensityChanType P1; // Interconnect channel with intensity output in x direction
+  intensityChanType P2; // Interconnect channel with intensity output in y direction
+  harrisChanType    P3; // Interconnect channel with harris response
+  harrisChanType    P4; // Interconnect channel with copy of harris response
+  harrisChanType    P5; // Interconnect channel with local maxima values
 };
 
 #endif // #ifndef _INCLUDED_AC_HARRIS_H_
@@ -43,6 +43,8 @@
 #include <ac_fixed.h>
 #include <ac_ipl/ac_pixels.h>
 #include <ac_channel.h>
+#include <ac_resource.h>
+#include <ac_perf.h>
 #include <mc_scverify.h>
 
 // The design uses static_asserts, which are only supported by C++11 or later compiler standards.
@@ -112,6 +114,17 @@ public:
   typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
   typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
 
+  // Resources and latency of this configuration, see ac_resource.h. There are no line buffers: LB_BITS and
+  // LB_RAMS give the histogram count RAM instead, and the histogram is only output once the whole frame
+  // has been read.
+  enum {
+    LB_BITS = (1 << stDef::IN_CDEPTH)*ac_resource_bits<typename stDef::histArrType>::val,
+    LB_RAMS = 1,
+    MULTIPLIERS = 0,
+    LATENCY_LINES = H_MAX,
+    LATENCY_PIXELS = 0
+  };
+
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design interface
   void CCS_BLOCK(run) (
@@ -120,19 +133,26 @@ public:
     const widthInType    widthIn,    // Input width
     const heightInType   heightIn    // Input height
   ) {
+    AC_PERF_SCOPE("ac_imhist::run");
     // Initialize all histogram counts to zero.
     #pragma hls_pipeline_init_interval 1
     INIT_ARR: for (unsigned i = 0; i < OUT_SIZE; i++) {
+      AC_PERF_ITER();
+      AC_PERF_RAMPUP();
       histArr[i] = 0;
     }
 
     // Read all input pixel and update the histogram count array accordingly.
     #pragma hls_pipeline_init_interval 1
     READ_INPUT: for (unsigned i = 0; i < W_MAX*H_MAX + 1; i++) {
+      AC_PERF_ITER();
+      AC_PERF_RAMPUP();
       if (i != widthIn*heightIn) {
+        AC_PERF_READ(streamIn);
         IN_TYPE pixIn = streamIn.read();
         updateArr(pixIn);
       } else {
+        AC_PERF_FLUSH();
         IN_TYPE pixIn = 0; // Dummy value, not actually used.
         finalUpdateArr(pixIn);
         break;
@@ -142,10 +162,13 @@ public:
     // Read histogram count array and write the counts to the output channel.
     #pragma hls_pipeline_init_interval 1
     WRITE_OUTPUT: for (unsigned i = 0; i < OUT_SIZE; i++) {
+      AC_PERF_ITER();
       // IN_TYPE is a dummy input and will be optimized away. It is used to enable template-based overloading
       // of the writeOut function.
       IN_TYPE dummyIn;
       OUT_TYPE histOut = writeOut(dummyIn, i);
+      AC_PERF_VALID();
+      AC_PERF_WRITE(streamOut);
       streamOut.write(histOut);
     }
   }
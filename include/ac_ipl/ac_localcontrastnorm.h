@@ -34,9 +34,12 @@
 #include <ac_int.h>
 #include <ac_fixed.h>
 #include <ac_ipl/ac_pixels.h>
-#include <ac_window_2d_flag.h>
+#include <ac_window_2d_flag_mc.h>
+#include <ac_stencil_2d.h>
+#include <ac_perf.h>
 #include <ac_math/ac_reciprocal_pwl.h>
 #include <ac_math/ac_sqrt_pwl.h>
+#include <ac_dataflow.h>
 #include <ac_channel.h>
 #include <mc_scverify.h>
 
@@ -56,12 +59,43 @@ public:
   // Dimension types are bitwidth-constrained according to the max dimensions possible.
   typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
   typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
+  typedef ac_int<16, false> nFramesInType;
   // Define I/O types.
   typedef ac_ipl::RGB_1PPC<CDEPTH> pixInType;
   typedef ac_ipl::RGB_1PPC<CDEPTH> pixOutType;
 
   typedef ac_ipl::RGB_imd<ac_fixed<NFRAC_BITS + CDEPTH, CDEPTH, true> > pixgaussOpType; // Type for Gaussian filter output.
   typedef ac_ipl::RGB_imd<ac_fixed<(((3*NFRAC_BITS) + (2*CDEPTH))>>1), CDEPTH, false> > pixstddevType; // Type for standard deviation
+  // Internal channel type, a bounded FIFO in a threaded C simulation (see ac_dataflow.h).
+  typedef typename ac_dataflow_channel<pixgaussOpType>::type centeredChanType;
+  // The internal channel of run_axis() also carries the frame flags of the getcenteredimage() windows, so
+  // that getstddeviation() does not read ahead to find the end of each frame.
+  struct centeredFlagsType {
+    pixgaussOpType pix;
+    bool sof, eof, sol, eol;
+  };
+  typedef typename ac_dataflow_channel<centeredFlagsType>::type centeredFlagsChanType;
+
+  // Window types of the stages. The R, G and B planes (planes 0, 1 and 2) share the window control logic.
+  // The getstddeviation() window holds the square of the centered image, which is filtered, and the
+  // centered image, of which only the center pixel is used.
+  typedef ac_fixed<2*(NFRAC_BITS + CDEPTH), 2*CDEPTH, false> sqimgType;
+  typedef ac_fixed<NFRAC_BITS + CDEPTH, CDEPTH, true>        cenimgType;
+  typedef ac_window_planes<ac_int<CDEPTH, false>, 3>         inPixType;
+  typedef ac_window_pair<ac_window_planes<sqimgType, 3>, ac_window_planes<cenimgType, 3> > stdPixType;
+  typedef ac_window_2d_flag<inPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE>  inWindType;
+  typedef ac_window_2d_flag<stdPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> stdWindType;
+
+  // Resources and latency of this configuration, see ac_resource.h. The multipliers are, for each of the
+  // R, G and B planes, the two 9x9 Gaussian filters, the square of the centered image, the square root
+  // and reciprocal PWL functions and the normalization.
+  enum {
+    LB_BITS = inWindType::LB_BITS + stdWindType::LB_BITS,
+    LB_RAMS = inWindType::LB_RAMS + stdWindType::LB_RAMS,
+    MULTIPLIERS = 3*(2*GK_SZ*GK_SZ + 1 + 1 + 1 + 1),
+    LATENCY_LINES = inWindType::LATENCY_LINES + stdWindType::LATENCY_LINES,
+    LATENCY_PIXELS = inWindType::LATENCY_PIXELS + stdWindType::LATENCY_PIXELS
+  };
 
 public:
   ac_localcontrastnorm() {}
@@ -77,203 +111,294 @@ public:
 #ifndef __SYNTHESIS__
     AC_ASSERT(streamIn.debug_size() == widthIn*heightIn, "Please write all image input pixels to channel before calling the run function.");
 #endif
-    getcenteredimage(streamIn, P1, widthIn, heightIn);
-    getstddeviation(P1, streamOut, widthIn, heightIn); // P1: Centered image = Input - Gaissian Output. P3: Standard Deviation
+    AC_PERF_CHANNEL(P1, "ac_localcontrastnorm::P1");
+    AC_DATAFLOW_BEGIN(df);
+    AC_DATAFLOW_CALL(df, getcenteredimage(streamIn, P1, widthIn, heightIn));
+    AC_DATAFLOW_CALL(df, getstddeviation(P1, streamOut, widthIn, heightIn)); // P1: Centered image = Input - Gaissian Output. P3: Standard Deviation
+    AC_DATAFLOW_END(df);
   }
 
-private:
+  // Alternative top-level interface, without width and height ports: the frames are delimited by the TUSER
+  // (start of frame) and TLAST (end of line) flags of the input pixels, so the frame size can change from one
+  // call to the next (see ac_frame_flags.h). nFramesIn frames are streamed back to back; their heights can
+  // differ, their widths must be the same. The input is read one pixel ahead, so the last frame of the stream
+  // must be followed by a TUSER pixel, e.g. the first pixel of the next frame.
 #pragma hls_pipeline_init_interval 1
-#pragma hls_design
-  void getcenteredimage(
-    ac_channel<pixInType>      &streamIn,
-    ac_channel<pixgaussOpType> &centeredimage, // Gaussian filter output.
-    const widthInType          widthIn,
-    const heightInType         heightIn
+#pragma hls_design interface
+  void CCS_BLOCK(run_axis) (
+    ac_channel<pixInType>  &streamIn,      // Pixel input stream, with TUSER/TLAST flags
+    ac_channel<pixOutType> &streamOut,     // Pixel output stream
+    const nFramesInType    nFramesIn = 1   // Number of frames streamed back to back
   ) {
-    typedef ac_int<CDEPTH, false> InType;
-    pixgaussOpType gaussOp;
-    pixgaussOpType centeredimageval;
-
-    // Declare window object to store input pixel values for gaussian filtering.
-    // The window object uses zero padding by default.
-    ac_window_2d_flag<InType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> acWindRObj(0);
-    ac_window_2d_flag<InType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> acWindGObj(0);
-    ac_window_2d_flag<InType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> acWindBObj(0);
-
-    // Because the window needs (GK_SZ/2) input rows to ramp up and start producing outputs,
-    // extra cycles are provided for after all the inputs are read, to flush out
-    // all valid filter outputs. This is done by adding an extra (GK_SZ/2) iterations for
-    // GAUSS_ROW_LOOP and GAUSS_COL_LOOP.
-#pragma hls_pipeline_init_interval 1
-    IN_ROW_LOOP: for (unsigned i = 0; i < H_MAX + (GK_SZ/2); i++) {
-#pragma hls_pipeline_init_interval 1
-      IN_COL_LOOP: for (unsigned j = 0; j < W_MAX + (GK_SZ/2); j++) {
-        // The extra GK_SZ/2 iterations for IN_COL_LOOP only get used up at the very end, when flushing
-        // Gaussian outputs that are a result of zero padding to the bottom right of the image.
-        // The flag below ensures that the extra iterations are used up at the right time.
-        bool prod_output = (i != heightIn + (GK_SZ/2) - 1 && j < widthIn) || (i == heightIn + (GK_SZ/2) - 1);
-        if (i < heightIn && j < widthIn) { // Used to prevent excessive input channel reads.
-          pixInType pixIn = streamIn.read();
-          // Calculate sof, eof, sol and eol based on image coordinates.
-          bool sol = (j == 0);
-          bool sof = (i == 0) && sol;
-          bool eol = (j == widthIn - 1);
-          bool eof = (i == heightIn - 1) && eol;
-          // Write input frame value to the window object.
-          acWindRObj.write(pixIn.R, sof, eof, sol, eol);
-          acWindGObj.write(pixIn.G, sof, eof, sol, eol);
-          acWindBObj.write(pixIn.B, sof, eof, sol, eol);
-        } else if (prod_output) {
-          // sof and eof values will both be false, because we're no longer
-          // receiving input pixel values.
-          bool sol = (j == 0);
-          bool eol = (j == widthIn - 1);
-          // The .write function in thie case only serves to advance the pointers of the window object.
-          // The pixel value being passed to it (0) is a dummy value.
-          acWindRObj.write(0, false, false, sol, eol);
-          acWindGObj.write(0, false, false, sol, eol);
-          acWindBObj.write(0, false, false, sol, eol);
+    AC_PERF_CHANNEL(P1F, "ac_localcontrastnorm::P1F");
+    AC_DATAFLOW_BEGIN(df);
+    AC_DATAFLOW_CALL(df, getcenteredimage_axis(streamIn, P1F, nFramesIn));
+    AC_DATAFLOW_CALL(df, getstddeviation_axis(P1F, streamOut, nFramesIn));
+    AC_DATAFLOW_END(df);
+  }
+
+private:
+  typedef ac_fixed<(3*NFRAC_BITS) + (2*CDEPTH), 2*CDEPTH, false> varType; // Type for variance
+  typedef ac_fixed<(((3*NFRAC_BITS) + (2*CDEPTH))>>1), CDEPTH, false> stddevType;
+
+  // Input sources of the getcenteredimage() and getstddeviation() stencils (see ac_stencil_2d.h).
+  // centeredIn splits the input pixels into their R, G and B planes.
+  static inPixType inPix(const pixInType &pixIn) {
+    inPixType pixPlanes;
+    pixPlanes[0] = pixIn.R;
+    pixPlanes[1] = pixIn.G;
+    pixPlanes[2] = pixIn.B;
+    return pixPlanes;
+  }
+
+  struct centeredIn : ac_stencil_2d_source {
+    ac_channel<pixInType> &streamIn;
+    centeredIn(ac_channel<pixInType> &i) : streamIn(i) { }
+    inPixType read() {
+      AC_PERF_READ(streamIn);
+      return inPix(streamIn.read());
+    }
+  };
+
+  // stddevIn returns the square of the centered image along with the centered image.
+  static stdPixType stdPix(const pixgaussOpType &centerimgval) {
+    stdPixType pix;
+    pix.first[0] = centerimgval.R * centerimgval.R;
+    pix.first[1] = centerimgval.G * centerimgval.G;
+    pix.first[2] = centerimgval.B * centerimgval.B;
+    pix.second[0] = centerimgval.R;
+    pix.second[1] = centerimgval.G;
+    pix.second[2] = centerimgval.B;
+    return pix;
+  }
+
+  struct stddevIn : ac_stencil_2d_source {
+    centeredChanType &centeredimage;
+    stddevIn(centeredChanType &c) : centeredimage(c) { }
+    stdPixType read() {
+      AC_PERF_READ(centeredimage);
+      return stdPix(centeredimage.read());
+    }
+  };
+
+  // Flag sources of the run_axis() stencils. centeredFlagsIn decodes the TUSER/TLAST flags of the input
+  // pixels with the frameIn decoder, which holds the lookahead pixel across calls. stddevFlagsIn takes the
+  // flags from the internal channel.
+  struct centeredFlagsIn : ac_stencil_2d_flag_source {
+    ac_channel<pixInType>    &streamIn;
+    ac_frame_flags<pixInType> &frameIn;
+    centeredFlagsIn(ac_channel<pixInType> &i, ac_frame_flags<pixInType> &f) : streamIn(i), frameIn(f) { }
+    void read(inPixType &pix, bool &sof, bool &eof, bool &sol, bool &eol) {
+      AC_PERF_READ(streamIn);
+      pixInType pixIn;
+      frameIn.read(streamIn, pixIn, sof, eof, sol, eol);
+      pix = inPix(pixIn);
+    }
+  };
+
+  struct stddevFlagsIn : ac_stencil_2d_flag_source {
+    centeredFlagsChanType &centeredimage;
+    stddevFlagsIn(centeredFlagsChanType &c) : centeredimage(c) { }
+    void read(stdPixType &pix, bool &sof, bool &eof, bool &sol, bool &eol) {
+      AC_PERF_READ(centeredimage);
+      centeredFlagsType centerimgval = centeredimage.read();
+      pix = stdPix(centerimgval.pix);
+      sof = centerimgval.sof;
+      eof = centerimgval.eof;
+      sol = centerimgval.sol;
+      eol = centerimgval.eol;
+    }
+  };
+
+  // Functors called by ac_stencil_2d for every valid window of getcenteredimage() and getstddeviation().
+  // centeredOut writes to the internal channel of run() or run_axis().
+  static void writeCentered(centeredChanType &centeredimage, const pixgaussOpType &pix, bool, bool, bool, bool) {
+    centeredimage.write(pix);
+  }
+
+  static void writeCentered(centeredFlagsChanType &centeredimage, const pixgaussOpType &pix, bool sof, bool eof, bool sol, bool eol) {
+    centeredFlagsType pixFlags;
+    pixFlags.pix = pix;
+    pixFlags.sof = sof;
+    pixFlags.eof = eof;
+    pixFlags.sol = sol;
+    pixFlags.eol = eol;
+    centeredimage.write(pixFlags);
+  }
+
+  template<class CHAN_TYPE>
+  struct centeredOut {
+    ac_localcontrastnorm &lcn;
+    CHAN_TYPE            &centeredimage;
+    centeredOut(ac_localcontrastnorm &l, CHAN_TYPE &c) : lcn(l), centeredimage(c) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      ac_int<CDEPTH, false> acWindOut[3][GK_SZ][GK_SZ];
+#pragma hls_unroll yes
+      for (int r = 0; r < int(GK_SZ); r++) {
+#pragma hls_unroll yes
+        for (int c = 0; c < int(GK_SZ); c++) {
+#pragma hls_unroll yes
+          for (int p = 0; p < 3; p++) { acWindOut[p][r][c] = acWindObj(r - (GK_SZ/2), c - (GK_SZ/2))[p]; }
         }
-        if (acWindRObj.valid() && acWindGObj.valid() && acWindBObj.valid() && prod_output) {
-          // If the window has ramped up, call gaussFilt() to produce a filtered output.
-          gaussOp   = gaussFilt<pixgaussOpType> (acWindRObj, acWindGObj, acWindBObj);
+      }
+      pixgaussOpType gaussOp = lcn.template gaussFilt<pixgaussOpType>(acWindOut);
 
-          // Get the centered image which is basically the image input - gaussian filtered output of input image
-          centeredimageval.R = acWindRObj(4 - (GK_SZ/2), 4 - (GK_SZ/2)) - gaussOp.R;
-          centeredimageval.G = acWindGObj(4 - (GK_SZ/2), 4 - (GK_SZ/2)) - gaussOp.G;
-          centeredimageval.B = acWindBObj(4 - (GK_SZ/2), 4 - (GK_SZ/2)) - gaussOp.B;
+      // Get the centered image which is basically the image input - gaussian filtered output of input image
+      pixgaussOpType centeredimageval;
+      centeredimageval.R = acWindOut[0][GK_SZ/2][GK_SZ/2] - gaussOp.R;
+      centeredimageval.G = acWindOut[1][GK_SZ/2][GK_SZ/2] - gaussOp.G;
+      centeredimageval.B = acWindOut[2][GK_SZ/2][GK_SZ/2] - gaussOp.B;
 
-          centeredimage.write(centeredimageval);
+      AC_PERF_WRITE(centeredimage);
+      writeCentered(centeredimage, centeredimageval, sof, eof, sol, eol);
+    }
+  };
+
+  struct stddevOut {
+    ac_localcontrastnorm   &lcn;
+    ac_channel<pixOutType> &streamOut;
+    stddevOut(ac_localcontrastnorm &l, ac_channel<pixOutType> &o) : lcn(l), streamOut(o) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      typedef ac_ipl::RGB_imd<varType> pixvarType;
+      sqimgType acWindOut[3][GK_SZ][GK_SZ];
+#pragma hls_unroll yes
+      for (int r = 0; r < int(GK_SZ); r++) {
+#pragma hls_unroll yes
+        for (int c = 0; c < int(GK_SZ); c++) {
+#pragma hls_unroll yes
+          for (int p = 0; p < 3; p++) { acWindOut[p][r][c] = acWindObj(r - (GK_SZ/2), c - (GK_SZ/2)).first[p]; }
         }
-        if (j == widthIn + (GK_SZ/2) - 1) { break; }
       }
-      if (i == heightIn + (GK_SZ/2) - 1) { break; }
+      // variance is convolution of the square of centered image and the gaussian filter
+      pixvarType variance = lcn.template gaussFilt<pixvarType>(acWindOut);
+
+      // The standard deviation of the image is the square root of the variance
+      pixstddevType stddev;
+      stddev.R = ac_math::ac_sqrt_pwl<stddevType>(variance.R);
+      stddev.G = ac_math::ac_sqrt_pwl<stddevType>(variance.G);
+      stddev.B = ac_math::ac_sqrt_pwl<stddevType>(variance.B);
+
+      pixgaussOpType copycenterimgval;
+      copycenterimgval.R = acWindObj(0, 0).second[0];
+      copycenterimgval.G = acWindObj(0, 0).second[1];
+      copycenterimgval.B = acWindObj(0, 0).second[2];
+
+      stddev.R = (stddev.R>1e-4)?stddev.R:1e-4;
+      stddev.G = (stddev.G>1e-4)?stddev.G:1e-4;
+      stddev.B = (stddev.B>1e-4)?stddev.B:1e-4;
+
+      ac_ipl::RGB_imd<ac_fixed<19, 3, false> > recstddev;
+      ac_math::ac_reciprocal_pwl(stddev.R, recstddev.R);
+      ac_math::ac_reciprocal_pwl(stddev.G, recstddev.G);
+      ac_math::ac_reciprocal_pwl(stddev.B, recstddev.B);
+
+      // The output is the centered image divided by the standard deviation
+      ac_ipl::RGB_imd<ac_fixed<NFRAC_BITS + CDEPTH + 19, CDEPTH + 3, false> > intout = copycenterimgval * recstddev;
+
+      // Converting form fixed point output to integer output
+      pixOutType lcnint;
+      lcnint.R = intout.R.to_int();
+      lcnint.G = intout.G.to_int();
+      lcnint.B = intout.B.to_int();
+      // TUSER and TLAST of the output pixel stream mark the start of the frame and the end of each line.
+      lcnint.TUSER = sof;
+      lcnint.TLAST = eol;
+      AC_PERF_WRITE(streamOut);
+      streamOut.write(lcnint);
     }
+  };
+
+#pragma hls_pipeline_init_interval 1
+#pragma hls_design
+  void getcenteredimage(
+    ac_channel<pixInType>      &streamIn,
+    centeredChanType           &centeredimage, // Gaussian filter output.
+    const widthInType          widthIn,
+    const heightInType         heightIn
+  ) {
+    AC_PERF_SCOPE("ac_localcontrastnorm::getcenteredimage");
+    // The stencil engine streams the R, G and B planes of the input through a window with shared control
+    // logic, which uses zero padding, and calls centeredOut for every valid window.
+    centeredIn src(streamIn);
+    centeredOut<centeredChanType> func(*this, centeredimage);
+    ac_stencil_2d<inPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE, centeredOut<centeredChanType> > stencil(0);
+    stencil.run(src, widthIn, heightIn, func);
 
 #ifndef __SYNTHESIS__
     AC_ASSERT(streamIn.debug_size() == 0, "Input to gaussian filter block not completely consumed.");
+#if !AC_DATAFLOW_ON
+    // With concurrent blocks, getstddeviation() has already read part of the output.
     AC_ASSERT(centeredimage.debug_size() == widthIn*heightIn, "Incorrect output size for gaussian filter block.");
+#endif
 #endif
   }
 
 #pragma hls_pipeline_init_interval 1
 #pragma hls_design
   void getstddeviation(
-    ac_channel<pixgaussOpType> &centeredimage,
+    centeredChanType           &centeredimage,
     ac_channel<pixOutType>     &streamOut,
     const widthInType          widthIn,
     const heightInType         heightIn
   ) {
-    pixstddevType stddev;
-
-    typedef ac_fixed<NFRAC_BITS + CDEPTH, CDEPTH, true> gaussOpType;
-    typedef ac_ipl::RGB_imd<ac_fixed<2*(NFRAC_BITS + CDEPTH), 2*CDEPTH, false> > pixsqimgType;
-    typedef ac_fixed<2*(NFRAC_BITS + CDEPTH), 2*CDEPTH, false> sqimgType;
-    typedef ac_ipl::RGB_imd<ac_fixed<(3*NFRAC_BITS) + (2*CDEPTH), 2*CDEPTH, false> > pixvarType; // Type for variance
-    typedef ac_fixed<(3*NFRAC_BITS) + (2*CDEPTH), 2*CDEPTH, false> varType;
-    typedef ac_fixed<(((3*NFRAC_BITS) + (2*CDEPTH))>>1), CDEPTH, false> stddevType;
-    pixvarType variance;
-    pixgaussOpType copycenterimgval;
-	
-		ac_ipl::RGB_imd<ac_fixed<19, 3, false> > recstddev;
-    //Fixed point datatype of the output
-    ac_ipl::RGB_imd<ac_fixed<NFRAC_BITS + CDEPTH + 19, CDEPTH + 3, false> > intout;
-
-    pixOutType lcnint;
-
-    // Declare window object to store input pixel values for gaussian filtering.
-    // The window object uses zero padding by default.
-    ac_window_2d_flag<sqimgType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> acWindRObj(0);
-    ac_window_2d_flag<sqimgType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> acWindGObj(0);
-    ac_window_2d_flag<sqimgType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> acWindBObj(0);
-
-    ac_window_2d_flag<gaussOpType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> cenWindRObj(0);
-    ac_window_2d_flag<gaussOpType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> cenWindGObj(0);
-    ac_window_2d_flag<gaussOpType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE> cenWindBObj(0);
-
-    // The below windowing is similar to the one above. Please refer to the above function.
-#pragma hls_pipeline_init_interval 1
-    CEN_ROW_LOOP: for (unsigned i = 0; i < H_MAX + (GK_SZ/2); i++) {
-#pragma hls_pipeline_init_interval 1
-      CEN_COL_LOOP: for (unsigned j = 0; j < W_MAX + (GK_SZ/2); j++) {
-        bool prod_output = (i != heightIn + (GK_SZ/2) - 1 && j < widthIn) || (i == heightIn + (GK_SZ/2) - 1);
-        if (i < heightIn && j < widthIn) { // Used to prevent excessive input channel reads.
-          pixgaussOpType centerimgval = centeredimage.read();
-          pixsqimgType sqimgval = centerimgval * centerimgval;
-          bool sol = (j == 0);
-          bool sof = (i == 0) && sol;
-          bool eol = (j == widthIn - 1);
-          bool eof = (i == heightIn - 1) && eol;
-          // Write input frame value to the window object.
-          acWindRObj.write(sqimgval.R, sof, eof, sol, eol);
-          acWindGObj.write(sqimgval.G, sof, eof, sol, eol);
-          acWindBObj.write(sqimgval.B, sof, eof, sol, eol);
-
-          cenWindRObj.write(centerimgval.R, sof, eof, sol, eol);
-          cenWindGObj.write(centerimgval.G, sof, eof, sol, eol);
-          cenWindBObj.write(centerimgval.B, sof, eof, sol, eol);
-
-        } else if (prod_output) {
-          bool sol = (j == 0);
-          bool eol = (j == widthIn - 1);
-          acWindRObj.write(0, false, false, sol, eol);
-          acWindGObj.write(0, false, false, sol, eol);
-          acWindBObj.write(0, false, false, sol, eol);
-
-          cenWindRObj.write(0, false, false, sol, eol);
-          cenWindGObj.write(0, false, false, sol, eol);
-          cenWindBObj.write(0, false, false, sol, eol);
-        }
-        if (acWindRObj.valid() && acWindGObj.valid() && acWindBObj.valid() && cenWindRObj.valid() && cenWindGObj.valid() && cenWindBObj.valid() && prod_output ) {
-          // variance is convolution of the square of centered image and the gaussian filter
-          variance   = gaussFilt<pixvarType> (acWindRObj, acWindGObj, acWindBObj);
-
-          // The standard deviation of the image is the square root of the variance
-          stddev.R = ac_math::ac_sqrt_pwl<stddevType>(variance.R);
-          stddev.G = ac_math::ac_sqrt_pwl<stddevType>(variance.G);
-          stddev.B = ac_math::ac_sqrt_pwl<stddevType>(variance.B);
-
-          copycenterimgval.R = cenWindRObj(4 - (GK_SZ/2), 4 - (GK_SZ/2));
-          copycenterimgval.G = cenWindGObj(4 - (GK_SZ/2), 4 - (GK_SZ/2));
-          copycenterimgval.B = cenWindBObj(4 - (GK_SZ/2), 4 - (GK_SZ/2));
-		  
-					stddev.R = (stddev.R>1e-4)?stddev.R:1e-4;
-					stddev.G = (stddev.G>1e-4)?stddev.G:1e-4;
-					stddev.B = (stddev.B>1e-4)?stddev.B:1e-4;
-
-					ac_math::ac_reciprocal_pwl(stddev.R, recstddev.R);
-					ac_math::ac_reciprocal_pwl(stddev.G, recstddev.G);
-					ac_math::ac_reciprocal_pwl(stddev.B, recstddev.B);
-
-					// The output is the centered image divided by the standard deviation
-					intout = copycenterimgval * recstddev;
-
-					// Converting form fixed point output to integer output
-					lcnint.R = intout.R.to_int();
-					lcnint.G = intout.G.to_int();
-					lcnint.B = intout.B.to_int();
-					// Initialize TUSER and TLAST for output pixel stream.
-					lcnint.TUSER = (i == 0 && j == 0);
-					lcnint.TLAST = (j == widthIn - 1);
-					streamOut.write(lcnint);
+    AC_PERF_SCOPE("ac_localcontrastnorm::getstddeviation");
+    // Stream the square of the centered image and the centered image through one window, as in
+    // getcenteredimage().
+    stddevIn src(centeredimage);
+    stddevOut func(*this, streamOut);
+    ac_stencil_2d<stdPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE, stddevOut> stencil(0);
+    stencil.run(src, widthIn, heightIn, func);
 
-        }
-        if (j == widthIn + (GK_SZ/2) - 1) { break; }
-      }
-      if (i == heightIn + (GK_SZ/2) - 1) { break; }
+#ifndef __SYNTHESIS__
+    AC_ASSERT(centeredimage.debug_size() == 0, "Input to gaussian filter block not completely consumed.");
+#endif
+  }
+
+  // The stages of run_axis(), see getcenteredimage() and getstddeviation().
+#pragma hls_pipeline_init_interval 1
+#pragma hls_design
+  void getcenteredimage_axis(
+    ac_channel<pixInType>      &streamIn,
+    centeredFlagsChanType      &centeredimage, // Gaussian filter output, with frame flags.
+    const nFramesInType        nFramesIn
+  ) {
+    AC_PERF_SCOPE("ac_localcontrastnorm::getcenteredimage_axis");
+    // Read the first pixel of the stream ahead, outside of the pixel loop.
+    if (!frameIn.primed()) {
+      AC_PERF_READ(streamIn);
+      frameIn.prime(streamIn);
     }
+    centeredFlagsIn src(streamIn, frameIn);
+    centeredOut<centeredFlagsChanType> func(*this, centeredimage);
+    ac_stencil_2d<inPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE, centeredOut<centeredFlagsChanType> > stencil(0);
+    stencil.run(src, nFramesIn, func);
+  }
+
+#pragma hls_pipeline_init_interval 1
+#pragma hls_design
+  void getstddeviation_axis(
+    centeredFlagsChanType      &centeredimage,
+    ac_channel<pixOutType>     &streamOut,
+    const nFramesInType        nFramesIn
+  ) {
+    AC_PERF_SCOPE("ac_localcontrastnorm::getstddeviation_axis");
+    stddevFlagsIn src(centeredimage);
+    stddevOut func(*this, streamOut);
+    ac_stencil_2d<stdPixType, GK_SZ, GK_SZ, W_MAX, INTERNAL_WMODE, stddevOut> stencil(0);
+    stencil.run(src, nFramesIn, func);
 
 #ifndef __SYNTHESIS__
     AC_ASSERT(centeredimage.debug_size() == 0, "Input to gaussian filter block not completely consumed.");
 #endif
   }
 
-  // Carry out filtering with kernel and window values.
+  // Carry out filtering with kernel and window values. Planes 0, 1 and 2 of the window values hold the R, G
+  // and B values.
   template<class filtOpType, class acWindType, int K_SZ>
   filtOpType gaussFilt(
-    const ac_window_2d_flag<acWindType, K_SZ, K_SZ, W_MAX, INTERNAL_WMODE> &acWindRObj,
-    const ac_window_2d_flag<acWindType, K_SZ, K_SZ, W_MAX, INTERNAL_WMODE> &acWindGObj,
-    const ac_window_2d_flag<acWindType, K_SZ, K_SZ, W_MAX, INTERNAL_WMODE> &acWindBObj
+    const acWindType (&acWindOut)[3][K_SZ][K_SZ]
   ) {
     // Gaussian kernel
     const ac_fixed<NFRAC_BITS, 0, false> G_kernel[K_SZ][K_SZ] = {
@@ -289,28 +414,21 @@ private:
     };
 
     filtOpType filtOp = 0;
-    // Window output is stored in temporary array. While you can also directly multiply values from
-    // acWindObj and get the same QofR, having a temporary array can be more convenient for debugging.
-    acWindType acWindROut[K_SZ][K_SZ];
-    acWindType acWindGOut[K_SZ][K_SZ];
-    acWindType acWindBOut[K_SZ][K_SZ];
 #pragma hls_unroll yes
     CONV_OP_ROW_LOOP: for (int r = 0; r < int(K_SZ); r++) {
 #pragma hls_unroll yes
       CONV_OP_COL_LOOP: for (int c = 0; c < int(K_SZ); c++) {
-        acWindROut[r][c] = acWindRObj(r - (K_SZ/2), c - (K_SZ/2));
-        acWindGOut[r][c] = acWindGObj(r - (K_SZ/2), c - (K_SZ/2));
-        acWindBOut[r][c] = acWindBObj(r - (K_SZ/2), c - (K_SZ/2));
-        //cout << " The actual window values are: " << acWindOut[r][c] << endl;
-        filtOp.R += acWindROut[r][c]*(G_kernel[r][c]);
-        filtOp.G += acWindGOut[r][c]*(G_kernel[r][c]);
-        filtOp.B += acWindBOut[r][c]*(G_kernel[r][c]);
+        filtOp.R += acWindOut[0][r][c]*(G_kernel[r][c]);
+        filtOp.G += acWindOut[1][r][c]*(G_kernel[r][c]);
+        filtOp.B += acWindOut[2][r][c]*(G_kernel[r][c]);
       }
     }
     return filtOp;
   }
 
-  ac_channel<pixgaussOpType> P1; // Interconnect channel with centered image.
+  centeredChanType P1; // Interconnect channel with centered image.
+  centeredFlagsChanType P1F; // Interconnect channel of run_axis(), with centered image and frame flags.
+  ac_frame_flags<pixInType> frameIn; // Frame flag decoder of run_axis(), holds the lookahead input pixel.
 };
 
 #endif
@@ -35,10 +35,13 @@
 #include <ac_fixed.h>
 #include <ac_ipl/ac_pixels.h>
 #include <ac_window_2d_flag.h>
+#include <ac_stencil_2d.h>
 #include <ac_math/ac_reciprocal_pwl.h>
 #include <ac_math/ac_div.h>
 #include <ac_math/ac_determinant.h>
 
+#include <ac_perf.h>
+#include <ac_dataflow.h>
 #include <ac_channel.h>
 #include <mc_scverify.h>
 
@@ -85,6 +88,19 @@ public:
   typedef ac_int<2*CDEPTH,false> SP_DER_FRAME_WIND;
   typedef ac_int<3*CDEPTH,false> CI_FRAME_WIND;
 
+  // Resources and latency of this configuration, see ac_resource.h. The multipliers are the two 5x5
+  // derivative filters, the five 11x11 integrals, the 2x2 determinant, the reciprocal PWL function and
+  // the five products of the velocity vector calculation.
+  typedef ac_window_2d_flag<SP_DER_FRAME_WIND, SF_KS, SF_KS, W_MAX, AC_WIN_MODE> spDerWindType;
+  typedef ac_window_2d_flag<CI_FRAME_WIND, CI_KS, CI_KS, W_MAX, AC_WIN_MODE>     ciWindType;
+  enum {
+    LB_BITS = spDerWindType::LB_BITS + ciWindType::LB_BITS,
+    LB_RAMS = spDerWindType::LB_RAMS + ciWindType::LB_RAMS,
+    MULTIPLIERS = 2*SF_KS*SF_KS + 5*CI_KS*CI_KS + 2 + 1 + 5,
+    LATENCY_LINES = spDerWindType::LATENCY_LINES + ciWindType::LATENCY_LINES,
+    LATENCY_PIXELS = spDerWindType::LATENCY_PIXELS + ciWindType::LATENCY_PIXELS
+  };
+
   #pragma hls_design interface
   void CCS_BLOCK(run) (
     ac_channel<IN_TYPE>  &FrameIn_1,    // Pixel input stream
@@ -94,19 +110,102 @@ public:
      const widthInType    widthIn,     	// Input width
     const heightInType   heightIn    	// Input height
   ) {
-    spatialderivative(FrameIn_1, FrameIn_2, Xder, Yder, Tder, widthIn, heightIn);
-    computeintegrals(Xder, Yder, Tder, XX, XY, YY, TX, TY, widthIn, heightIn);
-	ComputeVectors(XX, XY, YY, TX, TY, Vx, Vy, widthIn, heightIn);
+    AC_PERF_CHANNEL(Xder, "ac_opticalflow::Xder");
+    AC_PERF_CHANNEL(Yder, "ac_opticalflow::Yder");
+    AC_PERF_CHANNEL(Tder, "ac_opticalflow::Tder");
+    AC_PERF_CHANNEL(XX, "ac_opticalflow::XX");
+    AC_PERF_CHANNEL(XY, "ac_opticalflow::XY");
+    AC_PERF_CHANNEL(YY, "ac_opticalflow::YY");
+    AC_PERF_CHANNEL(TX, "ac_opticalflow::TX");
+    AC_PERF_CHANNEL(TY, "ac_opticalflow::TY");
+    AC_DATAFLOW_BEGIN(df);
+    AC_DATAFLOW_CALL(df, spatialderivative(FrameIn_1, FrameIn_2, Xder, Yder, Tder, widthIn, heightIn));
+    AC_DATAFLOW_CALL(df, computeintegrals(Xder, Yder, Tder, XX, XY, YY, TX, TY, widthIn, heightIn));
+    AC_DATAFLOW_CALL(df, ComputeVectors(XX, XY, YY, TX, TY, Vx, Vy, widthIn, heightIn));
+    AC_DATAFLOW_END(df);
   }
   ac_opticalflow() { }
 
 private:
 
+  // Internal channel type, bounded FIFOs in a threaded C simulation (see ac_dataflow.h).
+  typedef typename ac_dataflow_channel<IN_TYPE>::type interChanType;
+
   ac_channel<IN_TYPE> fil_frame1, fil_frame2;
-  ac_channel<IN_TYPE> Xder, Yder, Tder;
-  ac_channel<IN_TYPE> XX, XY, YY, TX, TY ;
+  interChanType Xder, Yder, Tder;
+  interChanType XX, XY, YY, TX, TY ;
 
  
+  /*####################################################################
+  Input sources of the spatialderivative() and computeintegrals() stencils (see ac_stencil_2d.h).
+  frameIn packs the pixels of Frame1 and Frame2 into one window pixel, derivIn packs Ix, Iy and It.
+  ####################################################################*/
+  struct frameIn : ac_stencil_2d_source {
+    ac_channel<IN_TYPE> &Frame1;
+    ac_channel<IN_TYPE> &Frame2;
+    frameIn(ac_channel<IN_TYPE> &f1, ac_channel<IN_TYPE> &f2) : Frame1(f1), Frame2(f2) { }
+    SP_DER_FRAME_WIND read() {
+      SP_DER_FRAME_WIND pixIn;
+      AC_PERF_READ(Frame1);
+      IN_TYPE Frame1_temp = Frame1.read();
+      AC_PERF_READ(Frame2);
+      IN_TYPE Frame2_temp = Frame2.read();
+      pixIn.set_slc(0,Frame1_temp);
+      pixIn.set_slc(CDEPTH,Frame2_temp);
+      return pixIn;
+    }
+  };
+
+  struct derivIn : ac_stencil_2d_source {
+    interChanType &Ix;
+    interChanType &Iy;
+    interChanType &It;
+    derivIn(interChanType &x, interChanType &y, interChanType &t) : Ix(x), Iy(y), It(t) { }
+    CI_FRAME_WIND read() {
+      CI_FRAME_WIND value_in;
+      AC_PERF_READ(Ix);
+      IN_TYPE X_temp = Ix.read();
+      AC_PERF_READ(Iy);
+      IN_TYPE Y_temp = Iy.read();
+      AC_PERF_READ(It);
+      IN_TYPE T_temp = It.read();
+      value_in.set_slc(0,X_temp);
+      value_in.set_slc(CDEPTH,Y_temp);
+      value_in.set_slc(2*CDEPTH,T_temp);
+      return value_in;
+    }
+  };
+
+  /*####################################################################
+  Functors called by ac_stencil_2d for every valid window of spatialderivative() and computeintegrals().
+  ####################################################################*/
+  struct derivOut {
+    ac_opticalflow &of;
+    interChanType  &Ix;
+    interChanType  &Iy;
+    interChanType  &It;
+    derivOut(ac_opticalflow &o, interChanType &x, interChanType &y, interChanType &t) : of(o), Ix(x), Iy(y), It(t) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      of.template DerivativeFilter<IN_TYPE, SP_DER_FRAME_WIND, SpatialFilterType, SF_KS> (acWindObj, Ix, Iy, It);
+    }
+  };
+
+  struct integralOut {
+    ac_opticalflow &of;
+    interChanType  &A11;
+    interChanType  &A12;
+    interChanType  &A22;
+    interChanType  &B1;
+    interChanType  &B2;
+    integralOut(ac_opticalflow &o, interChanType &a11, interChanType &a12, interChanType &a22, interChanType &b1, interChanType &b2)
+      : of(o), A11(a11), A12(a12), A22(a22), B1(b1), B2(b2) { }
+    template<class WINDOW_TYPE>
+    void operator()(const WINDOW_TYPE &acWindObj, bool sof, bool eof, bool sol, bool eol) {
+      of.template IntegralFilter<IN_TYPE, CI_FRAME_WIND, CI_KS>(acWindObj, A11, A12, A22, B1, B2);
+    }
+  };
+
   /*####################################################################
   Spacial derivative function block to compute the Ix Iy (from frame 1) and It from Frame 1 and 2.
   ####################################################################*/
@@ -115,58 +214,24 @@ private:
   void spatialderivative(
     ac_channel<IN_TYPE>          &Frame1,
     ac_channel<IN_TYPE>          &Frame2,
-    ac_channel<IN_TYPE>    	 	 &Ix,
-    ac_channel<IN_TYPE>    	     &Iy,
-    ac_channel<IN_TYPE>    	 	 &It,
+    interChanType                &Ix,
+    interChanType                &Iy,
+    interChanType                &It,
     const widthInType            widthIn,
     const heightInType           heightIn
   ) {
 
     /*####################################################################
-    AC Winodw object declared here.
+    The stencil engine streams the pixels of both frames through one window.
     1. Window Data type SP_DER_FRAME_WIND , that is RGB _IMD of ac_int <CDEPTH_TYPE> that shall hold data from both frames.
     2. SF_KS is the Spatial filter Kernel Size.
     3. AC_WIN_MODE defines Mem type and the Boundary usage.
     ####################################################################*/
-   
-	ac_window_2d_flag<SP_DER_FRAME_WIND, SF_KS, SF_KS, W_MAX, AC_WIN_MODE> acWindObj(0);
-
-    ac_int<ac::nbits<H_MAX>::val, false> i = 0;
-    ac_int<ac::nbits<W_MAX>::val, false> j = 0;
-
-    bool inRead = true, eofOut = false;
-    SP_DER_FRAME_WIND pixIn;
-  
-    #pragma hls_pipeline_init_interval 1
-    INT_CONT_LOOP: do {
-      IN_TYPE Frame1_temp = inRead ? Frame1.read() : IN_TYPE(0);
-      IN_TYPE Frame2_temp = inRead ? Frame2.read() : IN_TYPE(0);
-      pixIn.set_slc(0,Frame1_temp);
-      pixIn.set_slc(CDEPTH,Frame2_temp);
-
-      bool sol = (j == 0);
-      bool sof = (i == 0) && sol;
-      bool eol = (j == widthIn - 1);
-      bool eof = (i == heightIn - 1) && eol;
-      acWindObj.write(pixIn, sof, eof, sol, eol);
-      if (eof) {
-        inRead = false;
-      }
-      j++;
-      if (j == widthIn) {
-        j = 0;
-        i++;
-        if (i == heightIn) {
-          i = 0;
-        }
-      }
-
-      bool sofOut, solOut, eolOut;
-      acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
-      if (acWindObj.valid()) {
-		DerivativeFilter<IN_TYPE, SP_DER_FRAME_WIND, SpatialFilterType, SF_KS> (acWindObj, Ix, Iy, It);
-      }
-    } while (!eofOut); // Stop processing once the entire image output has been read.
+    AC_PERF_SCOPE("ac_opticalflow::spatialderivative");
+    frameIn src(Frame1, Frame2);
+    derivOut func(*this, Ix, Iy, It);
+    ac_stencil_2d<SP_DER_FRAME_WIND, SF_KS, SF_KS, W_MAX, AC_WIN_MODE, derivOut> stencil(0);
+    stencil.run(src, widthIn, heightIn, func);
   }
 
   /*####################################################################
@@ -175,9 +240,9 @@ private:
   template<class filtOpType, class acWindType, class kType, int K_SZ>
   void DerivativeFilter(
     const ac_window_2d_flag<acWindType, K_SZ, K_SZ, W_MAX, AC_WIN_MODE> &acWindObj,
-    ac_channel<filtOpType> &Hor,
-    ac_channel<filtOpType> &Ver,
-    ac_channel<filtOpType> &Del
+    typename ac_dataflow_channel<filtOpType>::type &Hor,
+    typename ac_dataflow_channel<filtOpType>::type &Ver,
+    typename ac_dataflow_channel<filtOpType>::type &Del
   ) {
 
 // Filter coeeficients to calculate the X derivative Filter Size is of 5x5.
@@ -218,8 +283,11 @@ private:
 	N_op_Ver=derivative_op_Ver/12;
 	N_op_Del=derivative_op_Del/12;
 	
+    AC_PERF_WRITE(Hor);
     Hor.write(N_op_Hor);
+    AC_PERF_WRITE(Ver);
     Ver.write(N_op_Ver);
+    AC_PERF_WRITE(Del);
     Del.write(N_op_Del);
   }
 
@@ -232,66 +300,29 @@ private:
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
   void computeintegrals(
-    ac_channel<IN_TYPE>    &Ix,
-    ac_channel<IN_TYPE>    &Iy,
-    ac_channel<IN_TYPE>    &It,
-    ac_channel<IN_TYPE>    &A11,
-    ac_channel<IN_TYPE>    &A12,
-    ac_channel<IN_TYPE>    &A22,
-    ac_channel<IN_TYPE>    &B1,
-    ac_channel<IN_TYPE>    &B2,
+    interChanType          &Ix,
+    interChanType          &Iy,
+    interChanType          &It,
+    interChanType          &A11,
+    interChanType          &A12,
+    interChanType          &A22,
+    interChanType          &B1,
+    interChanType          &B2,
     const widthInType            widthIn,
     const heightInType           heightIn
   ) {
 
-    // /*####################################################################
-    // AC Winodw object declared here.
-    // 1. Window Data type SP_DER_FRAME_WIND , that is RGB _IMD of ac_int <CDEPTH_TYPE> that shall hold data from both frames.
-    // 2. CI_KS is the Window size for computing the integrals.
-    // 3. AC_WIN_MODE defines Mem type and the Boundary usage.
-    // ####################################################################*/
-   
-	ac_window_2d_flag<CI_FRAME_WIND, CI_KS, CI_KS, W_MAX, AC_WIN_MODE> acWindObj(0);
-
-    ac_int<ac::nbits<H_MAX>::val, false> i = 0;
-    ac_int<ac::nbits<W_MAX>::val, false> j = 0;
-
-    bool inRead = true, eofOut = false;
-    CI_FRAME_WIND value_in;
-  
-    #pragma hls_pipeline_init_interval 1
-    INT_CONT_LOOP: do {
-      IN_TYPE X_temp = inRead ? Ix.read() : IN_TYPE(0);
-      IN_TYPE Y_temp = inRead ? Iy.read() : IN_TYPE(0);
-      IN_TYPE T_temp = inRead ? It.read() : IN_TYPE(0);
-	  
-      value_in.set_slc(0,X_temp);
-      value_in.set_slc(CDEPTH,Y_temp);
-	  value_in.set_slc(2*CDEPTH,T_temp);
-
-      bool sol = (j == 0);
-      bool sof = (i == 0) && sol;
-      bool eol = (j == widthIn - 1);
-      bool eof = (i == heightIn - 1) && eol;
-      acWindObj.write(value_in, sof, eof, sol, eol);
-      if (eof) {
-        inRead = false;
-      }
-      j++;
-      if (j == widthIn) {
-        j = 0;
-        i++;
-        if (i == heightIn) {
-          i = 0;
-        }
-      }
-
-      bool sofOut, solOut, eolOut;
-      acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
-      if (acWindObj.valid()) {
-        IntegralFilter<IN_TYPE, CI_FRAME_WIND,  CI_KS>(acWindObj, A11, A12, A22, B1, B2);
-      }
-    } while (!eofOut); // Stop processing once the entire image output has been read.
+    /*####################################################################
+    The stencil engine streams Ix, Iy and It through one window.
+    1. Window Data type CI_FRAME_WIND, that holds Ix, Iy and It.
+    2. CI_KS is the Window size for computing the integrals.
+    3. AC_WIN_MODE defines Mem type and the Boundary usage.
+    ####################################################################*/
+    AC_PERF_SCOPE("ac_opticalflow::computeintegrals");
+    derivIn src(Ix, Iy, It);
+    integralOut func(*this, A11, A12, A22, B1, B2);
+    ac_stencil_2d<CI_FRAME_WIND, CI_KS, CI_KS, W_MAX, AC_WIN_MODE, integralOut> stencil(0);
+    stencil.run(src, widthIn, heightIn, func);
   }
   /*####################################################################
   MAC Block to perform the AC_WINDOW x AC_WINDOW
@@ -299,11 +330,11 @@ private:
   template<class filtOpType, class acWindType, int K_SZ>
   void IntegralFilter(
     const ac_window_2d_flag<acWindType, K_SZ, K_SZ, W_MAX, AC_WIN_MODE> &acWindObj,
-    ac_channel<filtOpType>    &Axx,
-    ac_channel<filtOpType>    &Axy,
-    ac_channel<filtOpType>    &Ayy,
-    ac_channel<filtOpType>    &Btx,
-    ac_channel<filtOpType>    &Bty
+    typename ac_dataflow_channel<filtOpType>::type &Axx,
+    typename ac_dataflow_channel<filtOpType>::type &Axy,
+    typename ac_dataflow_channel<filtOpType>::type &Ayy,
+    typename ac_dataflow_channel<filtOpType>::type &Btx,
+    typename ac_dataflow_channel<filtOpType>::type &Bty
   ) {
     filtOpType N_Op_Axx = 0.0,  N_Op_Axy = 0.0, N_Op_Ayy = 0.0,  N_Op_Btx = 0.0,  N_Op_Bty = 0.0;
 	ac_int<32, true> filtOp_Axx = 0.0,  filtOp_Axy = 0.0, filtOp_Ayy = 0.0,  filtOp_Btx = 0.0,  filtOp_Bty = 0.0;
@@ -330,10 +361,15 @@ private:
 	N_Op_Btx=filtOp_Btx>>8;
 	N_Op_Bty=filtOp_Bty>>8;
 		
+    AC_PERF_WRITE(Axx);
     Axx.write(N_Op_Axx);
+    AC_PERF_WRITE(Axy);
     Axy.write(N_Op_Axy);
+    AC_PERF_WRITE(Ayy);
     Ayy.write(N_Op_Ayy);
+    AC_PERF_WRITE(Btx);
     Btx.write(N_Op_Btx);
+    AC_PERF_WRITE(Bty);
     Bty.write(N_Op_Bty);
   }
 
@@ -386,7 +422,9 @@ private:
 		Vx = 0; Vy = 0;
 	}
 
+	AC_PERF_WRITE(VxChan);
 	VxChan.write(Vx>>8);
+	AC_PERF_WRITE(VyChan);
     VyChan.write(Vy>>8); 
 }
 
@@ -395,17 +433,18 @@ private:
   #pragma hls_pipeline_init_interval 1
   #pragma hls_design
 void ComputeVectors(
-  ac_channel<IN_TYPE>    &A11,
-  ac_channel<IN_TYPE>    &A12,
-  ac_channel<IN_TYPE>    &A22,
-  ac_channel<IN_TYPE>    &B1,
-  ac_channel<IN_TYPE>    &B2,
+  interChanType          &A11,
+  interChanType          &A12,
+  interChanType          &A22,
+  interChanType          &B1,
+  interChanType          &B2,
   ac_channel<IN_TYPE> &vx_img,
   ac_channel<IN_TYPE> &vy_img,
   const widthInType            widthIn,
   const heightInType           heightIn)
 
 {
+  AC_PERF_SCOPE("ac_opticalflow::ComputeVectors");
   int row, col;
   IN_TYPE A[2][2];
   IN_TYPE  B[2];
@@ -415,13 +454,19 @@ void ComputeVectors(
   #pragma hls_pipeline_init_interval 1
   L2: for(col = 0; col < widthIn; col++)
   {
-
+  AC_PERF_ITER();
+  AC_PERF_READ(A11);
   A[0][0] = A11.read();	//a11
+  AC_PERF_READ(A12);
   A[0][1] = A12.read(); //a12;
   A[1][0] = A[0][1]; 	//a21
+  AC_PERF_READ(A22);
   A[1][1] = A22.read(); //a22;
+  AC_PERF_READ(B1);
   B[0]    =  B1.read(); //b1
+  AC_PERF_READ(B2);
   B[1]    =  B2.read(); //b2
+  AC_PERF_VALID();
   matrix_invert(A, B, THRESHOLD, vx_img, vy_img);
 
   }
@@ -43,7 +43,9 @@
 #include <ac_fixed.h>
 #include <ac_channel.h>
 #include <ac_matrix.h>
+#include <ac_resource.h>
 #include <ac_ipl/ac_pixels.h>
+#include <ac_perf.h>
 
 #if !defined(__SYNTHESIS__) && defined(AC_CSC_H_DEBUG)
 #include <iostream>
@@ -122,6 +124,16 @@ namespace ac_csc {
     
     typedef ac_int<ac::nbits<AcImgHeight*AcImgWidth - 1>::val, false> cnt_type;
 
+    // Resources and latency of this configuration, see ac_resource.h. The 3x3 coefficient matrix is
+    // multiplied with each RGB pixel.
+    enum {
+      LB_BITS = 0,
+      LB_RAMS = 0,
+      MULTIPLIERS = 9,
+      LATENCY_LINES = 0,
+      LATENCY_PIXELS = 0
+    };
+
     rgbMatrix_type rgbMatrix;
 
     #pragma hls_pipeline_init_interval 1
@@ -132,6 +144,7 @@ namespace ac_csc {
       const ac_int<ac::nbits<AcImgWidth>::val, false> &width
     ) {
 
+      AC_PERF_SCOPE("ac_rgb2ycbcr::cvtColor");
       bool eof = false;
       cnt_type cnt = 0;
 
@@ -146,6 +159,8 @@ namespace ac_csc {
       rgb2ycbcrMatrix = Standard::getFullSwingMatrix();
 
       do {
+          AC_PERF_ITER();
+          AC_PERF_READ(din_ch);
           PixIn_type din = din_ch.read();
           PixOut_type dout;
 
@@ -156,6 +171,8 @@ namespace ac_csc {
 
           dout = ac_ipl::ac_rgb_2_ycbcr<Standard, StudioSwing, CDEPTH, FractBits, Q, multMatrix_type>(rgb2ycbcrMatrix, rgbMatrix);
 
+          AC_PERF_VALID();
+          AC_PERF_WRITE(dout_ch);
           dout_ch.write(dout);
           eof = (cnt == height*width - 1);
           cnt++;        
@@ -0,0 +1,342 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//***************************************************************************
+// File: ac_transpose_tile.h
+//
+// Description:
+//    The ac_transpose_tile block transposes or rotates (by 90 degrees) a raster
+//    input stream in square AC_TILE x AC_TILE tiles. The input image is split
+//    into horizontal bands of AC_TILE lines. While one band is being written
+//    into a ping-pong bank of line buffers, the previous band is read out of
+//    the other bank one tile at a time, so that the output is a tile-raster
+//    stream: bands from top to bottom, the tiles of a band from left to right
+//    and the pixels of a tile in raster order. Each tile is transposed or
+//    rotated about its own center.
+//
+//    The ac_tile_rasterizer block is the companion block that converts a
+//    tile-raster stream back to a raster stream, with the same ping-pong bank
+//    structure.
+//
+//    Both blocks process one pixel per clock and use 2*AC_TILE*W_MAX words of
+//    line buffer memory, instead of a W_MAX*H_MAX frame buffer.
+//
+// Usage:
+//    ac_transpose_tile<ac_int<8, false>, 8, 1920, 1080, AC_TILE_ROT90_CW> rotInst;
+//    ac_tile_rasterizer<ac_int<8, false>, 8, 1920, 1080> rastInst;
+//
+//    rotInst.run(streamIn, tileStream, widthIn, heightIn);
+//    rastInst.run(tileStream, streamOut, widthIn, heightIn);
+//
+// Notes:
+//    The input width and height must be multiples of AC_TILE.
+//
+//    Chaining ac_transpose_tile and ac_tile_rasterizer yields an image in
+//    which every tile is transposed or rotated in place. A full-frame
+//    transpose or rotation additionally needs the tiles to be reordered:
+//    tile (bi, bj) moves to (bj, bi) for a transpose, to (bj, nb-1-bi) for a
+//    clockwise rotation and to (nbj-1-bj, bi) for a counter-clockwise rotation,
+//    where nb and nbj are the number of tile rows and tile columns. That
+//    reordering spans the whole frame and is left to the frame-level memory
+//    system (e.g. a DMA writing tiles to their rotated addresses).
+//
+//    The latency of both blocks is one band, i.e. AC_TILE*widthIn cycles.
+//
+// Revision History:
+//
+//***************************************************************************
+
+#ifndef _INCLUDED_AC_TRANSPOSE_TILE_H_
+#define _INCLUDED_AC_TRANSPOSE_TILE_H_
+
+#include <ac_int.h>
+#include <ac_fixed.h>
+#include <ac_channel.h>
+#include <ac_perf.h>
+#include <ac_resource.h>
+#include <mc_scverify.h>
+
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+// The design uses static_asserts, which are only supported by C++11 or later compiler standards.
+// The #error directive below informs the user if they're not using those standards.
+#if (defined(__GNUC__) && (__cplusplus < 201103L))
+#error Please use C++11 or a later standard for compilation.
+#endif
+#if (defined(_MSC_VER) && (_MSC_VER < 1920) && !defined(__EDG__))
+#error Please use Microsoft VS 2019 or a later standard for compilation.
+#endif
+
+// Operation applied to each tile. For an output pixel at row r and column c of a tile, the source pixel
+// in the same input tile is:
+//   AC_TILE_TRANSPOSE: (c, r)
+//   AC_TILE_ROT90_CW:  (AC_TILE-1-c, r)
+//   AC_TILE_ROT90_CCW: (c, AC_TILE-1-r)
+enum ac_tile_mode { AC_TILE_TRANSPOSE = 0,
+                    AC_TILE_ROT90_CW  = 1,
+                    AC_TILE_ROT90_CCW = 2
+                  };
+
+// ac_transpose_tile template parameters:
+// T:        Pixel type
+// AC_TILE:  Tile size
+// W_MAX:    Max. supported width
+// H_MAX:    Max. supported height
+// AC_TMODE: Tile operation (ac_tile_mode)
+template <class T, int AC_TILE, unsigned W_MAX, unsigned H_MAX, int AC_TMODE = AC_TILE_TRANSPOSE>
+class ac_transpose_tile
+{
+  static_assert(AC_TILE >= 1, "Tile size must be positive.");
+  static_assert(W_MAX%AC_TILE == 0 && H_MAX%AC_TILE == 0, "W_MAX and H_MAX must be multiples of AC_TILE.");
+  static_assert(AC_TMODE == AC_TILE_TRANSPOSE || AC_TMODE == AC_TILE_ROT90_CW || AC_TMODE == AC_TILE_ROT90_CCW,
+                "AC_TMODE must be one of AC_TILE_TRANSPOSE, AC_TILE_ROT90_CW or AC_TILE_ROT90_CCW.");
+
+public:
+  // Dimension types are bitwidth-constrained according to the max dimensions possible.
+  typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
+  typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
+
+  ac_transpose_tile() { }
+
+  // Resources and latency of this configuration, see ac_resource.h. Output starts once the first band has
+  // been written into its bank.
+  enum {
+    LB_BITS = 2*AC_TILE*W_MAX*ac_resource_bits<T>::val,
+    LB_RAMS = 2*AC_TILE,
+    MULTIPLIERS = 0,
+    LATENCY_LINES = AC_TILE,
+    LATENCY_PIXELS = 0
+  };
+
+  #pragma hls_pipeline_init_interval 1
+  #pragma hls_design interface
+  void CCS_BLOCK(run)(
+    ac_channel<T>      &streamIn,  // Raster input stream
+    ac_channel<T>      &streamOut, // Tile-raster output stream
+    const widthInType  widthIn,    // Input width, multiple of AC_TILE
+    const heightInType heightIn    // Input height, multiple of AC_TILE
+  ) {
+    AC_PERF_SCOPE("ac_transpose_tile::run");
+    #ifndef __SYNTHESIS__
+    assert(widthIn%AC_TILE == 0 && heightIn%AC_TILE == 0);
+    #endif
+
+    // Write side: position of the incoming pixel within its band.
+    ac_int<ac::nbits<AC_TILE>::val, false> wRow = 0;
+    widthInType wCol = 0;
+    bool wBank = false;
+    // Read side: position of the outgoing pixel within its tile, and left column of the tile.
+    ac_int<ac::nbits<AC_TILE>::val, false> tRow = 0, tCol = 0;
+    widthInType tileCol = 0;
+    bool rBank = false;
+
+    const unsigned bandSize = AC_TILE*widthIn;
+    const unsigned nPix = widthIn*heightIn;
+
+    // The first band is only written, the last band is only read. Every other band is written into one bank
+    // while the previous band is read from the other.
+    #pragma hls_pipeline_init_interval 1
+    TRANSPOSE_TILE_LOOP: for (unsigned i = 0; i < W_MAX*H_MAX + AC_TILE*W_MAX; i++) {
+      AC_PERF_ITER();
+      if (i < nPix) {
+        AC_PERF_READ(streamIn);
+        bank[wBank][wRow][wCol] = streamIn.read();
+        if (wCol == widthIn - 1) {
+          wCol = 0;
+          if (wRow == AC_TILE - 1) {
+            wRow = 0;
+            wBank = !wBank;
+          } else {
+            wRow++;
+          }
+        } else {
+          wCol++;
+        }
+      } else {
+        AC_PERF_FLUSH();
+      }
+
+      if (i >= bandSize) {
+        AC_PERF_VALID();
+        AC_PERF_WRITE(streamOut);
+        int sRow, sCol;
+        #pragma hls_waive CNS
+        if (AC_TMODE == AC_TILE_ROT90_CW) {
+          sRow = AC_TILE - 1 - tCol;
+          sCol = tRow;
+        } else if (AC_TMODE == AC_TILE_ROT90_CCW) {
+          sRow = tCol;
+          sCol = AC_TILE - 1 - tRow;
+        } else {
+          sRow = tCol;
+          sCol = tRow;
+        }
+        streamOut.write(bank[rBank][sRow][tileCol + sCol]);
+        if (tCol == AC_TILE - 1) {
+          tCol = 0;
+          if (tRow == AC_TILE - 1) {
+            tRow = 0;
+            if (tileCol == widthIn - AC_TILE) {
+              tileCol = 0;
+              rBank = !rBank;
+            } else {
+              tileCol += AC_TILE;
+            }
+          } else {
+            tRow++;
+          }
+        } else {
+          tCol++;
+        }
+      } else {
+        AC_PERF_RAMPUP();
+      }
+
+      if (i == nPix + bandSize - 1) {
+        break;
+      }
+    }
+  }
+
+private:
+  T bank[2][AC_TILE][W_MAX]; // Ping-pong line buffer banks, one band each
+};
+
+// ac_tile_rasterizer template parameters:
+// T:       Pixel type
+// AC_TILE: Tile size
+// W_MAX:   Max. supported width
+// H_MAX:   Max. supported height
+template <class T, int AC_TILE, unsigned W_MAX, unsigned H_MAX>
+class ac_tile_rasterizer
+{
+  static_assert(AC_TILE >= 1, "Tile size must be positive.");
+  static_assert(W_MAX%AC_TILE == 0 && H_MAX%AC_TILE == 0, "W_MAX and H_MAX must be multiples of AC_TILE.");
+
+public:
+  // Dimension types are bitwidth-constrained according to the max dimensions possible.
+  typedef ac_int<ac::nbits<W_MAX>::val, false> widthInType;
+  typedef ac_int<ac::nbits<H_MAX>::val, false> heightInType;
+
+  ac_tile_rasterizer() { }
+
+  // Resources and latency of this configuration, see ac_resource.h. Output starts once the first band of tiles has
+  // been written into its bank.
+  enum {
+    LB_BITS = 2*AC_TILE*W_MAX*ac_resource_bits<T>::val,
+    LB_RAMS = 2*AC_TILE,
+    MULTIPLIERS = 0,
+    LATENCY_LINES = AC_TILE,
+    LATENCY_PIXELS = 0
+  };
+
+  #pragma hls_pipeline_init_interval 1
+  #pragma hls_design interface
+  void CCS_BLOCK(run)(
+    ac_channel<T>      &streamIn,  // Tile-raster input stream
+    ac_channel<T>      &streamOut, // Raster output stream
+    const widthInType  widthIn,    // Image width, multiple of AC_TILE
+    const heightInType heightIn    // Image height, multiple of AC_TILE
+  ) {
+    AC_PERF_SCOPE("ac_tile_rasterizer::run");
+    #ifndef __SYNTHESIS__
+    assert(widthIn%AC_TILE == 0 && heightIn%AC_TILE == 0);
+    #endif
+
+    // Write side: position of the incoming pixel within its tile, and left column of the tile.
+    ac_int<ac::nbits<AC_TILE>::val, false> tRow = 0, tCol = 0;
+    widthInType tileCol = 0;
+    bool wBank = false;
+    // Read side: position of the outgoing pixel within its band.
+    ac_int<ac::nbits<AC_TILE>::val, false> rRow = 0;
+    widthInType rCol = 0;
+    bool rBank = false;
+
+    const unsigned bandSize = AC_TILE*widthIn;
+    const unsigned nPix = widthIn*heightIn;
+
+    #pragma hls_pipeline_init_interval 1
+    RASTERIZE_TILE_LOOP: for (unsigned i = 0; i < W_MAX*H_MAX + AC_TILE*W_MAX; i++) {
+      AC_PERF_ITER();
+      if (i < nPix) {
+        AC_PERF_READ(streamIn);
+        bank[wBank][tRow][tileCol + tCol] = streamIn.read();
+        if (tCol == AC_TILE - 1) {
+          tCol = 0;
+          if (tRow == AC_TILE - 1) {
+            tRow = 0;
+            if (tileCol == widthIn - AC_TILE) {
+              tileCol = 0;
+              wBank = !wBank;
+            } else {
+              tileCol += AC_TILE;
+            }
+          } else {
+            tRow++;
+          }
+        } else {
+          tCol++;
+        }
+      } else {
+        AC_PERF_FLUSH();
+      }
+
+      if (i >= bandSize) {
+        AC_PERF_VALID();
+        AC_PERF_WRITE(streamOut);
+        streamOut.write(bank[rBank][rRow][rCol]);
+        if (rCol == widthIn - 1) {
+          rCol = 0;
+          if (rRow == AC_TILE - 1) {
+            rRow = 0;
+            rBank = !rBank;
+          } else {
+            rRow++;
+          }
+        } else {
+          rCol++;
+        }
+      } else {
+        AC_PERF_RAMPUP();
+      }
+
+      if (i == nPix + bandSize - 1) {
+        break;
+      }
+    }
+  }
+
+private:
+  T bank[2][AC_TILE][W_MAX]; // Ping-pong line buffer banks, one band each
+};
+
+#endif
@@ -0,0 +1,286 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_perf.h
+//
+// Description:
+//  Opt-in, cycle-approximate performance counters for C simulation. When AC_PERF_COUNTERS is defined
+//  (and __SYNTHESIS__ is not), each hls_design block that declares an AC_PERF_SCOPE records, for every call
+//  to the block (i.e. every frame):
+//    iterations: iterations of the main pipelined loop, ~ cycles at an initiation interval of 1
+//    valid:      iterations that produced a valid output
+//    rampup:     iterations before the first valid output (line buffer / window fill)
+//    flush:      iterations after the last input was read (window flush)
+//    reads:      channel reads
+//    writes:     channel writes
+//    stalls:     reads attempted on an empty channel (only possible with concurrently running blocks)
+//    cycles:     modeled cycles, i.e. iterations plus waits
+//    waits:      modeled cycles spent waiting for data on a profiled channel (see below)
+//  The counters are written as one line per block and frame to the perf stream (std::cout by default):
+//    AC_PERF block=ac_canny::gaussFilter frame=0 iterations=... valid=... rampup=... flush=... ...
+//
+//  The counter macros update the innermost active scope, so loops shared by several kernels (e.g.
+//  ac_stencil_2d::run()) count into the block that calls them. Counter macros outside of any scope are
+//  ignored. Without AC_PERF_COUNTERS, or under __SYNTHESIS__, all macros expand to nothing.
+//
+//  Channel occupancy profiling: in C simulation, the blocks of a hierarchical design run one after the
+//  other, so each internal channel holds a whole frame. The channels registered with AC_PERF_CHANNEL
+//  are instead profiled against a model of concurrent block execution: every block executes one loop
+//  iteration per cycle, and an iteration that reads a token from a profiled channel starts no earlier
+//  than the cycle after the token was written. The maximum number of tokens in the channel in this model
+//  is the FIFO depth at which the producer never stalls (for an unstalled downstream). The results are
+//  written with ac_perf_channel_report():
+//    AC_PERF_CHANNEL channel=ac_canny::P1 writes=... reads=... max_occupancy=...
+//
+// Usage:
+//    #define AC_PERF_COUNTERS
+//    #include <ac_ipl/ac_canny.h>
+//    ...
+//    std::ostringstream perfLog;
+//    ac_perf_set_stream(perfLog); // optional
+//    ...                          // run the design
+//    ac_perf_channel_report();
+//
+//    // In a block:
+//    AC_PERF_SCOPE("my_kernel::run");
+//    do {
+//      AC_PERF_ITER();
+//      if (inRead) { AC_PERF_READ(streamIn); pix = streamIn.read(); } else { AC_PERF_FLUSH(); }
+//      ...
+//      if (valid) { AC_PERF_VALID(); AC_PERF_WRITE(streamOut); streamOut.write(out); } else { AC_PERF_RAMPUP(); }
+//    } while (...);
+//
+//    // In a block that is instantiated once per level, e.g. of an image pyramid, with the counters
+//    // recorded as block=my_pyr::level[0], block=my_pyr::level[1], ...:
+//    AC_PERF_SCOPE_N("my_pyr::level", LEVEL);
+//
+//    // In the top level of a hierarchical design, before the blocks are called:
+//    AC_PERF_CHANNEL(P1, "my_kernel::P1");
+//
+// Notes:
+//  - The frame count and the modeled timeline are kept per scope name, i.e. shared by all instances of a
+//    block with the same name. Profile a single instance of a hierarchical design at a time.
+//  - Tokens on unprofiled channels (e.g. the top level inputs) are assumed to be available at any time.
+//  - The scope stack is global and not thread-safe.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_PERF_H
+#define __AC_PERF_H
+
+#if defined(AC_PERF_COUNTERS) && !defined(__SYNTHESIS__)
+
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+struct ac_perf_counters {
+  unsigned long long iterations, valid, rampup, flush, reads, writes, stalls, cycles, waits;
+  ac_perf_counters() : iterations(0), valid(0), rampup(0), flush(0), reads(0), writes(0), stalls(0), cycles(0), waits(0) { }
+};
+
+// Modeled state of a profiled channel.
+struct ac_perf_channel_model {
+  std::string name;
+  std::deque<unsigned long long> tokens; // Modeled write cycles of the tokens that were not read yet
+  unsigned long long writes, reads, maxOccupancy;
+  ac_perf_channel_model() : writes(0), reads(0), maxOccupancy(0) { }
+};
+
+// Output stream of the counter dumps.
+inline std::ostream *&ac_perf_stream_ptr()
+{
+  static std::ostream *os = &std::cout;
+  return os;
+}
+
+inline void ac_perf_set_stream(std::ostream &os) { ac_perf_stream_ptr() = &os; }
+
+class ac_perf_scope
+{
+public:
+  ac_perf_scope(const char *name) : name_(name), parent_(current()) {
+    begin();
+  }
+  // Scope of one of several instances of a block, e.g. a pyramid level, recorded as name[index].
+  ac_perf_scope(const char *name, int index) : parent_(current()) {
+    std::ostringstream os;
+    os << name << "[" << index << "]";
+    name_ = os.str();
+    begin();
+  }
+  ~ac_perf_scope() {
+    current() = parent_;
+    cnt.cycles = next_ - start_;
+    cycles()[name_] = next_;
+    unsigned &frame = frames()[name_];
+    *ac_perf_stream_ptr() << "AC_PERF block=" << name_ << " frame=" << frame
+                          << " iterations=" << cnt.iterations << " valid=" << cnt.valid
+                          << " rampup=" << cnt.rampup << " flush=" << cnt.flush
+                          << " reads=" << cnt.reads << " writes=" << cnt.writes
+                          << " stalls=" << cnt.stalls << " cycles=" << cnt.cycles
+                          << " waits=" << cnt.waits << std::endl;
+    frame++;
+  }
+
+  // Innermost active scope, or 0.
+  static ac_perf_scope *&current() {
+    static ac_perf_scope *cur = 0;
+    return cur;
+  }
+
+  // Frame count of each block.
+  static std::map<std::string, unsigned> &frames() {
+    static std::map<std::string, unsigned> f;
+    return f;
+  }
+
+  // Next free cycle of the modeled timeline of each block.
+  static std::map<std::string, unsigned long long> &cycles() {
+    static std::map<std::string, unsigned long long> c;
+    return c;
+  }
+
+  // Profiled channels, by address.
+  static std::map<const void *, ac_perf_channel_model> &channels() {
+    static std::map<const void *, ac_perf_channel_model> ch;
+    return ch;
+  }
+
+  static void channel(const void *chan, const char *name) {
+    channels()[chan].name = name;
+  }
+
+  static void iter() {
+    if (current()) {
+      current()->cnt.iterations++;
+      current()->cycle_ = current()->next_++;
+    }
+  }
+
+  template<class CHAN_TYPE>
+  static void read(CHAN_TYPE &chan) {
+    if (!current()) { return; }
+    ac_perf_scope &s = *current();
+    s.cnt.reads++;
+    if (!chan.available(1)) { s.cnt.stalls++; }
+    typename std::map<const void *, ac_perf_channel_model>::iterator it = channels().find(&chan);
+    if (it == channels().end() || it->second.tokens.empty()) { return; }
+    ac_perf_channel_model &m = it->second;
+    // The iteration waits until the token has been written.
+    if (s.cycle_ <= m.tokens.front()) {
+      s.cnt.waits += m.tokens.front() + 1 - s.cycle_;
+      s.cycle_ = m.tokens.front() + 1;
+      s.next_ = s.cycle_ + 1;
+    }
+    // Tokens written before this cycle are in the channel.
+    unsigned long long occ = std::lower_bound(m.tokens.begin(), m.tokens.end(), s.cycle_) - m.tokens.begin();
+    m.maxOccupancy = std::max(m.maxOccupancy, occ);
+    m.tokens.pop_front();
+    m.reads++;
+  }
+
+  template<class CHAN_TYPE>
+  static void write(CHAN_TYPE &chan) {
+    if (!current()) { return; }
+    ac_perf_scope &s = *current();
+    s.cnt.writes++;
+    typename std::map<const void *, ac_perf_channel_model>::iterator it = channels().find(&chan);
+    if (it == channels().end()) { return; }
+    it->second.tokens.push_back(s.cycle_);
+    it->second.writes++;
+  }
+
+  ac_perf_counters cnt;
+
+private:
+  void begin() {
+    current() = this;
+    start_ = next_ = cycles()[name_];
+    cycle_ = next_;
+  }
+
+  std::string name_;
+  ac_perf_scope *parent_;
+  unsigned long long start_; // First cycle of this call on the block timeline
+  unsigned long long cycle_; // Cycle of the current iteration
+  unsigned long long next_;  // First cycle after the current iteration
+};
+
+// Write the modeled maximum occupancy of each profiled channel to the perf stream.
+inline void ac_perf_channel_report()
+{
+  std::map<const void *, ac_perf_channel_model> &ch = ac_perf_scope::channels();
+  for (std::map<const void *, ac_perf_channel_model>::iterator it = ch.begin(); it != ch.end(); ++it) {
+    *ac_perf_stream_ptr() << "AC_PERF_CHANNEL channel=" << it->second.name << " writes=" << it->second.writes
+                          << " reads=" << it->second.reads << " max_occupancy=" << it->second.maxOccupancy << std::endl;
+  }
+}
+
+// Clear all frame counts, block timelines and channel profiles.
+inline void ac_perf_reset()
+{
+  ac_perf_scope::frames().clear();
+  ac_perf_scope::cycles().clear();
+  ac_perf_scope::channels().clear();
+}
+
+#define AC_PERF_CONCAT_(a, b) a##b
+#define AC_PERF_CONCAT(a, b) AC_PERF_CONCAT_(a, b)
+#define AC_PERF_SCOPE(name) ac_perf_scope AC_PERF_CONCAT(acPerfScope_, __LINE__)(name)
+#define AC_PERF_SCOPE_N(name, index) ac_perf_scope AC_PERF_CONCAT(acPerfScope_, __LINE__)(name, index)
+#define AC_PERF_COUNT_(field) do { if (ac_perf_scope::current()) { ac_perf_scope::current()->cnt.field++; } } while (0)
+#define AC_PERF_ITER()   ac_perf_scope::iter()
+#define AC_PERF_VALID()  AC_PERF_COUNT_(valid)
+#define AC_PERF_RAMPUP() AC_PERF_COUNT_(rampup)
+#define AC_PERF_FLUSH()  AC_PERF_COUNT_(flush)
+#define AC_PERF_READ(chan)  ac_perf_scope::read(chan)
+#define AC_PERF_WRITE(chan) ac_perf_scope::write(chan)
+#define AC_PERF_CHANNEL(chan, name) ac_perf_scope::channel(&(chan), name)
+
+#else
+
+#define AC_PERF_SCOPE(name)
+#define AC_PERF_SCOPE_N(name, index)
+#define AC_PERF_ITER()
+#define AC_PERF_VALID()
+#define AC_PERF_RAMPUP()
+#define AC_PERF_FLUSH()
+#define AC_PERF_READ(chan)
+#define AC_PERF_WRITE(chan)
+#define AC_PERF_CHANNEL(chan, name)
+
+#endif
+
+#endif
@@ -0,0 +1,300 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_range.h
+//
+// Description:
+//  Opt-in dynamic range profiler for intermediate datapath types in C simulation. When AC_RANGE_PROFILE is
+//  defined (and __SYNTHESIS__ is not), each AC_RANGE_TRACK(name, value) records, per name:
+//    - the declared type of value (ac_fixed<W,I,S> or ac_int<W,S>),
+//    - the number of samples and their minimum and maximum value,
+//    - a quantization error histogram: for every candidate fraction width f from 0 to the declared one,
+//      the number of samples that change, and the sum of squared errors, when the fraction is truncated
+//      (AC_TRN) to f bits.
+//  ac_range_report() writes one line per name to the range stream (std::cout by default):
+//    AC_RANGE name=ac_canny::gaussOp type=ac_fixed<24,8,false> count=... min=... max=... sign=...
+//             int_bits=... frac_bits_exact=... frac_bits_psnr=... psnr_db=...
+//  where int_bits is the smallest integer width that holds [min, max], frac_bits_exact the smallest
+//  fraction width at which no sample changes, and frac_bits_psnr the smallest fraction width at which the
+//  signal-to-quantization-noise ratio of the intermediate (peak = max(|min|, |max|)) is at least psnr_db.
+//  A type of sign, int_bits and frac_bits_exact bits holds all the simulated values of the intermediate
+//  exactly, so the output of the design stays bit-exact for the simulated data set. The PSNR bound applies
+//  to the intermediate itself; its effect on the output PSNR must be checked by re-simulation.
+//
+//  Without AC_RANGE_PROFILE, or under __SYNTHESIS__, AC_RANGE_TRACK expands to nothing.
+//
+// Usage:
+//    #define AC_RANGE_PROFILE
+//    #include <ac_ipl/ac_canny.h>
+//    ...                  // run the design on a representative image set
+//    ac_range_report(50); // 50 dB bound for frac_bits_psnr
+//
+//    // In a block:
+//    gaussOpType gaussOp = ...;
+//    AC_RANGE_TRACK("my_kernel::gaussOp", gaussOp);
+//
+// Notes:
+//  - int_bits and frac_bits_exact are computed on the bits of the ac_int or ac_fixed representation, so
+//    they are exact for any width. min, max and the squared errors behind frac_bits_psnr are accumulated as
+//    double, i.e. with a 53 bit mantissa. double and float samples are analyzed as double.
+//  - The statistics of a name are shared by all instances of the block and accumulate over all frames,
+//    until ac_range_reset() is called.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_RANGE_H
+#define __AC_RANGE_H
+
+#if defined(AC_RANGE_PROFILE) && !defined(__SYNTHESIS__)
+
+#include <ac_int.h>
+#include <ac_fixed.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#ifndef AC_RANGE_MAX_FRAC
+#define AC_RANGE_MAX_FRAC 64 // Largest candidate fraction width
+#endif
+
+// Declared width, integer width and signedness of a tracked type.
+template<class T>
+struct ac_range_type_info {
+  enum { W = 64, I = 64, S = true, F = 32 };
+  static std::string name() { return "double"; }
+};
+
+template<int W_, bool S_>
+struct ac_range_type_info<ac_int<W_, S_> > {
+  enum { W = W_, I = W_, S = S_, F = 0 };
+  static std::string name() {
+    std::ostringstream os;
+    os << "ac_int<" << W_ << "," << (S_ ? "true" : "false") << ">";
+    return os.str();
+  }
+};
+
+template<int W_, int I_, bool S_, ac_q_mode Q_, ac_o_mode O_>
+struct ac_range_type_info<ac_fixed<W_, I_, S_, Q_, O_> > {
+  enum { W = W_, I = I_, S = S_, F = W_ - I_ };
+  static std::string name() {
+    std::ostringstream os;
+    os << "ac_fixed<" << W_ << "," << I_ << "," << (S_ ? "true" : "false") << ">";
+    return os.str();
+  }
+};
+
+// Quantization properties of one sample.
+struct ac_range_sample {
+  double val;
+  int intBitsU;      // Smallest integer width that holds the sample without a sign bit (if val >= 0)
+  int intBitsS;      // Smallest integer width that holds the sample with a sign bit
+  int fracBitsExact; // Smallest fraction width that holds the sample exactly
+  double err[AC_RANGE_MAX_FRAC + 1]; // Truncation error at f fraction bits, for f < fracBitsExact
+};
+
+// Sample properties from the W bits of the representation r of an ac_int or ac_fixed with F fraction bits.
+template<class T>
+inline void ac_range_sample_bits(const T &r, int W, int F, bool S, ac_range_sample &smp)
+{
+  bool neg = S && r[W - 1];
+  int hi = 0; // Significant bits: one more than the highest bit that differs from the sign
+  for (int b = W - 1; b >= 0; b--) {
+    if (bool(r[b]) != neg) {
+      hi = b + 1;
+      break;
+    }
+  }
+  int lo = -1; // Lowest set bit
+  for (int b = 0; b < W && lo < 0; b++) {
+    if (r[b]) { lo = b; }
+  }
+  smp.intBitsU = std::max(hi - F, 1 - F);
+  smp.intBitsS = std::max(hi + 1 - F, 1 - F);
+  smp.fracBitsExact = (lo >= 0 && lo < F) ? F - lo : 0;
+  // Truncating to f fraction bits drops bits 0 .. F-f-1, which always have a positive weight.
+  double err = 0;
+  for (int f = F - 1; f >= 0; f--) {
+    int b = F - 1 - f;
+    if (b < W ? bool(r[b]) : neg) { err += std::ldexp(1.0, -(f + 1)); }
+    if (f <= AC_RANGE_MAX_FRAC) { smp.err[f] = err; }
+  }
+}
+
+template<int W, bool S>
+inline void ac_range_sample_of(const ac_int<W, S> &v, ac_range_sample &smp)
+{
+  smp.val = v.to_double();
+  ac_range_sample_bits(v, W, 0, S, smp);
+}
+
+template<int W, int I, bool S, ac_q_mode Q, ac_o_mode O>
+inline void ac_range_sample_of(const ac_fixed<W, I, S, Q, O> &v, ac_range_sample &smp)
+{
+  smp.val = v.to_double();
+  ac_range_sample_bits(v, W, W - I, S, smp);
+}
+
+inline void ac_range_sample_of(int v, ac_range_sample &smp) { ac_range_sample_of(ac_int<32, true>(v), smp); }
+
+inline void ac_range_sample_of(double v, ac_range_sample &smp)
+{
+  smp.val = v;
+  smp.intBitsU = smp.intBitsS = 1024;
+  for (int i = 1 - AC_RANGE_MAX_FRAC; i < 1024; i++) {
+    double hi = std::ldexp(1.0, i);
+    if (smp.intBitsU == 1024 && v < hi && v >= 0) { smp.intBitsU = i; }
+    if (v < hi/2 && v >= -hi/2) {
+      smp.intBitsS = i;
+      break;
+    }
+  }
+  smp.fracBitsExact = AC_RANGE_MAX_FRAC;
+  for (int f = 0; f <= AC_RANGE_MAX_FRAC; f++) {
+    double scale = std::ldexp(1.0, f);
+    smp.err[f] = v - std::floor(v*scale)/scale;
+    if (smp.err[f] == 0) {
+      smp.fracBitsExact = f;
+      break;
+    }
+  }
+}
+
+inline void ac_range_sample_of(float v, ac_range_sample &smp) { ac_range_sample_of(double(v), smp); }
+
+struct ac_range_stats {
+  std::string type;
+  int fracBits; // Declared fraction width, capped to AC_RANGE_MAX_FRAC
+  unsigned long long count;
+  double minVal, maxVal;
+  int intBitsU, intBitsS; // Largest ac_range_sample::intBitsU and intBitsS
+  unsigned long long changed[AC_RANGE_MAX_FRAC + 1]; // Samples that change when truncated to f fraction bits
+  double sqErr[AC_RANGE_MAX_FRAC + 1];               // Sum of squared truncation errors at f fraction bits
+
+  ac_range_stats() : fracBits(0), count(0), minVal(0), maxVal(0), intBitsU(-1024), intBitsS(-1024) {
+    for (int f = 0; f <= AC_RANGE_MAX_FRAC; f++) {
+      changed[f] = 0;
+      sqErr[f] = 0;
+    }
+  }
+
+  void record(const ac_range_sample &smp) {
+    minVal = (count == 0 || smp.val < minVal) ? smp.val : minVal;
+    maxVal = (count == 0 || smp.val > maxVal) ? smp.val : maxVal;
+    intBitsU = std::max(intBitsU, smp.intBitsU);
+    intBitsS = std::max(intBitsS, smp.intBitsS);
+    count++;
+    for (int f = 0; f < smp.fracBitsExact && f <= fracBits; f++) {
+      changed[f]++;
+      sqErr[f] += smp.err[f]*smp.err[f];
+    }
+  }
+
+  // Smallest integer width (including the sign bit when sign is true) that holds all samples, and leaves
+  // at least one bit in total with the declared fraction width.
+  int intBits(bool sign) const {
+    return std::max(sign ? intBitsS : intBitsU, 1 - fracBits);
+  }
+
+  int fracBitsExact() const {
+    for (int f = 0; f <= fracBits; f++) {
+      if (changed[f] == 0) { return f; }
+    }
+    return fracBits;
+  }
+
+  int fracBitsPsnr(double psnrDb) const {
+    double peak = std::max(std::fabs(minVal), std::fabs(maxVal));
+    for (int f = 0; f <= fracBits; f++) {
+      if (changed[f] == 0) { return f; }
+      double mse = sqErr[f]/count;
+      if (peak > 0 && 10*std::log10(peak*peak/mse) >= psnrDb) { return f; }
+    }
+    return fracBits;
+  }
+};
+
+inline std::ostream *&ac_range_stream_ptr()
+{
+  static std::ostream *os = &std::cout;
+  return os;
+}
+
+inline void ac_range_set_stream(std::ostream &os) { ac_range_stream_ptr() = &os; }
+
+inline std::map<std::string, ac_range_stats> &ac_range_registry()
+{
+  static std::map<std::string, ac_range_stats> r;
+  return r;
+}
+
+template<class T>
+inline void ac_range_track(const char *name, const T &v)
+{
+  ac_range_stats &st = ac_range_registry()[name];
+  if (st.count == 0) {
+    st.type = ac_range_type_info<T>::name();
+    st.fracBits = ac_range_type_info<T>::F < AC_RANGE_MAX_FRAC ? int(ac_range_type_info<T>::F) : AC_RANGE_MAX_FRAC;
+    st.fracBits = st.fracBits < 0 ? 0 : st.fracBits;
+  }
+  ac_range_sample smp;
+  ac_range_sample_of(v, smp);
+  st.record(smp);
+}
+
+// Write the statistics and the minimal widths of every tracked intermediate to the range stream.
+inline void ac_range_report(double psnrDb = 60.0)
+{
+  std::map<std::string, ac_range_stats> &r = ac_range_registry();
+  for (std::map<std::string, ac_range_stats>::iterator it = r.begin(); it != r.end(); ++it) {
+    const ac_range_stats &st = it->second;
+    bool sign = st.minVal < 0;
+    *ac_range_stream_ptr() << "AC_RANGE name=" << it->first << " type=" << st.type << " count=" << st.count
+                           << " min=" << st.minVal << " max=" << st.maxVal << " sign=" << (sign ? "true" : "false")
+                           << " int_bits=" << st.intBits(sign) << " frac_bits_exact=" << st.fracBitsExact()
+                           << " frac_bits_psnr=" << st.fracBitsPsnr(psnrDb) << " psnr_db=" << psnrDb << std::endl;
+  }
+}
+
+inline void ac_range_reset() { ac_range_registry().clear(); }
+
+#define AC_RANGE_TRACK(name, value) ac_range_track(name, value)
+
+#else
+
+#define AC_RANGE_TRACK(name, value)
+
+#endif
+
+#endif
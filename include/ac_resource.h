@@ -0,0 +1,161 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_resource.h
+//
+// Description:
+//  Compile-time resource and latency metadata. ac_buffer_2d, ac_window_2d_flag and the ac_ipl kernel
+//  classes describe the hardware implied by their template parameters with the following enums:
+//    LB_BITS:        line buffer storage, in bits
+//    LB_RAMS:        line buffer RAM instances (one per stored line)
+//    MULTIPLIERS:    (kernels) multiplications per pixel in the datapath as written, including the ones
+//                    with constant coefficients and the one in each ac_math piecewise-linear function
+//    LATENCY_LINES,
+//    LATENCY_PIXELS: pixels written before the first valid output of a frame, i.e. the window fill
+//                    delay, LATENCY_LINES*width + LATENCY_PIXELS for a frame of the given width. For
+//                    kernels, the sum over the windowed stages from the input to the output
+//  ac_buffer_2d and ac_window_2d_flag also give the line buffer geometry (LB_LINES, LB_WORDS,
+//  LB_WORD_BITS), and ac_window_2d_flag the bits of its window registers (WINDOW_BITS).
+//
+//  ac_resource_report<KERNEL>() writes the metadata of a kernel configuration as one line:
+//    AC_RESOURCE kernel=ac_canny config=CDEPTH=8,W_MAX=1920 lb_bits=... lb_rams=... multipliers=...
+//                latency_lines=... latency_pixels=...
+//
+// Usage:
+//    #include <ac_ipl/ac_canny.h>
+//    ...
+//    ac_resource_report<ac_canny<8, 1920, 1080> >("ac_canny", "CDEPTH=8,W_MAX=1920");
+//    ac_resource_report<ac_canny<10, 3840, 2160, true> >("ac_canny", "CDEPTH=10,W_MAX=3840,SP");
+//
+//    // Compile-time selection:
+//    typedef ac_canny<8, 1920, 1080> cannyType;
+//    static_assert(cannyType::LATENCY_LINES <= 6, "latency budget exceeded");
+//
+// Notes:
+//  - The values are estimates of the design as written, before synthesis. Synthesis may implement
+//    constant coefficient multiplications with adders, and small line buffers with registers.
+//  - Pipeline registers inside a block are not included in the latency, which is dominated by the
+//    window fill of each stage.
+//  - The bit width of a pixel type is given by ac_resource_bits<T>::val. It is T::width for ac_int,
+//    ac_fixed and the other types that define it, and 8*sizeof(T) for types without a width member.
+//    Specialize ac_resource_bits for custom pixel classes.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_RESOURCE_H
+#define __AC_RESOURCE_H
+
+#ifndef __SYNTHESIS__
+#include <iostream>
+#endif
+
+namespace ac_ipl
+{
+  template <unsigned CDEPTH> struct RGB_1PPC;
+  template <unsigned CDEPTH> struct RGB_2PPC;
+  template <class T_imd> struct RGB_imd;
+}
+
+// Detects a compile-time "width" member.
+template<typename T>
+struct ac_resource_has_width {
+  template<int W> struct tag { };
+  template<typename U> static char test(tag<U::width> *);
+  template<typename U> static long test(...);
+  enum { val = sizeof(test<T>(0)) == sizeof(char) };
+};
+
+template<typename T, bool HAS_WIDTH = ac_resource_has_width<T>::val>
+struct ac_resource_bits {
+  enum { val = T::width };
+};
+
+template<typename T>
+struct ac_resource_bits<T, false> {
+  enum { val = 8*sizeof(T) };
+};
+
+template<>
+struct ac_resource_bits<bool, false> {
+  enum { val = 1 };
+};
+
+template<unsigned CDEPTH>
+struct ac_resource_bits<ac_ipl::RGB_1PPC<CDEPTH>, false> {
+  enum { val = 3*CDEPTH + 2 }; // R, G, B, TUSER and TLAST
+};
+
+template<unsigned CDEPTH>
+struct ac_resource_bits<ac_ipl::RGB_2PPC<CDEPTH>, false> {
+  enum { val = 6*CDEPTH + 2 };
+};
+
+template<class T_imd>
+struct ac_resource_bits<ac_ipl::RGB_imd<T_imd>, false> {
+  enum { val = 3*ac_resource_bits<T_imd>::val };
+};
+
+// Number of color components of a pixel type, e.g. for the multipliers of a filter that is applied to
+// each component.
+template<typename T>
+struct ac_resource_channels {
+  enum { val = 1 };
+};
+
+template<unsigned CDEPTH>
+struct ac_resource_channels<ac_ipl::RGB_1PPC<CDEPTH> > {
+  enum { val = 3 };
+};
+
+template<unsigned CDEPTH>
+struct ac_resource_channels<ac_ipl::RGB_2PPC<CDEPTH> > {
+  enum { val = 6 };
+};
+
+template<class T_imd>
+struct ac_resource_channels<ac_ipl::RGB_imd<T_imd> > {
+  enum { val = 3 };
+};
+
+#ifndef __SYNTHESIS__
+template<class KERNEL>
+void ac_resource_report(const char *kernel, const char *config, std::ostream &os = std::cout)
+{
+  os << "AC_RESOURCE kernel=" << kernel << " config=" << config
+     << " lb_bits=" << long(KERNEL::LB_BITS)
+     << " lb_rams=" << long(KERNEL::LB_RAMS)
+     << " multipliers=" << long(KERNEL::MULTIPLIERS)
+     << " latency_lines=" << long(KERNEL::LATENCY_LINES)
+     << " latency_pixels=" << long(KERNEL::LATENCY_PIXELS) << std::endl;
+}
+#endif
+
+#endif
@@ -0,0 +1,372 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_stencil_2d.h
+//
+// Description:
+//  Streaming 2D stencil engine. ac_stencil_2d owns the scanning loop that every windowed kernel otherwise
+//  writes by hand: it reads a widthIn x heightIn frame from an input channel in raster order, generates the
+//  sof/eof/sol/eol flags, writes the pixels to an ac_window_2d_flag (or, with AC_PPC > 1, to an
+//  ac_window_2d_flag_ppc), keeps writing dummy pixels after the last input pixel until the end-of-frame
+//  window has been output, and calls the user functor once for each valid window:
+//
+//    func(window, sofOut, eofOut, solOut, eolOut);
+//
+//  The functor only holds the per-window computation and writes its own outputs, e.g. to an output channel
+//  that it holds a reference to. For AC_PPC > 1, the window is accessed with window(p, r, c), and the
+//  functor produces the AC_PPC outputs of the group.
+//
+// Usage:
+//    struct sumFunc {
+//      ac_channel<ac_int<12,false> > &out;
+//      sumFunc(ac_channel<ac_int<12,false> > &o) : out(o) {}
+//      template<class WINDOW_TYPE>
+//      void operator()(const WINDOW_TYPE &w, bool sof, bool eof, bool sol, bool eol) {
+//        ac_int<12,false> sum = 0;
+//        for (int r = -1; r <= 1; r++) {
+//          for (int c = -1; c <= 1; c++) { sum += w(r, c); }
+//        }
+//        out.write(sum);
+//      }
+//    };
+//    ...
+//    sumFunc func(streamOut);
+//    ac_stencil_2d<ac_int<8,false>, 3, 3, 1920, AC_MIRROR, sumFunc> stencil;
+//    stencil.run(streamIn, widthIn, heightIn, func);
+//
+// Notes:
+//  - The number of iterations of the loop in run() is the same as in a hand-written kernel loop: one per
+//    input pixel (group), plus the flush iterations needed to output the last window.
+//  - With AC_PPC > 1, widthIn is the width in pixels and must be a multiple of AC_PPC.
+//  - run(streamIn, widthIn, heightIn, func) also takes the internal channels of a hierarchical design,
+//    ac_dataflow_channel<in_type>::type (see ac_dataflow.h).
+//  - A kernel that builds its window pixels from channels of other types, e.g. from the two input frames
+//    of ac_opticalflow, or from the R, G and B members of an RGB_1PPC pixel for a window of
+//    ac_window_planes, passes an input source derived from ac_stencil_2d_source instead of streamIn. Its
+//    in_type read() member reads the channels (and counts the reads with AC_PERF_READ) and returns the
+//    pixel to write to the window. Kernels with several windows of the same geometry write the pixels of
+//    all of them into one window, with T = ac_window_planes (see ac_window_2d_flag_mc.h), which also shares
+//    the window control logic.
+//  - Each call to run() processes one frame with a freshly constructed window, so the same ac_stencil_2d
+//    object can be used for consecutive frames.
+//  - run(streamIn, widthIn, heightIn, nFrames, func) streams nFrames frames of the same size back to back
+//    through one window. The first pixels of frame N+1 are read in the iterations that would otherwise
+//    flush frame N, while the last windows of frame N are output, so the flush iterations are only paid
+//    once, after the last frame: nFrames*(widthIn/AC_PPC)*heightIn iterations plus one frame flush,
+//    instead of nFrames flushes. run(streamIn, widthIn, heightIn, func) is the same with nFrames = 1.
+//  - run(streamIn, func), without the width and height arguments, takes the frame flags from the TUSER
+//    (start of frame) and TLAST (end of line) members of the input pixels, e.g. with T = RGB_1PPC (see
+//    ac_frame_flags.h). The frame size can then change from one frame to the next, up to AC_NCOL
+//    columns. This form reads one pixel ahead, which is held in the ac_stencil_2d object, so the object
+//    must persist across frames, and the last frame of the stream must be followed by a TUSER pixel. It is
+//    only available with AC_PPC = 1.
+//  - run(streamIn, nFrames, func) streams nFrames flag-driven frames back to back, with one flush after
+//    the last frame, as the width/height form does. The height can change from one frame to the next,
+//    but the frames of one call must have the same width, because the last windows of each frame are
+//    output while the first lines of the next frame are written. A change of width needs a new call.
+//  - Instead of a channel of flagged pixels, the flag-driven forms also take an input source derived from
+//    ac_stencil_2d_flag_source. Its void read(in_type &pix, bool &sof, bool &eof, bool &sol, bool &eol)
+//    member reads the channels (and counts the reads with AC_PERF_READ) and returns the pixel to write to
+//    the window, along with its frame flags. The internal channels of a hierarchical design can carry the
+//    flags of the windows of the previous block, including eof, so that the next block does not need to
+//    read ahead.
+//  - With AC_PERF_COUNTERS, the loop iterations, reads, valid windows, ramp-up and flush iterations are
+//    counted into the AC_PERF_SCOPE of the calling block (see ac_perf.h).
+//
+//*********************************************************************************************************
+
+#ifndef __AC_STENCIL_2D_H
+#define __AC_STENCIL_2D_H
+
+#include <ac_int.h>
+#include <ac_channel.h>
+#include "ac_window_2d_flag.h"
+#include "ac_window_2d_flag_ppc.h"
+#include "ac_frame_flags.h"
+#include "ac_perf.h"
+
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+// Base class of the input sources of ac_stencil_2d, see above. A source has an in_type read() member.
+struct ac_stencil_2d_source { };
+
+// Base class of the input sources of the flag-driven forms of run(), see above. A flag source has a
+// void read(in_type &pix, bool &sof, bool &eof, bool &sol, bool &eol) member.
+struct ac_stencil_2d_flag_source { };
+
+// Read one input word of ac_stencil_2d, from a channel...
+template<class IN_TYPE, class CHAN_TYPE>
+IN_TYPE ac_stencil_2d_read(CHAN_TYPE &streamIn, const void *)
+{
+  AC_PERF_READ(streamIn);
+  return streamIn.read();
+}
+
+// ... or from an input source, which counts its own channel reads. This overload is selected for the
+// classes derived from ac_stencil_2d_source, because the conversion of the address of the input to a
+// pointer to its base class is a better match than the conversion to const void *.
+template<class IN_TYPE, class CHAN_TYPE>
+IN_TYPE ac_stencil_2d_read(CHAN_TYPE &src, const ac_stencil_2d_source *)
+{
+  return src.read();
+}
+
+// Selects the window used by ac_stencil_2d, and the type of the words read from its input channel.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+struct ac_stencil_2d_window
+{
+  typedef ac_window_2d_flag_ppc<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, AC_PPC> type;
+  typedef typename type::ppc_type in_type;
+};
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
+struct ac_stencil_2d_window<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, 1>
+{
+  typedef ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE> type;
+  typedef T in_type;
+};
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class FUNC, int AC_PPC = 1>
+class ac_stencil_2d
+{
+public:
+  typedef typename ac_stencil_2d_window<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, AC_PPC>::type window_type;
+  typedef typename ac_stencil_2d_window<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, AC_PPC>::in_type in_type;
+  // Latency of the window, see ac_resource.h.
+  enum {
+    LATENCY_LINES = window_type::LATENCY_LINES,
+    LATENCY_PIXELS = window_type::LATENCY_PIXELS
+  };
+
+  ac_stencil_2d() : boundaryVal(0) { }
+  ac_stencil_2d(T bval) : boundaryVal(bval) { }
+
+  template<class CHAN_TYPE, class W_TYPE, class H_TYPE>
+  void run(CHAN_TYPE &streamIn, const W_TYPE widthIn, const H_TYPE heightIn, FUNC &func);
+  template<class CHAN_TYPE, class W_TYPE, class H_TYPE, class N_TYPE>
+  void run(CHAN_TYPE &streamIn, const W_TYPE widthIn, const H_TYPE heightIn, const N_TYPE nFrames, FUNC &func);
+  void run(ac_channel<in_type> &streamIn, FUNC &func);
+  template<class SRC_TYPE, class N_TYPE>
+  void run(SRC_TYPE &src, const N_TYPE nFrames, FUNC &func);
+
+private:
+  T boundaryVal; // Boundary value for AC_BOUNDARY mode
+  ac_frame_flags<in_type> frameIn; // Frame flag decoder for the flag-driven forms of run() on a channel
+
+  // Read the first pixel of a channel of flagged pixels ahead, so that each loop iteration reads one pixel...
+  template<class CHAN_TYPE>
+  void framePrime(CHAN_TYPE &streamIn, const void *) {
+    if (!frameIn.primed()) {
+      AC_PERF_READ(streamIn);
+      frameIn.prime(streamIn);
+    }
+  }
+  // ... a flag source reads its own pixels.
+  template<class SRC_TYPE>
+  void framePrime(SRC_TYPE &src, const ac_stencil_2d_flag_source *) { }
+
+  // Read one pixel and its frame flags, from a channel of flagged pixels...
+  template<class CHAN_TYPE>
+  void frameRead(CHAN_TYPE &streamIn, const void *, in_type &pix, bool &sof, bool &eof, bool &sol, bool &eol) {
+    AC_PERF_READ(streamIn);
+    frameIn.read(streamIn, pix, sof, eof, sol, eol);
+  }
+  // ... or from a flag source, which counts its own channel reads.
+  template<class SRC_TYPE>
+  void frameRead(SRC_TYPE &src, const ac_stencil_2d_flag_source *, in_type &pix, bool &sof, bool &eof, bool &sol, bool &eol) {
+    src.read(pix, sof, eof, sol, eol);
+  }
+};
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class FUNC, int AC_PPC>
+template<class CHAN_TYPE, class W_TYPE, class H_TYPE>
+void ac_stencil_2d<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, FUNC, AC_PPC>::run(
+  CHAN_TYPE           &streamIn, // Input stream of in_type words, AC_PPC pixels per word, or input source
+  const W_TYPE        widthIn,   // Frame width, in pixels
+  const H_TYPE        heightIn,  // Frame height
+  FUNC                &func      // Called for each valid window
+)
+{
+  run(streamIn, widthIn, heightIn, ac_int<1, false>(1), func);
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class FUNC, int AC_PPC>
+template<class CHAN_TYPE, class W_TYPE, class H_TYPE, class N_TYPE>
+void ac_stencil_2d<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, FUNC, AC_PPC>::run(
+  CHAN_TYPE           &streamIn, // Input stream of in_type words, AC_PPC pixels per word, or input source
+  const W_TYPE        widthIn,   // Frame width, in pixels
+  const H_TYPE        heightIn,  // Frame height
+  const N_TYPE        nFrames,   // Number of frames streamed back to back
+  FUNC                &func      // Called for each valid window
+)
+{
+  #ifndef __SYNTHESIS__
+  assert(widthIn%AC_PPC == 0);
+  assert(nFrames > 0);
+  #endif
+  const W_TYPE widthWords = widthIn/AC_PPC;
+
+  // As in the hand-written kernel loops, the window is local to the call. It is not reset between the
+  // frames of the call: the sof/eof flags keep the boundary processing of consecutive frames apart.
+  window_type acWindObj(boundaryVal);
+
+  H_TYPE i = 0;
+  W_TYPE j = 0;
+  N_TYPE framesIn = 0, framesOut = 0;
+
+  bool inRead = true, lastOut = false;
+
+  #pragma hls_pipeline_init_interval 1
+  STENCIL_PROC_LOOP: do {
+    AC_PERF_ITER();
+    in_type pixIn = in_type(0);
+    if (inRead) {
+      pixIn = ac_stencil_2d_read<in_type>(streamIn, &streamIn);
+    } else {
+      AC_PERF_FLUSH();
+    }
+    // Calculate sof, eof, sol and eol based on image coordinates.
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == widthWords - 1);
+    bool eof = (i == heightIn - 1) && eol;
+    acWindObj.write(pixIn, sof, eof, sol, eol);
+    if (eof) {
+      framesIn++;
+      if (framesIn == nFrames) {
+        inRead = false; // Stop reading input channel after the valid region of the last frame.
+      }
+    }
+    j++;
+    if (j == widthWords) {
+      j = 0;
+      i++;
+      if (i == heightIn) {
+        i = 0;
+      }
+    }
+
+    bool sofOut, eofOut, solOut, eolOut;
+    acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (acWindObj.valid()) {
+      AC_PERF_VALID();
+      func(acWindObj, sofOut, eofOut, solOut, eolOut);
+    } else {
+      AC_PERF_RAMPUP();
+    }
+    if (eofOut) {
+      framesOut++;
+      lastOut = (framesOut == nFrames);
+    }
+  } while (!lastOut); // Stop processing once the output of the last frame has been read.
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class FUNC, int AC_PPC>
+void ac_stencil_2d<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, FUNC, AC_PPC>::run(
+  ac_channel<in_type> &streamIn, // Input stream, with TUSER/TLAST flags
+  FUNC                &func      // Called for each valid window
+)
+{
+  run(streamIn, ac_int<1, false>(1), func);
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class FUNC, int AC_PPC>
+template<class SRC_TYPE, class N_TYPE>
+void ac_stencil_2d<T, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE, FUNC, AC_PPC>::run(
+  SRC_TYPE            &src,      // Input stream, with TUSER/TLAST flags, or flag source
+  const N_TYPE        nFrames,   // Number of frames streamed back to back, all of the same width
+  FUNC                &func      // Called for each valid window
+)
+{
+  #ifndef __SYNTHESIS__
+  assert(AC_PPC == 1);
+  assert(nFrames > 0);
+  #endif
+  window_type acWindObj(boundaryVal);
+
+  // The width of the frames is measured while they are read, and is used to generate the sol/eol flags of the
+  // dummy pixels written after the end of the last frame.
+  ac_int<ac::nbits<AC_NCOL>::val, false> j = 0, widthIn = 0;
+  N_TYPE framesIn = 0, framesOut = 0;
+
+  bool inRead = true, lastOut = false;
+
+  framePrime(src, &src);
+
+  #pragma hls_pipeline_init_interval 1
+  STENCIL_AXIS_PROC_LOOP: do {
+    in_type pixIn = in_type(0);
+    bool sof = false, eof = false, sol, eol;
+    AC_PERF_ITER();
+    if (inRead) {
+      frameRead(src, &src, pixIn, sof, eof, sol, eol);
+      if (eol) {
+        #ifndef __SYNTHESIS__
+        assert((widthIn == 0 || j + 1 == widthIn) && "The frames streamed back to back in one call must have the same width.");
+        #endif
+        widthIn = j + 1;
+      }
+    } else {
+      AC_PERF_FLUSH();
+      sol = (j == 0);
+      eol = (j == widthIn - 1);
+    }
+    acWindObj.write(pixIn, sof, eof, sol, eol);
+    if (eof) {
+      framesIn++;
+      if (framesIn == nFrames) {
+        inRead = false; // Stop reading input channel after the valid region of the last frame.
+      }
+    }
+    if (eol) {
+      j = 0;
+    } else {
+      j++;
+    }
+
+    bool sofOut, eofOut, solOut, eolOut;
+    acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (acWindObj.valid()) {
+      AC_PERF_VALID();
+      func(acWindObj, sofOut, eofOut, solOut, eolOut);
+    } else {
+      AC_PERF_RAMPUP();
+    }
+    if (eofOut) {
+      framesOut++;
+      lastOut = (framesOut == nFrames);
+    }
+  } while (!lastOut); // Stop processing once the output of the last frame has been read.
+}
+
+#endif
@@ -0,0 +1,241 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_trace.h
+//
+// Description:
+//  Opt-in, leveled debug tracing for C simulation. Trace points are written with
+//    AC_TRACE(level, category, msg);
+//  where msg is anything that can be inserted into a std::ostream, including a chain such as
+//  "pixIn = " << pixIn << " out = " << pixOut. A trace point is compiled in when tracing is enabled
+//  (AC_TRACE_LEVEL > 0 and __SYNTHESIS__ not defined), its level is at most AC_TRACE_LEVEL and its
+//  category is in the AC_TRACE_CATEGORIES mask. Both tests are on compile-time constants, and without
+//  AC_TRACE_LEVEL, or under __SYNTHESIS__, AC_TRACE expands to nothing, so disabled tracing costs nothing.
+//
+//  Levels (AC_TRACE_LEVEL):
+//    AC_TRACE_OFF   (0, default), AC_TRACE_ERROR (1), AC_TRACE_WARN (2), AC_TRACE_INFO (3),
+//    AC_TRACE_DEBUG (4, e.g. state dumps), AC_TRACE_PIXEL (5, one or more records per pixel)
+//  Categories (AC_TRACE_CATEGORIES, all by default):
+//    AC_TRACE_CAT_BUFFER (ac_buffer_2d, ac_linebuf), AC_TRACE_CAT_WINDOW (window classes),
+//    AC_TRACE_CAT_GAMMA (ac_gamma), AC_TRACE_CAT_USER (user code)
+//
+//  Each record is one line:
+//    AC_TRACE level=DEBUG cat=gamma <msg>
+//  Records go to one of three sinks:
+//    - a ring buffer of the last AC_TRACE_RING_SIZE (4096 by default) records (the default), which is
+//      written out with ac_trace_dump(). A long simulation only keeps the records before a failure.
+//    - a file, selected with ac_trace_set_file(path)
+//    - a stream, selected with ac_trace_set_stream(os)
+//
+// Usage:
+//    // On the compiler command line, e.g. -DAC_TRACE_LEVEL=5 -DAC_TRACE_CATEGORIES=AC_TRACE_CAT_GAMMA, or:
+//    #define AC_TRACE_LEVEL AC_TRACE_PIXEL
+//    #define AC_TRACE_CATEGORIES AC_TRACE_CAT_GAMMA
+//    #include <ac_ipl/ac_gamma.h>
+//    ...
+//    ac_trace_set_file("gamma_trace.txt"); // optional, the ring buffer is used otherwise
+//    ...                                   // run the design
+//    ac_trace_dump(std::cerr);             // last records of the ring buffer
+//
+//    // In a block:
+//    AC_TRACE(AC_TRACE_PIXEL, AC_TRACE_CAT_GAMMA, "RGB_IN " << pixIn);
+//
+//    // Multi-statement dumps are guarded with AC_TRACE_ON:
+//    #if AC_TRACE_ON
+//    std::ostringstream row;
+//    ...
+//    AC_TRACE(AC_TRACE_DEBUG, AC_TRACE_CAT_BUFFER, row.str());
+//    #endif
+//
+// Notes:
+//  - AC_TRACE_LEVEL, AC_TRACE_CATEGORIES and AC_TRACE_RING_SIZE must be defined before the first include
+//    of a library header, and the same in every translation unit.
+//  - The sinks are global. With AC_DATAFLOW_THREADS (see ac_dataflow.h), the records of concurrent blocks
+//    are serialized; the other functions must not be called while a design runs.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_TRACE_H
+#define __AC_TRACE_H
+
+#define AC_TRACE_OFF   0
+#define AC_TRACE_ERROR 1
+#define AC_TRACE_WARN  2
+#define AC_TRACE_INFO  3
+#define AC_TRACE_DEBUG 4
+#define AC_TRACE_PIXEL 5
+
+#define AC_TRACE_CAT_BUFFER (1<<0)
+#define AC_TRACE_CAT_WINDOW (1<<1)
+#define AC_TRACE_CAT_GAMMA  (1<<2)
+#define AC_TRACE_CAT_USER   (1<<30)
+
+#ifndef AC_TRACE_LEVEL
+#define AC_TRACE_LEVEL AC_TRACE_OFF
+#endif
+
+#ifndef AC_TRACE_CATEGORIES
+#define AC_TRACE_CATEGORIES (~0)
+#endif
+
+#ifndef AC_TRACE_RING_SIZE
+#define AC_TRACE_RING_SIZE 4096
+#endif
+
+#if (AC_TRACE_LEVEL > AC_TRACE_OFF) && !defined(__SYNTHESIS__)
+#define AC_TRACE_ON 1
+#else
+#define AC_TRACE_ON 0
+#endif
+
+#if AC_TRACE_ON
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef AC_DATAFLOW_THREADS
+#include <mutex>
+#endif
+
+class ac_trace_sink
+{
+public:
+  static ac_trace_sink &get() {
+    static ac_trace_sink s;
+    return s;
+  }
+
+  void emit(int level, int category, const std::string &msg) {
+#ifdef AC_DATAFLOW_THREADS
+    std::lock_guard<std::mutex> lock(mutex_);
+#endif
+    std::ostringstream rec;
+    rec << "AC_TRACE level=" << level_name(level) << " cat=" << category_name(category) << " " << msg;
+    if (os_) {
+      *os_ << rec.str() << std::endl;
+      return;
+    }
+    if (ring_.size() < AC_TRACE_RING_SIZE) {
+      ring_.push_back(rec.str());
+    } else {
+      ring_[head_] = rec.str();
+      head_ = (head_ + 1) % AC_TRACE_RING_SIZE;
+    }
+    records_++;
+  }
+
+  // Records in the ring buffer, oldest first.
+  void dump(std::ostream &os) const {
+    for (unsigned i = 0; i < ring_.size(); i++) {
+      os << ring_[(head_ + i) % ring_.size()] << std::endl;
+    }
+  }
+
+  void clear() {
+    ring_.clear();
+    head_ = 0;
+    records_ = 0;
+  }
+
+  void set_stream(std::ostream *os) {
+    if (file_.is_open()) { file_.close(); }
+    os_ = os;
+  }
+
+  bool set_file(const char *path) {
+    if (file_.is_open()) { file_.close(); }
+    file_.open(path);
+    os_ = file_.is_open() ? &file_ : 0;
+    return os_ != 0;
+  }
+
+  // Records written to the ring buffer since the last clear(), including the overwritten ones.
+  unsigned long long records() const { return records_; }
+
+private:
+  ac_trace_sink() : os_(0), head_(0), records_(0) { }
+
+  static const char *level_name(int level) {
+    switch (level) {
+      case AC_TRACE_ERROR: return "ERROR";
+      case AC_TRACE_WARN:  return "WARN";
+      case AC_TRACE_INFO:  return "INFO";
+      case AC_TRACE_DEBUG: return "DEBUG";
+      default:             return "PIXEL";
+    }
+  }
+
+  static const char *category_name(int category) {
+    switch (category) {
+      case AC_TRACE_CAT_BUFFER: return "buffer";
+      case AC_TRACE_CAT_WINDOW: return "window";
+      case AC_TRACE_CAT_GAMMA:  return "gamma";
+      default:                  return "user";
+    }
+  }
+
+  std::ostream *os_;               // File or stream sink, 0 for the ring buffer
+  std::ofstream file_;
+  std::vector<std::string> ring_;
+  unsigned head_;                  // Oldest record once the ring buffer is full
+  unsigned long long records_;
+#ifdef AC_DATAFLOW_THREADS
+  std::mutex mutex_;               // Serializes emit() for concurrent blocks
+#endif
+};
+
+// Write the records to a stream instead of the ring buffer.
+inline void ac_trace_set_stream(std::ostream &os) { ac_trace_sink::get().set_stream(&os); }
+// Write the records to a file instead of the ring buffer. Returns false if the file can't be opened.
+inline bool ac_trace_set_file(const char *path) { return ac_trace_sink::get().set_file(path); }
+// Go back to the ring buffer (the default sink).
+inline void ac_trace_set_ring() { ac_trace_sink::get().set_stream(0); }
+inline void ac_trace_dump(std::ostream &os = std::cout) { ac_trace_sink::get().dump(os); }
+inline void ac_trace_clear() { ac_trace_sink::get().clear(); }
+
+#define AC_TRACE(level, category, msg) \
+  do { \
+    if ((level) <= AC_TRACE_LEVEL && ((category) & (AC_TRACE_CATEGORIES))) { \
+      std::ostringstream acTraceMsg_; \
+      acTraceMsg_ << msg; \
+      ac_trace_sink::get().emit(level, category, acTraceMsg_.str()); \
+    } \
+  } while (0)
+
+#else
+
+#define AC_TRACE(level, category, msg)
+
+#endif
+
+#endif
@@ -34,6 +34,10 @@
 #include "ac_window_1d_flag.h"
 #include "ac_window_2d_flag.h"
 #include "ac_window_2d_flag_flush_support.h"
+#include "ac_window_2d_flag_ppc.h"
+#include "ac_window_2d_flag_mc.h"
+#include "ac_window_2d_subview.h"
+#include "ac_window_2d_dilated.h"
 #include "ac_window_1d_stream.h"
 #include "ac_window_2d_stream.h"
 #include "ac_window_1d_array.h"
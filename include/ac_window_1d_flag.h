@@ -43,38 +43,171 @@ enum ac_window_mode { AC_CLIP       = 1<<0,
                       AC_BOUNDARY   = 1<<3,
                       AC_SINGLEPORT = 1<<8,
                       AC_DUALPORT   = 1<<9,
+                      AC_PACK4      = 1<<10,
+                      AC_PACK8      = 1<<11,
+                      AC_PACK16     = 1<<12,
+                      AC_STRIPE     = 1<<13,
                       AC_SYM_INDEX  = 1<<16,
                       AC_LIN_INDEX  = 1<<17,
                       AC_NO_REWIND  = 1<<24,
                       AC_REWIND     = 1<<25
                     };
 
+// Boundary processing of one window dimension, shared by ac_window_1d_flag and ac_window_2d_flag. w[] holds
+// the AC_N taps of the window (AC_WN, plus one for an even sized mirrored window), st[i] is set when tap i
+// holds the first pixel of a line (frame) and en[i+AC_EOFS] when tap i holds the last one. There is one
+// specialization per boundary mode bit, so only the muxes of the selected mode are instantiated. All taps
+// are selected at compile-time constant indices: a mirrored tap i is a priority mux over the taps 2*j-i of
+// the flags j between tap i and the center, instead of a read of tap 2*m-i at a run-time reflection point
+// m. The center tap AC_WN/2 has no mux.
+template<int AC_WN, int AC_N, int AC_EOFS, int AC_BMODE>
+struct ac_window_edge_mux
+{
+  // Mode bit not set: the taps are left as shifted in.
+  template<class T> static void apply(T *w, const bool *st, const bool *en, const T &bval) {}
+};
+
+template<int AC_WN, int AC_N, int AC_EOFS>
+struct ac_window_edge_mux<AC_WN, AC_N, AC_EOFS, AC_CLIP>
+{
+  template<class T> static void apply(T *w, const bool *st, const bool *en, const T &bval) {
+    bool s = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //lower clipping
+    #endif
+    for (int i=AC_WN/2-1; i>=0; i--) {
+      s |= st[i+1];
+      w[i] = s ? w[i+1] : w[i];
+    }
+
+    bool e = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //upper clipping
+    #endif
+    for (int i=AC_WN/2+1; i<AC_WN; i++) {
+      e |= en[i-1+AC_EOFS];
+      w[i] = e ? w[i-1] : w[i];
+    }
+  }
+};
+
+template<int AC_WN, int AC_N, int AC_EOFS>
+struct ac_window_edge_mux<AC_WN, AC_N, AC_EOFS, AC_MIRROR>
+{
+  template<class T> static void apply(T *w, const bool *st, const bool *en, const T &bval) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //lower mirroring
+    #endif
+    for (int i=AC_WN/2-1; i>=0; i--) {
+      T v = w[i];
+      // The flag nearest to tap i is the reflection point, so it is checked last.
+      #ifdef __SYNTHESIS__
+      #pragma hls_unroll yes
+      #endif
+      for (int j=AC_WN/2; j>i; j--) {
+        #pragma hls_waive CNS
+        if (st[j] && 2*j-i < AC_N) { v = w[2*j-i]; }
+      }
+      w[i] = v;
+    }
+
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //upper mirroring
+    #endif
+    for (int i=AC_WN/2+1; i<AC_N; i++) {
+      T v = w[i];
+      #ifdef __SYNTHESIS__
+      #pragma hls_unroll yes
+      #endif
+      for (int j=AC_WN/2; j<i; j++) {
+        #pragma hls_waive CNS
+        if (en[j+AC_EOFS] && 2*j-i >= 0) { v = w[2*j-i]; }
+      }
+      w[i] = v;
+    }
+  }
+};
+
+template<int AC_WN, int AC_N, int AC_EOFS>
+struct ac_window_edge_mux<AC_WN, AC_N, AC_EOFS, AC_BOUNDARY>
+{
+  template<class T> static void apply(T *w, const bool *st, const bool *en, const T &bval) {
+    bool s = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //lower boundary
+    #endif
+    for (int i=AC_WN/2-1; i>=0; i--) {
+      s |= st[i+1];
+      w[i] = s ? bval : w[i];
+    }
+
+    bool e = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //upper boundary
+    #endif
+    for (int i=AC_WN/2+1; i<AC_WN; i++) {
+      e |= en[i-1+AC_EOFS];
+      w[i] = e ? bval : w[i];
+    }
+  }
+};
+
+// Applies the boundary muxes of the AC_CLIP, AC_MIRROR and AC_BOUNDARY bits of AC_WMODE to w[]. In
+// simulation, the interior path (no st/en flag set next to the center, where every mux selects w[i]) returns
+// early and w[] stays a plain copy of the shifted data.
+template<int AC_WN, int AC_N, int AC_EOFS, int AC_WMODE, class T>
+void ac_window_edge(T *w, const bool *st, const bool *en, const T &bval)
+{
+  #ifndef __SYNTHESIS__
+  bool edge = false;
+  for (int i=1; i<=AC_WN/2; i++) { edge |= st[i]; }
+  for (int i=AC_WN/2; i<AC_N-1; i++) { edge |= en[i+AC_EOFS]; }
+  if (!edge) { return; }
+  #endif
+
+  ac_window_edge_mux<AC_WN, AC_N, AC_EOFS, AC_WMODE&AC_CLIP>::apply(w, st, en, bval);
+  ac_window_edge_mux<AC_WN, AC_N, AC_EOFS, AC_WMODE&AC_MIRROR>::apply(w, st, en, bval);
+  ac_window_edge_mux<AC_WN, AC_N, AC_EOFS, AC_WMODE&AC_BOUNDARY>::apply(w, st, en, bval);
+}
+
 template<class T, int AC_WN, int AC_WMODE = AC_WIN>
 class ac_window_1d_flag
 {
   enum {AC_EVEN_ROW = ((AC_WN%2)==0)};
 public:
   ac_window_1d_flag();
+  ac_window_1d_flag(T bval);
   T &operator[]      (int i);
   const T &operator[](int i) const ;
   void write(T src, bool sol, bool eol);
+  // Also delays sof and eof along with the window, e.g. when used as the horizontal stage of a separable
+  // filter that is fed with the vertical columns of ac_window_2d_flag.
+  void write(T src, bool sof, bool eof, bool sol, bool eol);
   void readFlags(bool &solOut, bool &eolOut) ;
+  void readFlags(bool &sofOut, bool &eofOut, bool &solOut, bool &eolOut) ;
   bool valid();
 
+  // Latency, see ac_resource.h: the first valid window of a line is output once LATENCY_PIXELS pixels of
+  // the line have been written.
+  enum {
+    LATENCY_LINES = 0,
+    LATENCY_PIXELS = (AC_WMODE&AC_WIN) ? AC_WN-1 : AC_WN/2
+  };
+
 private:
   T   data_[AC_WN];             // This array stores the input samples
   T   wout_[AC_WN];             // This array is what really gets read
   bool sol_[AC_WN];  // Start of line control
   bool eol_[AC_WN];  // End of line control
+  bool sof_[AC_WN];  // Start of frame control
+  bool eof_[AC_WN];  // End of frame control
   bool rampup_;              // Has the window ramped up?
-  bool s_;                    // start bit set when start detected in shift reg
-  bool e_;                    // end bit set when start detected in shift reg
-  int m_;                     // Mirror center reflection point
+  T boundaryVal;              // constant for boundary condition
 };
 
-// The only defined CTOR
+// Default CTOR. For AC_BOUNDARY, the boundary value is 0.
 template<class T, int AC_WN, int AC_WMODE> ac_window_1d_flag<T, AC_WN, AC_WMODE>::ac_window_1d_flag():
-  rampup_(false), s_(false), e_(false), m_(0)
+  rampup_(false), boundaryVal(0)
 {
   #ifdef __SYNTHESIS__
   #pragma hls_unroll yes
@@ -82,6 +215,23 @@ template<class T, int AC_WN, int AC_WMODE> ac_window_1d_flag<T, AC_WN, AC_WMODE>
   for (int i=0; i<AC_WN; i++) {
     sol_[i] = 0;
     eol_[i] = 0;
+    sof_[i] = 0;
+    eof_[i] = 0;
+  }
+}
+
+// CTOR with the boundary value used for AC_BOUNDARY.
+template<class T, int AC_WN, int AC_WMODE> ac_window_1d_flag<T, AC_WN, AC_WMODE>::ac_window_1d_flag(T bval):
+  rampup_(false), boundaryVal(bval)
+{
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_WN; i++) {
+    sol_[i] = 0;
+    eol_[i] = 0;
+    sof_[i] = 0;
+    eof_[i] = 0;
   }
 }
 
@@ -125,51 +275,7 @@ void ac_window_1d_flag<T, AC_WN, AC_WMODE>::write(T src, bool sol, bool eol)
   for (int i=0; i<AC_WN; i++)
   { wout_[i] = data_[i]; }
 
-  #pragma hls_waive CNS
-  if (AC_WMODE&AC_CLIP) {
-    s_ = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //lower clipping
-    #endif
-    for (int i=AC_WN/2-1; i>=0; i--) {
-      s_ |= sol_[i+1];
-      wout_[i] = s_ ? wout_[i+1] : wout_[i];
-    }
-
-    e_ = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //upper clipping
-    #endif
-    for (int i=AC_WN/2+1; i< AC_WN; i++) {
-      e_ |= eol_[i-1];
-      wout_[i] = e_ ? wout_[i-1] : wout_[i];
-    }
-  }
-
-  #pragma hls_waive CNS
-  if (AC_WMODE&AC_MIRROR) {
-    s_ = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //lower clipping
-    #endif
-    for (int i=AC_WN/2-1; i>=0; i--) {
-      s_ |= sol_[i+1];
-      if (sol_[i+1]==1)
-      { m_ = i+1; }
-      wout_[i] = s_ ? wout_[m_*2 - i] : wout_[i];
-    }
-
-    e_ = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //upper clipping
-    #endif
-    for (int i=AC_WN/2+1; i< AC_WN; i++) {
-      e_ |= eol_[i-1];
-      if (eol_[i-1]==1)
-      { m_ = i-1; }
-      wout_[i] = e_ ? wout_[m_*2-i] : wout_[i];
-    }
-  }
+  ac_window_edge<AC_WN, AC_WN, 0, AC_WMODE>(wout_, sol_, eol_, boundaryVal);
 
   #pragma hls_waive CNS
   if (AC_WMODE&AC_WIN) { //No clipping or mirroring means that prefill takes AC_WN-1 iterations
@@ -180,6 +286,39 @@ void ac_window_1d_flag<T, AC_WN, AC_WMODE>::write(T src, bool sol, bool eol)
 
 }
 
+template<class T, int AC_WN, int AC_WMODE>
+void ac_window_1d_flag<T, AC_WN, AC_WMODE>::write(T src, bool sof, bool eof, bool sol, bool eol)
+{
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_WN-1; i++)
+  { sof_[i] = sof_[i+1]; }
+  sof_[AC_WN-1] = sof;
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_WN-1; i++)
+  { eof_[i] = eof_[i+1]; }
+  eof_[AC_WN-1] = eof;
+
+  write(src, sol, eol);
+}
+
+template<class T, int AC_WN, int AC_WMODE>
+void ac_window_1d_flag<T, AC_WN, AC_WMODE>::readFlags(bool &sofOut, bool &eofOut, bool &solOut, bool &eolOut)
+{
+  if (AC_WMODE&AC_WIN) {
+    sofOut = sof_[0];
+    eofOut = eof_[0];
+  } else {
+    sofOut = sof_[AC_WN/2-AC_EVEN_ROW];
+    eofOut = eof_[AC_WN/2];
+  }
+  readFlags(solOut, eolOut);
+}
+
 template<class T, int AC_WN, int AC_WMODE>
 void ac_window_1d_flag<T, AC_WN, AC_WMODE>::readFlags(bool &solOut, bool &eolOut)
 {
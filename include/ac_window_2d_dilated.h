@@ -0,0 +1,138 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_window_2d_dilated.h
+//
+// Description:
+//  Dilated (a-trous) taps of a 2D window. ac_window_2d_dilated gives read access to every AC_DIL-th row
+//  and column of a window, centered on the window center. A K x K tap pattern with dilation AC_DIL covers a
+//  footprint of (K-1)*AC_DIL+1 rows and columns, so e.g. a 5x5 filter with AC_DIL = 2 or 4 covers a 9x9 or
+//  17x17 neighborhood with 25 multiplier-adders instead of 81 or 289. This is the access pattern of
+//  a-trous wavelet transforms and of multi-scale smoothing.
+//
+//  The dilated view is placed on a dense window of the full footprint size, which provides the line
+//  buffers for the (K-1)*AC_DIL lines spanned by the taps. With AC_CLIP, AC_MIRROR and AC_BOUNDARY, each
+//  tap holds the same value as the corresponding pixel of the dense window, so the boundary processing
+//  is done at pixel (not tap) granularity. The view shares the valid() and readFlags() state of the
+//  dense window.
+//
+// Usage:
+//    // 5x5 taps, dilation 2: 9x9 footprint
+//    typedef ac_window_2d_flag<ac_int<8,false>, 9, 9, 1920, AC_MIRROR> windType;
+//    windType win;
+//    ...
+//    win.write(pix, sof, eof, sol, eol);
+//    if (win.valid()) {
+//      ac_window_2d_dilated<windType, 2> taps(win);
+//      out = coeff[0][0]*taps(-2, -2) + ... + coeff[4][4]*taps(2, 2);
+//    }
+//
+// Notes:
+//  - The window size minus one must be a multiple of 2*AC_DIL in both dimensions, so that the number of
+//    taps is odd and the tap pattern is centered on the window center. E.g. a 7x7 window with AC_DIL = 2
+//    would have 4x4 taps, and is rejected at compile time (see ac_window_2d_dilated_fits).
+//  - Indexing follows the window mode of the dense window: -ROWS/2 .. ROWS/2 by default, or
+//    0 .. ROWS-1 with AC_LIN_INDEX, where ROWS and COLS are the number of taps.
+//  - Only the arithmetic scales with the number of taps. The dense window is a shift chain, so every
+//    pixel of the footprint stays in a register whether it is read or not, and the boundary muxes are
+//    those of the dense window: a 5x5 filter with AC_DIL = 4 still keeps 17x17 = 289 window registers,
+//    and 16 line buffers of W_MAX pixels.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_WINDOW_2D_DILATED_H
+#define __AC_WINDOW_2D_DILATED_H
+
+#include "ac_window_1d_flag.h"
+
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+// The design uses static_asserts, which are only supported by C++11 or later compiler standards.
+// The #error directive below informs the user if they're not using those standards.
+#if (defined(__GNUC__) && (__cplusplus < 201103L))
+#error Please use C++11 or a later standard for compilation.
+#endif
+#if (defined(_MSC_VER) && (_MSC_VER < 1920) && !defined(__EDG__))
+#error Please use Microsoft VS 2019 or a later standard for compilation.
+#endif
+
+// value is true if AC_DIL dilated taps can be centered on a WINDOW_TYPE window: AC_DIL >= 1, and the
+// window size minus one is a multiple of 2*AC_DIL in both dimensions.
+template<class WINDOW_TYPE, int AC_DIL>
+struct ac_window_2d_dilated_fits
+{
+  enum {
+    DIL2 = AC_DIL >= 1 ? 2*AC_DIL : 1,
+    value = AC_DIL >= 1 && (WINDOW_TYPE::ROWS - 1)%DIL2 == 0 && (WINDOW_TYPE::COLS - 1)%DIL2 == 0
+  };
+};
+
+template<class WINDOW_TYPE, int AC_DIL>
+class ac_window_2d_dilated
+{
+  static_assert(ac_window_2d_dilated_fits<WINDOW_TYPE, AC_DIL>::value,
+                "The window size minus one must be a multiple of 2*AC_DIL in both dimensions.");
+
+public:
+  typedef typename WINDOW_TYPE::value_type value_type;
+  enum {
+    ROWS = (WINDOW_TYPE::ROWS - 1)/AC_DIL + 1, // Number of taps
+    COLS = (WINDOW_TYPE::COLS - 1)/AC_DIL + 1,
+    WMODE = WINDOW_TYPE::WMODE
+  };
+
+  ac_window_2d_dilated(const WINDOW_TYPE &w) : wind(w) { }
+  const value_type &operator()(int r, int c) const;
+
+private:
+  const WINDOW_TYPE &wind;
+};
+
+template<class WINDOW_TYPE, int AC_DIL>
+inline const typename WINDOW_TYPE::value_type &ac_window_2d_dilated<WINDOW_TYPE,AC_DIL>::operator()(int r, int c) const
+{
+  #ifndef __SYNTHESIS__
+  if (!(WMODE&AC_LIN_INDEX)) {
+    assert((-ROWS/2 <= r) && (r <= ROWS/2));
+    assert((-COLS/2 <= c) && (c <= COLS/2));
+  } else {
+    assert((0 <= r) && (r < ROWS));
+    assert((0 <= c) && (c < COLS));
+  }
+  #endif
+  // With AC_LIN_INDEX, tap 0 is on the first row/column of the dense window, so the same scaling applies to
+  // both index modes.
+  return wind(r*AC_DIL, c*AC_DIL);
+}
+
+#endif
@@ -49,7 +49,11 @@
 using namespace std;
 #endif
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
+// ST is the line buffer storage type. Pixels are converted to ST when they are written to the window, with
+// the quantization and overflow modes of ST (e.g. ac_fixed<12,8,false,AC_RND,AC_SAT>), and converted back to T
+// when read, so that line buffer RAM can be narrower than the datapath type T. All rows of the window,
+// including the row being written, hold the converted values. By default, ST is T and no conversion is done.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST = T>
 class ac_window_2d_flag
 {
 public:
@@ -63,6 +67,23 @@ public:
   bool valid();
   void readFlags(bool &sof, bool &eof, bool &sol, bool &eol);
   void rewind();
+  // Line-at-a-time interface. write_line() writes the n pixels of one line of the frame, and flush() writes
+  // lines of n dummy pixels after the last line until the end-of-frame window has been output. Each valid
+  // window is passed to func(window, sof, eof, sol, eol), with the flags returned by readFlags(). Both
+  // functions return true once the end-of-frame window has been output.
+  template<class FUNC> bool write_line(const T *row, int n, bool sof, bool eof, FUNC &func);
+  template<class FUNC> bool flush(int n, FUNC &func);
+  // Separable filter support. After write(), column(r) is the vertical window column of the pixel just
+  // written, with the vertical boundary processing applied (r = -AC_WN_ROW/2 .. AC_WN_ROW/2, or 0 ..
+  // AC_WN_ROW-1 with AC_LIN_INDEX). A vertical 1D filter of the column can be written to an
+  // ac_window_1d_flag<.., AC_WN_COL, ..> together with the flags from readColumnFlags(), while
+  // column_valid() is true, so that a separable K x K filter takes 2K multiplies instead of K*K.
+  const T &column(int r) const;
+  bool column_valid();
+  void readColumnFlags(bool &sof, bool &eof, bool &sol, bool &eol);
+  // Window geometry, e.g. for ac_window_2d_subview.
+  typedef T value_type;
+  enum { ROWS = AC_WN_ROW, COLS = AC_WN_COL, WMODE = AC_WMODE };
   enum {AC_EVEN_ROW = ((AC_WN_ROW%2)==0)};
   enum {AC_EVEN_COL = ((AC_WN_COL%2)==0)};
   // If the row/column size is even and the windowing mode is set to AC_MIRROR, we have
@@ -72,8 +93,24 @@ public:
   enum {
     logAC_NCOL = ac::nbits< AC_NCOL >::val
   };
+  typedef ac_buffer_2d<T,AC_NCOL,AC_WN_ROW + PLUS_1_MIRROR_ROW,AC_WMODE,ST> vwind_type;
+  // Resources and latency, see ac_resource.h. The first valid window of a frame is output once
+  // LATENCY_LINES*width + LATENCY_PIXELS pixels have been written.
+  enum {
+    LB_LINES = vwind_type::LB_LINES,
+    LB_WORDS = vwind_type::LB_WORDS,
+    LB_WORD_BITS = vwind_type::LB_WORD_BITS,
+    LB_BITS = vwind_type::LB_BITS,
+    LB_RAMS = vwind_type::LB_RAMS,
+    WINDOW_BITS = (AC_WN_ROW + PLUS_1_MIRROR_ROW)*(AC_WN_COL + PLUS_1_MIRROR_COL)*ac_resource_bits<T>::val,
+    LATENCY_LINES = (AC_WMODE&AC_WIN) ? AC_WN_ROW-1 : AC_WN_ROW/2 - int((AC_WMODE&AC_CLIP) && AC_EVEN_ROW),
+    LATENCY_PIXELS = (AC_WMODE&AC_WIN) ? AC_WN_COL-1 : AC_WN_COL/2 - int((AC_WMODE&AC_CLIP) && AC_EVEN_COL)
+  };
   void writeInt(T src, bool sol, bool eol);
-  ac_buffer_2d<T,AC_NCOL,AC_WN_ROW + PLUS_1_MIRROR_ROW,AC_WMODE> vWind;  // Vertical window
+  void writeVert(T src, bool sof, bool sol);
+  void writeInterior(T src);
+  template<class FUNC> bool outputWindow(FUNC &func);
+  vwind_type vWind;  // Vertical window
 
   T   data_[AC_WN_ROW + PLUS_1_MIRROR_ROW][AC_WN_COL + PLUS_1_MIRROR_COL];             // This array stores the input samples
   T   woutH_[AC_WN_ROW + PLUS_1_MIRROR_ROW][AC_WN_COL + PLUS_1_MIRROR_COL];             // This array is what really gets read
@@ -92,6 +129,7 @@ public:
   bool eolOut;  // End of line output control
 
   bool rampup_;              // Has the window ramped up?
+  bool vrampup_;             // Has the vertical window ramped up?
   bool s;                   // start bit set when start detected in shift reg
   bool e;                   // end bit set when start detected in shift reg
   int m;
@@ -100,8 +138,8 @@ public:
 };
 
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::ac_window_2d_flag():
-  addr(0), rampup_(false), s(false), e(false), m(0)
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST> ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE,ST>::ac_window_2d_flag():
+  addr(0), rampup_(false), vrampup_(false), s(false), e(false), m(0)
 {
 
   #ifdef __SYNTHESIS__
@@ -141,8 +179,8 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_wi
   }
 }
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::ac_window_2d_flag(T bval):
-  addr(0), rampup_(false), s(false), e(false), m(0)
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST> ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE,ST>::ac_window_2d_flag(T bval):
+  addr(0), rampup_(false), vrampup_(false), s(false), e(false), m(0)
 {
 
   #ifdef __SYNTHESIS__
@@ -156,8 +194,6 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_wi
   #endif
   for (int i=0; i<AC_WN_ROW + PLUS_1_MIRROR_ROW; i++) {
     wout_[i] = T(0);
-    sofOut_[i] = 0;
-    eofOut_[i] = 0;
     sof_[i] = 0;
     eof_[i] = 0;
   }
@@ -167,6 +203,8 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_wi
   for (int i=0; i<AC_WN_COL + PLUS_1_MIRROR_COL; i++) {
     sol_[i] = 0;
     eol_[i] = 0;
+    sofOut_[i] = 0;
+    eofOut_[i] = 0;
   }
   boundaryVal = bval;
 
@@ -185,11 +223,12 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_wi
 
 // Reset member variables in order to start with new configurations with different
 // frame sizes.
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-void ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::reset()
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE,ST>::reset()
 {
   addr = 0;
   rampup_ = false;
+  vrampup_ = false;
   s = false;
   e = false;
   m = 0;
@@ -199,8 +238,6 @@ void ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::reset()
   #endif
   for (int i=0; i<AC_WN_ROW + PLUS_1_MIRROR_ROW; i++) {
     wout_[i] = 0;
-    sofOut_[i] = 0;
-    eofOut_[i] = 0;
     sof_[i] = 0;
     eof_[i] = 0;
   }
@@ -211,47 +248,27 @@ void ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::reset()
   for (int i=0; i<AC_WN_COL + PLUS_1_MIRROR_COL; i++) {
     sol_[i] = 0;
     eol_[i] = 0;
+    sofOut_[i] = 0;
+    eofOut_[i] = 0;
   }
 }
 
 // Have we passed the first AC_WN_ROW/2+1 rampup cycles? Is this now valid data?
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-bool ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::valid()
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+bool ac_window_2d_flag<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE,ST>::valid()
 {
   return rampup_;
 };
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::write(T src, bool sof, bool eof, bool sol, bool eol)
+// Vertical stage of write(): writes src to the line buffers and applies the vertical boundary
+// processing to the vertical window output.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::writeVert(T src, bool sof, bool sol)
 {
-  if (sol) {                     // Store sof at start of each new line
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes
-    #endif
-    for (int i=0; i<AC_WN_ROW - 1 + PLUS_1_MIRROR_ROW; i++) {
-      sof_[i] = sof_[i+1];
-    }
-    sof_[AC_WN_ROW - 1 + PLUS_1_MIRROR_ROW] = sof;
-  }
-
-  #ifdef __SYNTHESIS__
-  #pragma hls_unroll yes
-  #endif
-  for (int i=0; i<AC_WN_COL - 1 + PLUS_1_MIRROR_COL; i++) {
-    sofOut_[i] = sofOut_[i+1];
-  }
-
-  #pragma hls_waive CNS
-  if (AC_WMODE&AC_WIN) {
-    sofOut_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL] = sol ? sof_[0]:(bool)0;
-  } else {
-    sofOut_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL] = sol ? sof_[AC_WN_ROW/2 - AC_EVEN_ROW + PLUS_1_MIRROR_ROW + ((AC_WMODE&AC_CLIP)&&AC_EVEN_ROW)]:(bool)0;
-  }
-
   if (sol) {
     #ifndef __SYNTHESIS__
     if (bool(AC_WMODE&AC_SINGLEPORT)) {
-      AC_ASSERT(sof || addr%2 == 0 || addr == AC_NCOL - 1, "eol pixel was not written to singleport RAM. Add an extra iteration to complete the write and avoid UMRs.");
+      AC_ASSERT(sof || addr%int(ac_linebuf_pack<ST, AC_WMODE>::N) == 0 || addr == AC_NCOL - 1, "eol pixel was not written to singleport RAM. Add an extra iteration to complete the write and avoid UMRs.");
     }
     #endif
 
@@ -268,71 +285,39 @@ void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::write(T src, boo
     wout_[i] = vWind[i];
   }
 
-  #pragma hls_waive CNS
-  if (AC_WMODE&AC_CLIP) {
-    s = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes // vertical lower clipping
-    #endif
-    for (int i=AC_WN_ROW/2-1; i>=0; i--) {
-      s |= sof_[i+1];
-      wout_[i] = s ? wout_[i+1] : wout_[i];
-    }
+  // Vertical boundary processing. The eof_ flag of a row is stored one row higher than its sof_ flag.
+  ac_window_edge<AC_WN_ROW, AC_WN_ROW + PLUS_1_MIRROR_ROW, 1, AC_WMODE>(wout_, sof_, eof_, boundaryVal);
+}
 
-    e = false;
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::write(T src, bool sof, bool eof, bool sol, bool eol)
+{
+  if (sol) {                     // Store sof at start of each new line
     #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //  vertical upper clipping
+    #pragma hls_unroll yes
     #endif
-    for (int i=AC_WN_ROW/2+1; i< AC_WN_ROW; i++) {
-      e |= eof_[i];
-      wout_[i] = e ? wout_[i-1] : wout_[i];
+    for (int i=0; i<AC_WN_ROW - 1 + PLUS_1_MIRROR_ROW; i++) {
+      sof_[i] = sof_[i+1];
     }
+    sof_[AC_WN_ROW - 1 + PLUS_1_MIRROR_ROW] = sof;
   }
 
-  #pragma hls_waive CNS
-  if (AC_WMODE&AC_MIRROR) {
-    s = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //  vertical lower clipping
-    #endif
-    for (int i=AC_WN_ROW/2-1; i>=0; i--) {
-      s |= sof_[i+1];
-      if (sof_[i+1]==1) { m = i+1; }
-      wout_[i] = s ? wout_[m*2-i] : wout_[i];
-    }
-
-    e = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //  vertical upper clipping
-    #endif
-    for (int i=AC_WN_ROW/2+1; i< AC_WN_ROW + PLUS_1_MIRROR_ROW; i++) {
-      // !!!!!!!compare againt i instead of i-1 to go handle eol
-      e |= eof_[i];
-      if (eof_[i]==1) { m = i-1; }
-      wout_[i] = e ? wout_[m*2-i] : wout_[i];
-    }
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_WN_COL - 1 + PLUS_1_MIRROR_COL; i++) {
+    sofOut_[i] = sofOut_[i+1];
   }
 
   #pragma hls_waive CNS
-  if (AC_WMODE&AC_BOUNDARY) {
-    s = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes // vertical lower clipping
-    #endif
-    for (int i=AC_WN_ROW/2-1; i>=0; i--) {
-      s |= sof_[i+1];
-      wout_[i] = s ? boundaryVal : wout_[i];
-    }
-
-    e = false;
-    #ifdef __SYNTHESIS__
-    #pragma hls_unroll yes //  vertical upper clipping
-    #endif
-    for (int i=AC_WN_ROW/2+1; i< AC_WN_ROW; i++) {
-      e |= eof_[i];
-      wout_[i] = e ? boundaryVal : wout_[i];
-    }
+  if (AC_WMODE&AC_WIN) {
+    sofOut_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL] = sol ? sof_[0]:(bool)0;
+  } else {
+    sofOut_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL] = sol ? sof_[AC_WN_ROW/2 - AC_EVEN_ROW + PLUS_1_MIRROR_ROW + ((AC_WMODE&AC_CLIP)&&AC_EVEN_ROW)]:(bool)0;
   }
+  if (sofOut_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL]) { vrampup_ = true; } // vertical prefill finished
+
+  writeVert(src, sof, sol);
 
   if (eol) {                     // Store eof at end of each new line
     #ifdef __SYNTHESIS__
@@ -415,71 +400,7 @@ void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::write(T src, boo
       woutH_[j][i] = data_[j][i];
     }
 
-    #pragma hls_waive CNS
-    if (AC_WMODE&AC_CLIP) {
-      s_ = false;
-      #ifdef __SYNTHESIS__
-      #pragma hls_unroll yes // lower clipping
-      #endif
-      for (int i=AC_WN_COL/2-1; i>=0; i--) {
-        s_ |= sol_[i+1];
-        woutH_[j][i] = s_ ? woutH_[j][i+1] : woutH_[j][i];
-      }
-
-      e_ = false;
-      #ifdef __SYNTHESIS__
-      #pragma hls_unroll yes // upper clipping
-      #endif
-      for (int i=AC_WN_COL/2+1; i< AC_WN_COL; i++) {
-        e_ |= eol_[i-1];
-        woutH_[j][i] = e_ ? woutH_[j][i-1] : woutH_[j][i];
-      }
-    }
-
-    #pragma hls_waive CNS
-    if (AC_WMODE&AC_MIRROR) {
-      s_ = false;
-      int m_;
-      #ifdef __SYNTHESIS__
-      #pragma hls_unroll yes // lower clipping
-      #endif
-      for (int i=AC_WN_COL/2 - 1; i>=0; i--) {
-        s_ |= sol_[i+1];
-        if (sol_[i+1]==1) { m_ = i+1; }
-        woutH_[j][i] = s_ ? woutH_[j][m_*2 - i] : woutH_[j][i];
-      }
-
-      e_ = false;
-      #ifdef __SYNTHESIS__
-      #pragma hls_unroll yes // upper clipping
-      #endif
-      for (int i=AC_WN_COL/2+1; i< AC_WN_COL + PLUS_1_MIRROR_COL; i++) {
-        e_ |= eol_[i-1];
-        if (eol_[i-1]==1) { m_ = i-1; }
-        woutH_[j][i] = e_ ? woutH_[j][m_*2-i] : woutH_[j][i];
-      }
-    }
-
-    #pragma hls_waive CNS
-    if (AC_WMODE&AC_BOUNDARY) {
-      s_ = false;
-      #ifdef __SYNTHESIS__
-      #pragma hls_unroll yes // lower clipping
-      #endif
-      for (int i=AC_WN_COL/2-1; i>=0; i--) {
-        s_ |= sol_[i+1];
-        woutH_[j][i] = s_ ? boundaryVal : woutH_[j][i];
-      }
-
-      e_ = false;
-      #ifdef __SYNTHESIS__
-      #pragma hls_unroll yes // upper clipping
-      #endif
-      for (int i=AC_WN_COL/2+1; i< AC_WN_COL; i++) {
-        e_ |= eol_[i-1];
-        woutH_[j][i] = e_ ? boundaryVal : woutH_[j][i];
-      }
-    }
+    ac_window_edge<AC_WN_COL, AC_WN_COL + PLUS_1_MIRROR_COL, 0, AC_WMODE>(woutH_[j], sol_, eol_, boundaryVal);
   }
 
   #pragma hls_waive CNS
@@ -502,8 +423,82 @@ void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::write(T src, boo
 }
 
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-inline  T &ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::operator() (int r, int c)
+// Interior pixel write, used by write_line(). Once the sol and eol of the previous line boundary have been
+// shifted out, the sol_/eol_ and sofOut_/eofOut_ arrays stay zero until the next eol, so the flag shifts
+// and the horizontal boundary processing of write() leave them unchanged and can be skipped.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::writeInterior(T src)
+{
+  writeVert(src, false, false);
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int j=0; j<AC_WN_ROW + PLUS_1_MIRROR_ROW; j++) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int i=0; i<AC_WN_COL - 1 + PLUS_1_MIRROR_COL; i++) {
+      data_[j][i] = data_[j][i+1];
+      woutH_[j][i] = data_[j][i];
+    }
+    data_[j][AC_WN_COL - 1 + PLUS_1_MIRROR_COL] = wout_[j];
+    woutH_[j][AC_WN_COL - 1 + PLUS_1_MIRROR_COL] = wout_[j];
+  }
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+template<class FUNC>
+bool ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::outputWindow(FUNC &func)
+{
+  bool sofOut, eofOut, solOut, eolOut;
+  readFlags(sofOut, eofOut, solOut, eolOut);
+  if (valid()) {
+    func(*this, sofOut, eofOut, solOut, eolOut);
+  }
+  return eofOut;
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+template<class FUNC>
+bool ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::write_line(const T *row, int n, bool sof, bool eof, FUNC &func)
+{
+  #ifndef __SYNTHESIS__
+  assert((n > AC_WN_COL/2) && (n <= AC_NCOL));
+  #endif
+  bool eofOut = false;
+  for (int j=0; j<n; j++) {
+    // The sol_ array is clear of the sol of this line after AC_WN_COL + PLUS_1_MIRROR_COL writes.
+    if (j > AC_WN_COL + PLUS_1_MIRROR_COL && j < n - 1) {
+      writeInterior(row[j]);
+    } else {
+      bool sol = (j == 0);
+      bool eol = (j == n - 1);
+      write(row[j], sof && sol, eof && eol, sol, eol);
+    }
+    eofOut |= outputWindow(func);
+  }
+  return eofOut;
+}
+
+// The dummy lines are written with the flags of the first lines of a new frame, which matches the
+// dummy writes of the kernel processing loops once their row and column counters wrap around.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+template<class FUNC>
+bool ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::flush(int n, FUNC &func)
+{
+  for (int i=0; i<AC_WN_ROW + PLUS_1_MIRROR_ROW; i++) {
+    for (int j=0; j<n; j++) {
+      bool sol = (j == 0);
+      write(T(0), (i == 0) && sol, false, sol, j == n - 1);
+      if (outputWindow(func)) { return true; }
+    }
+  }
+  return false;
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+inline  T &ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::operator() (int r, int c)
 {
   #ifndef __SYNTHESIS__
   if (!(AC_WMODE&AC_LIN_INDEX)) {
@@ -521,8 +516,8 @@ inline  T &ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::operator()
     return woutH_[r][c];
   }
 }
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-inline  const T &ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::operator()(int r,int c) const
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+inline  const T &ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::operator()(int r,int c) const
 {
   #ifndef __SYNTHESIS__
   if (!(AC_WMODE&AC_LIN_INDEX)) {
@@ -541,8 +536,43 @@ inline  const T &ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::oper
   }
 }
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::readFlags(bool &sof, bool &eof, bool &sol, bool &eol)
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+inline const T &ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::column(int r) const
+{
+  #ifndef __SYNTHESIS__
+  if (!(AC_WMODE&AC_LIN_INDEX)) {
+    assert((-AC_WN_ROW/2 <= r) && (r <= AC_WN_ROW/2));
+  } else {
+    assert((0 <= r) && (r < AC_WN_ROW + PLUS_1_MIRROR_ROW));
+  }
+  #endif
+  #pragma hls_waive CNS
+  if (!(AC_WMODE&AC_LIN_INDEX)) {
+    return wout_[r+AC_WN_ROW/2];
+  } else {
+    return wout_[r];
+  }
+}
+
+// Has the center row of the vertical window reached the first line of the frame?
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+bool ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::column_valid()
+{
+  return vrampup_;
+}
+
+// Flags of the current column, before the horizontal window delay.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::readColumnFlags(bool &sof, bool &eof, bool &sol, bool &eol)
+{
+  sof = sofOut_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL];
+  eof = eofOut_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL];
+  sol = sol_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL] & vrampup_;
+  eol = eol_[AC_WN_COL - 1 + PLUS_1_MIRROR_COL] & vrampup_;
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::readFlags(bool &sof, bool &eof, bool &sol, bool &eol)
 {
   #pragma hls_waive CNS
   if (AC_WMODE == AC_WIN) {
@@ -557,8 +587,8 @@ void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::readFlags(bool &
 }
 
 // Rewind support added for video scalers, etc.
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::exec(T src, bool sof, bool eof, bool sol, bool eol, bool w)
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::exec(T src, bool sof, bool eof, bool sol, bool eol, bool w)
 {
 
   if (sol&w) {                     // Store sof at start of each new line when writing
@@ -785,8 +815,8 @@ void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::exec(T src, bool
 
 // Rewind is used to reset the address into the line buffers.  This is used when performing scaling and
 // the programmable line width is less than the maximum line width.
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
-void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::rewind()
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, class ST>
+void ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,ST>::rewind()
 {
   addr = 0;
 }
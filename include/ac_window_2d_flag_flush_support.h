@@ -38,6 +38,26 @@
 //  Unlike the ac_window_2d_flag design, this design has a non-continuous consumption of inputs and
 //  production of outputs, so as to account for the lag produced by ramping up the linebuffers.
 //
+//  With the AC_STRIPE window mode, frames wider than AC_NCOL can be processed as vertical stripes.
+//  Each stripe is written as a frame of its own, with AC_WN_COL/2 halo columns taken from each
+//  neighboring stripe. stripeCount() and stripeRange() give the stripe layout, and setStripe() must be
+//  called before the first pixel of each stripe. Outputs in the halo columns are not valid, and the
+//  output flags mark the edges of the stripe core, so that the boundary condition only applies at the
+//  true frame edges. AC_STRIPE requires an odd window width.
+//
+//  Frames can be streamed back to back: the first flushItRow lines of frame N+1 can be written in
+//  place of the flushing lines of frame N, and the last output lines of frame N are produced while
+//  frame N+1 ramps up. The sof_/eof_ shift registers keep the boundary processing of the two frames
+//  apart, so the output lines of the two frames follow each other without a gap. The window must not
+//  be reset between frames.
+//
+//  Lines can be streamed back to back as well with write(): the first pixels of line N+1 can be written
+//  in place of the flushItCol flushing iterations of line N, and the last outputs of line N are produced
+//  while line N+1 ramps up. A continuous video stream therefore only needs flushItRow flushing lines and
+//  flushItCol flushing iterations after the last frame. With AC_SINGLEPORT, lines of odd width must
+//  still be followed by one extra write to complete the last memory word. Inserting the flushing
+//  iterations after each line remains supported.
+//
 // Revision History:
 //    3.3.0  - Added CDesignChecker waivers for CNS and CCC violations.
 //
@@ -77,6 +97,10 @@ public:
   // Following two functions can be used externally to determine how to loop through the input and output images while using singleport memories.
   bool isExtraWriteAllowed(); // Return allow_extra_write value, lets us know if we have to write an extra value to linebuffer in right extension region.
   bool spExtraItDynamic(); // Tells us whether or not we need an extra iteration for flushing due to the usage of singleport memories and odd dynamic image widths.
+  // Striping support (AC_STRIPE window mode).
+  void setStripe(bool haloL, bool haloR); // Does the stripe written next have halo columns on its left/right?
+  static int stripeCount(int width, int coreW); // Number of stripes with up to coreW output columns each.
+  static void stripeRange(int width, int coreW, int s, int &start, int &len, bool &haloL, bool &haloR); // Input columns of stripe s.
 
   enum { AC_EVEN_ROW = ((AC_WN_ROW%2)==0) };
   enum { AC_EVEN_COL = ((AC_WN_COL%2)==0) };
@@ -94,8 +118,22 @@ public:
     flushItCol = bool(AC_WMODE & AC_WIN) ? spOddCol : AC_WN_COL/2 - AC_EVEN_COL + int(extraIt), // Extra flushing iterations required for column loop.
   };
 
+  typedef ac_buffer_2d<T,AC_NCOL,AC_WN_ROW + PLUS_1_MIRROR_ROW,AC_WMODE> vwind_type;
+  // Resources and latency, see ac_resource.h. The first valid window of a frame is output once
+  // LATENCY_LINES*width + LATENCY_PIXELS pixels have been written.
+  enum {
+    LB_LINES = vwind_type::LB_LINES,
+    LB_WORDS = vwind_type::LB_WORDS,
+    LB_WORD_BITS = vwind_type::LB_WORD_BITS,
+    LB_BITS = vwind_type::LB_BITS,
+    LB_RAMS = vwind_type::LB_RAMS,
+    WINDOW_BITS = (AC_WN_ROW + PLUS_1_MIRROR_ROW)*(AC_WN_COL + PLUS_1_MIRROR_COL)*ac_resource_bits<T>::val,
+    LATENCY_LINES = bool(AC_WMODE&AC_WIN) ? AC_WN_ROW-1 : AC_WN_ROW/2 - AC_EVEN_ROW + PLUS_1_MIRROR_ROW,
+    LATENCY_PIXELS = bool(AC_WMODE&AC_WIN) ? AC_WN_COL-1 : AC_WN_COL/2 - AC_EVEN_COL + PLUS_1_MIRROR_COL
+  };
+
 private:
-  ac_buffer_2d<T,AC_NCOL,AC_WN_ROW + PLUS_1_MIRROR_ROW,AC_WMODE> vWind; //Vertical window
+  vwind_type vWind; //Vertical window
 
   T   data_[AC_WN_ROW + PLUS_1_MIRROR_ROW][AC_WN_COL + PLUS_1_MIRROR_COL]; // This array stores the input samples
   T   woutH_[AC_WN_ROW + PLUS_1_MIRROR_ROW][AC_WN_COL + PLUS_1_MIRROR_COL]; // This array is what really gets read
@@ -119,6 +157,15 @@ private:
   bool rampup_v;            // Has the window ramped up in the vertical direction?
   bool rampup_h;            // Has the window ramped up in the horizontal direction?
   bool eofOutSeenPrevPix;   // EOF seen on previous output pixel. Used to set rampup_ to false.
+  bool eolOutSeenPrevPix;   // EOL seen on previous output pixel. Used to set rampup_h to false.
+  bool inLine;              // Has an input sol been written since the last input eol?
+  bool haloL_;              // Striping: the current stripe has halo columns on its left.
+  bool haloR_;              // Striping: the current stripe has halo columns on its right.
+  bool inCore_;             // Striping: the current output is in the stripe core.
+  bool solCore_;            // Striping: start of line of the stripe core.
+  bool eolCore_;            // Striping: end of line of the stripe core.
+  bool sofCore_;            // Striping: start of frame of the stripe core.
+  bool eofCore_;            // Striping: end of frame of the stripe core.
   bool s;                   // start bit set when start detected in shift reg
   bool e;                   // end bit set when start detected in shift reg
   int m;
@@ -128,7 +175,7 @@ private:
 
 
 template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_window_2d_flag_flush_support<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::ac_window_2d_flag_flush_support():
-  addr(0), allow_extra_write(false), ru_cc(false), rampup_(false), rampup_v(false), rampup_h(false), eofOutSeenPrevPix(false), s(false), e(false), m(0)
+  addr(0), allow_extra_write(false), ru_cc(false), rampup_(false), rampup_v(false), rampup_h(false), eofOutSeenPrevPix(false), eolOutSeenPrevPix(false), inLine(false), haloL_(false), haloR_(false), inCore_(false), solCore_(false), eolCore_(false), sofCore_(false), eofCore_(false), s(false), e(false), m(0)
 {
 
   #ifdef __SYNTHESIS__
@@ -139,6 +186,7 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_wi
   assert((AC_WN_ROW > 0) && "ac_window must have positive window width");
   assert((AC_WN_COL > 0) && "ac_window must have positive window height");
   assert((AC_WN_COL < AC_NCOL) && "ac_window width must be smaller than array width");
+  assert((!(AC_WMODE&AC_STRIPE) || (AC_WN_COL%2 == 1 && !(AC_WMODE&AC_WIN))) && "ac_window striping requires an odd window width");
   #endif
   for (int i=0; i<AC_WN_ROW + PLUS_1_MIRROR_ROW; i++) {
     wout_[i] = 0;
@@ -159,7 +207,7 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_wi
 }
 
 template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_window_2d_flag_flush_support<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::ac_window_2d_flag_flush_support(T bval):
-  addr(0), allow_extra_write(false), ru_cc(false), rampup_(false), rampup_v(false), rampup_h(false), eofOutSeenPrevPix(false), s(false), e(false), m(0)
+  addr(0), allow_extra_write(false), ru_cc(false), rampup_(false), rampup_v(false), rampup_h(false), eofOutSeenPrevPix(false), eolOutSeenPrevPix(false), inLine(false), haloL_(false), haloR_(false), inCore_(false), solCore_(false), eolCore_(false), sofCore_(false), eofCore_(false), s(false), e(false), m(0)
 {
   #ifdef __SYNTHESIS__
   #pragma hls_unroll yes
@@ -168,6 +216,7 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE> ac_wi
   assert((AC_WN_ROW > 0) && "ac_window must have positive window width");
   assert((AC_WN_COL > 0) && "ac_window must have positive window height");
   assert((AC_WN_COL < AC_NCOL) && "ac_window width must be smaller than array width");
+  assert((!(AC_WMODE&AC_STRIPE) || (AC_WN_COL%2 == 1 && !(AC_WMODE&AC_WIN))) && "ac_window striping requires an odd window width");
   #endif
   for (int i=0; i<AC_WN_ROW + PLUS_1_MIRROR_ROW; i++) {
     wout_[i] = 0;
@@ -198,6 +247,13 @@ void ac_window_2d_flag_flush_support<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::
   rampup_v = false;
   rampup_h = false;
   eofOutSeenPrevPix = false;
+  eolOutSeenPrevPix = false;
+  inLine = false;
+  inCore_ = false;
+  solCore_ = false;
+  eolCore_ = false;
+  sofCore_ = false;
+  eofCore_ = false;
   s = false;
   e = false;
   m = 0;
@@ -226,6 +282,10 @@ void ac_window_2d_flag_flush_support<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::
 template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
 bool ac_window_2d_flag_flush_support<T, AC_WN_ROW, AC_WN_COL,AC_NCOL,AC_WMODE>::valid()
 {
+  #pragma hls_waive CNS
+  if (AC_WMODE&AC_STRIPE) {
+    return rampup_ && inCore_;
+  }
   return rampup_;
 }
 
@@ -274,6 +334,11 @@ void ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::wr
     }
   }
 
+  // With continuous lines, the first pixels of the next line are written while the eol of the previous line is still
+  // in the right extension region. These are valid inputs and must be written to the linebuffers.
+  isRER = isRER && !(sol || inLine);
+  inLine = (inLine || sol) && !eol;
+
   // If linebuffer address is even when the receive eol pixel is received, and if the windowing mode is singleport, we know
   // that the number of image columns is odd and that we will have to allow an extra write in the right extension region,
   // so as to complete the writing of all pixel values to the SPRAM.
@@ -511,14 +576,17 @@ void ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::wr
     ru_cc = allow_extra_write && (AC_WN_COL <= 2); // ru_cc : "r"amp"u"p "c"orner "c"ase.
   }
 
-  // The window needs AC_WN_COL/2 pixels to prefill horizontally. The start of this prefill interval coincides with the
-  // receipt of the input sol pixel, while the end coincides with the production of the output sol pixel.
+  // The window needs AC_WN_COL/2 pixels to prefill horizontally. The prefill interval starts once the output eol pixel of the
+  // previous line has been produced, and ends with the production of the output sol pixel. With flushItCol flushing iterations
+  // per line, the start of this interval coincides with the receipt of the input sol pixel. Without them, the output sol pixel
+  // directly follows the output eol pixel of the previous line, and the window produces one output per input.
   // Update rampup_h accordingly.
   if (solOut) {
     rampup_h = true;
-  } else if (sol || (ru_cc && eol_zero_p)) {
+  } else if (eolOutSeenPrevPix || (ru_cc && eol_zero_p)) {
     rampup_h = false;
   }
+  eolOutSeenPrevPix = eolOut;
 
   // eofOutSeenPrevPix: The previous pixel was the eof pixel for the ac_window output. Hence, the ac_window has no more valid outputs to
   // produce and rampup_ is set to false, in preparation for the next frame that is to be processed.
@@ -535,20 +603,39 @@ void ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::wr
     eofOutSeenPrevPix = eofOut_[AC_WN_COL/2];
   }
 
-  // Keeping track of whether the window has prefilled vertically and update the rampup_v flag by looking at the relevant
-  // sof_ position.
+  // Keeping track of whether the window has prefilled vertically and update the rampup_v flag by looking at the output sof
+  // pixel. Without flushing iterations between lines, the sof_ position is already set while the last outputs of the
+  // previous (ramp-up) line are produced, so the output sof pixel is used instead.
   #pragma hls_waive CNS
   if (AC_WMODE&AC_WIN) {
-    if (sof_[0]) {
+    if (sofOut_[0]) {
       rampup_v = true;
     }
-  } else if (sof_[AC_WN_ROW/2]) {
+  } else if (sofOut_[AC_WN_COL/2]) {
     rampup_v = true;
   }
 
   // The rampup_ signal (and, ultimately, the valid() output) is only set to true once the window has adequately prefilled in the
   // horizontal and vertical directions.
   rampup_ = rampup_h && rampup_v;
+
+  #pragma hls_waive CNS
+  if (AC_WMODE&AC_STRIPE) {
+    // Output column c of the stripe is produced when input column c + AC_WN_COL/2 is written. Hence, the first core column
+    // (AC_WN_COL/2) is produced when the input sol reaches sol_[0], and the last core column with a right halo is produced
+    // together with the input eol. Without a halo, the stripe edge is a true frame edge and the regular flags are used.
+    if (eolCore_) {
+      inCore_ = false;
+    }
+    solCore_ = haloL_ ? sol_[0] : solOut;
+    sofCore_ = haloL_ ? sofOut_[0] : sofOut_[AC_WN_COL/2];
+    eolCore_ = haloR_ ? eol_[AC_WN_COL - 1] : eolOut;
+    eofCore_ = haloR_ ? eofOut_[AC_WN_COL - 1] : eofOut_[AC_WN_COL/2];
+    if (solCore_ && rampup_) {
+      inCore_ = true;
+    }
+    eolCore_ = eolCore_ && inCore_;
+  }
 }
 
 template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
@@ -601,6 +688,14 @@ void ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::re
   }
   sol = solOut & rampup_;
   eol = eolOut & rampup_;
+
+  #pragma hls_waive CNS
+  if (AC_WMODE&AC_STRIPE) {
+    sof = sofCore_ && inCore_;
+    eof = eofCore_ && inCore_;
+    sol = solCore_ && inCore_;
+    eol = eolCore_;
+  }
 }
 
 //Rewind support added for video scalers, etc.
@@ -937,4 +1032,43 @@ bool ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::sp
   return allow_extra_write && (noBound || AC_WN_COL <= 2);
 }
 
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
+void ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::setStripe(bool haloL, bool haloR)
+{
+  haloL_ = haloL;
+  haloR_ = haloR;
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
+int ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::stripeCount(int width, int coreW)
+{
+  return (width + coreW - 1)/coreW;
+}
+
+// Stripe s has the output columns [s*coreW, min((s + 1)*coreW, width)) of the frame. Its input columns are
+// [start, start + len), which include AC_WN_COL/2 halo columns on each side that is not a frame edge.
+// If the last stripe would be narrower than its halo, its core is widened to AC_WN_COL/2 columns at the
+// expense of the stripe before it, so that every right halo lies inside the frame.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE>
+void ac_window_2d_flag_flush_support<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE>::stripeRange(int width, int coreW, int s, int &start, int &len, bool &haloL, bool &haloR)
+{
+  #ifndef __SYNTHESIS__
+  assert((coreW > AC_WN_COL/2) && "ac_window stripe core must be wider than half the window");
+  #endif
+  const int nStripes = stripeCount(width, coreW);
+  int lastStart = (nStripes - 1)*coreW;
+  if (nStripes > 1 && width - lastStart < AC_WN_COL/2) {
+    lastStart = width - AC_WN_COL/2;
+  }
+  int coreStart = (s == nStripes - 1) ? lastStart : s*coreW;
+  int coreEnd = (s == nStripes - 2) ? lastStart : ((coreStart + coreW < width) ? coreStart + coreW : width);
+  haloL = (coreStart > 0);
+  haloR = (coreEnd < width);
+  start = haloL ? coreStart - AC_WN_COL/2 : coreStart;
+  len = (haloR ? coreEnd + AC_WN_COL/2 : coreEnd) - start;
+  #ifndef __SYNTHESIS__
+  assert((len <= AC_NCOL) && "ac_window stripe (including halo columns) must not be wider than array width");
+  #endif
+}
+
 #endif
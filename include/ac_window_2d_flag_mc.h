@@ -0,0 +1,318 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_window_2d_flag_mc.h
+//
+// Description:
+//  Multi-plane (e.g. RGB) version of ac_window_2d_flag. A single window object handles AC_NPLANES image
+//  planes that share the same frame geometry and flags, so the address counter, the rampup logic and the
+//  sof/eof/sol/eol shift registers are only implemented once, instead of once per plane as with one
+//  ac_window_2d_flag object per plane.
+//
+//  The planes of a pixel are held in an ac_window_planes struct. By default (AC_SPLIT = false) the
+//  line buffers store all planes of a pixel in one word. With AC_SPLIT = true, each plane has its own
+//  line buffers, which are all addressed by the shared address counter.
+//
+//  ac_window_pair holds two pixels of different types, e.g. two ac_window_planes, in one window pixel.
+//
+// Usage:
+//    typedef ac_window_2d_flag_mc<ac_int<8,false>, 3, 5, 5, 1920, AC_BOUNDARY> windType;
+//    windType win(0);
+//    windType::planes_type pix;
+//    ...
+//    pix[0] = pixIn.R; pix[1] = pixIn.G; pix[2] = pixIn.B;
+//    win.write(pix, sof, eof, sol, eol);
+//    if (win.valid()) {
+//      for (int p = 0; p < 3; p++) {
+//        acc[p] = win(p, -2, -2) + ... + win(p, 2, 2);
+//      }
+//    }
+//
+// Notes:
+//  - The outputs for each plane are identical to those of an ac_window_2d_flag object which is written
+//    with that plane alone.
+//  - The boundary value set in the constructor applies to all planes.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_WINDOW_2D_FLAG_MC_H
+#define __AC_WINDOW_2D_FLAG_MC_H
+
+#include <ac_int.h>
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+#include "ac_buffer_2d.h"
+#include "ac_window_2d_flag.h"
+
+// The AC_NPLANES planes of a pixel. This is both the input type of ac_window_2d_flag_mc and the word type
+// stored in its line buffers. AC_SPLIT selects separate line buffers for each plane.
+template<typename T, int AC_NPLANES, bool AC_SPLIT = false>
+struct ac_window_planes {
+  T p[AC_NPLANES];
+
+  ac_window_planes() {}
+
+  // Initialize all planes to a single value.
+  template<class T2> ac_window_planes(T2 v) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_NPLANES; k++) { p[k] = v; }
+  }
+
+  // Copy planes with a different pixel type (e.g. the wider words used for singleport RAMs).
+  template<class T2> ac_window_planes(const ac_window_planes<T2, AC_NPLANES, AC_SPLIT> &v) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_NPLANES; k++) { p[k] = v.p[k]; }
+  }
+
+  T &operator[](int k) { return p[k]; }
+  const T &operator[](int k) const { return p[k]; }
+};
+
+// ac_window_planes singleport support: each plane is packed with ac_width2x<T>.
+template<typename T, int AC_NPLANES, bool AC_SPLIT>
+struct ac_width2x<ac_window_planes<T, AC_NPLANES, AC_SPLIT>, true> {
+  typedef ac_width2x<T, true> ac_width2x_internal_type;
+  typedef ac_window_planes<typename ac_width2x_internal_type::data, AC_NPLANES, AC_SPLIT> data;
+  static void set_half(bool sel_half, ac_window_planes<T, AC_NPLANES, AC_SPLIT> din, data &dout) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_NPLANES; k++) { ac_width2x_internal_type::set_half(sel_half, din.p[k], dout.p[k]); }
+  }
+  static void get_half(bool sel_half, data din, ac_window_planes<T, AC_NPLANES, AC_SPLIT> &dout) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_NPLANES; k++) { ac_width2x_internal_type::get_half(sel_half, din.p[k], dout.p[k]); }
+  }
+};
+
+// ac_window_planes dualport support.
+template<typename T, int AC_NPLANES, bool AC_SPLIT>
+struct ac_width2x<ac_window_planes<T, AC_NPLANES, AC_SPLIT>, false> {
+  typedef ac_window_planes<T, AC_NPLANES, AC_SPLIT> data;
+  static void set_half(bool sel_half, data din, data &dout) { }
+  static void get_half(bool sel_half, data din, data &dout) { }
+};
+
+// ac_window_planes packed line buffer support: each plane is packed with ac_widthNx<T>.
+template<typename T, int AC_NPLANES, bool AC_SPLIT, int AC_N>
+struct ac_widthNx<ac_window_planes<T, AC_NPLANES, AC_SPLIT>, AC_N> {
+  typedef ac_widthNx<T, AC_N> ac_widthNx_internal_type;
+  typedef ac_window_planes<typename ac_widthNx_internal_type::data, AC_NPLANES, AC_SPLIT> data;
+  static void set_part(int sel, ac_window_planes<T, AC_NPLANES, AC_SPLIT> din, data &dout) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_NPLANES; k++) { ac_widthNx_internal_type::set_part(sel, din.p[k], dout.p[k]); }
+  }
+  static void get_part(int sel, data din, ac_window_planes<T, AC_NPLANES, AC_SPLIT> &dout) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_NPLANES; k++) { ac_widthNx_internal_type::get_part(sel, din.p[k], dout.p[k]); }
+  }
+};
+
+template<typename T, int AC_NPLANES, bool AC_SPLIT>
+struct ac_resource_bits<ac_window_planes<T, AC_NPLANES, AC_SPLIT>, false> {
+  enum { val = AC_NPLANES*ac_resource_bits<T>::val };
+};
+
+template<typename T, int AC_NPLANES, bool AC_SPLIT>
+struct ac_resource_channels<ac_window_planes<T, AC_NPLANES, AC_SPLIT> > {
+  enum { val = AC_NPLANES };
+};
+
+// Two pixels of different types, held in one window pixel, e.g. the planes of two images of different
+// types that are streamed through one window (see ac_stencil_2d.h). Both are stored in one line buffer word.
+template<typename T0, typename T1>
+struct ac_window_pair {
+  T0 first;
+  T1 second;
+
+  ac_window_pair() {}
+
+  // Initialize both pixels to a single value.
+  template<class T2> ac_window_pair(T2 v) : first(v), second(v) {}
+
+  // Copy a pair with different pixel types (e.g. the wider words used for singleport RAMs).
+  template<class T2, class T3> ac_window_pair(const ac_window_pair<T2, T3> &v) : first(v.first), second(v.second) {}
+};
+
+// ac_window_pair singleport support: each pixel is packed with ac_width2x.
+template<typename T0, typename T1>
+struct ac_width2x<ac_window_pair<T0, T1>, true> {
+  typedef ac_width2x<T0, true> first_type;
+  typedef ac_width2x<T1, true> second_type;
+  typedef ac_window_pair<typename first_type::data, typename second_type::data> data;
+  static void set_half(bool sel_half, ac_window_pair<T0, T1> din, data &dout) {
+    first_type::set_half(sel_half, din.first, dout.first);
+    second_type::set_half(sel_half, din.second, dout.second);
+  }
+  static void get_half(bool sel_half, data din, ac_window_pair<T0, T1> &dout) {
+    first_type::get_half(sel_half, din.first, dout.first);
+    second_type::get_half(sel_half, din.second, dout.second);
+  }
+};
+
+// ac_window_pair dualport support.
+template<typename T0, typename T1>
+struct ac_width2x<ac_window_pair<T0, T1>, false> {
+  typedef ac_window_pair<T0, T1> data;
+  static void set_half(bool sel_half, data din, data &dout) { }
+  static void get_half(bool sel_half, data din, data &dout) { }
+};
+
+// ac_window_pair packed line buffer support: each pixel is packed with ac_widthNx.
+template<typename T0, typename T1, int AC_N>
+struct ac_widthNx<ac_window_pair<T0, T1>, AC_N> {
+  typedef ac_widthNx<T0, AC_N> first_type;
+  typedef ac_widthNx<T1, AC_N> second_type;
+  typedef ac_window_pair<typename first_type::data, typename second_type::data> data;
+  static void set_part(int sel, ac_window_pair<T0, T1> din, data &dout) {
+    first_type::set_part(sel, din.first, dout.first);
+    second_type::set_part(sel, din.second, dout.second);
+  }
+  static void get_part(int sel, data din, ac_window_pair<T0, T1> &dout) {
+    first_type::get_part(sel, din.first, dout.first);
+    second_type::get_part(sel, din.second, dout.second);
+  }
+};
+
+template<typename T0, typename T1>
+struct ac_resource_bits<ac_window_pair<T0, T1>, false> {
+  enum { val = ac_resource_bits<T0>::val + ac_resource_bits<T1>::val };
+};
+
+// Line buffers with separate storage for each plane. The planes are written with the same address and
+// write enable, and the vertical window output of all planes is gathered into wout_.
+template<typename T, int AC_NPLANES, int AC_NCOL, int AC_NROW, int AC_WMODE>
+class ac_buffer_2d<ac_window_planes<T, AC_NPLANES, true>, AC_NCOL, AC_NROW, AC_WMODE>
+{
+  typedef ac_window_planes<T, AC_NPLANES, true> DTYPE;
+  typedef ac_buffer_2d<T, AC_NCOL, AC_NROW, AC_WMODE> plane_type;
+  plane_type plane_[AC_NPLANES];
+  DTYPE wout_[AC_NROW];
+
+public:
+  // Line buffer resources, see ac_resource.h. LB_WORDS and LB_WORD_BITS are those of each RAM.
+  enum {
+    LB_LINES = plane_type::LB_LINES,
+    LB_WORDS = plane_type::LB_WORDS,
+    LB_WORD_BITS = plane_type::LB_WORD_BITS,
+    LB_BITS = AC_NPLANES*plane_type::LB_BITS,
+    LB_RAMS = AC_NPLANES*plane_type::LB_RAMS
+  };
+  ac_buffer_2d() {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int i = 0; i < AC_NROW; i++) {
+      wout_[i] = DTYPE(0);
+    }
+  }
+
+  DTYPE &operator[](int i) { return wout_[i]; }
+  const DTYPE &operator[](int i) const { return wout_[i]; }
+
+  void write(DTYPE src, int i, bool w) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_NPLANES; k++) {
+      plane_[k].write(src.p[k], i, w);
+      #ifdef __SYNTHESIS__
+      #pragma hls_unroll yes
+      #endif
+      for (int r = 0; r < AC_NROW; r++) {
+        wout_[r].p[k] = plane_[k][r];
+      }
+    }
+  }
+};
+
+template<class T, int AC_NPLANES, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, bool AC_SPLIT = false>
+class ac_window_2d_flag_mc
+{
+public:
+  typedef ac_window_planes<T, AC_NPLANES, AC_SPLIT> planes_type;
+  typedef ac_window_2d_flag<planes_type, AC_WN_ROW, AC_WN_COL, AC_NCOL, AC_WMODE> window_type;
+  // Resources and latency, see ac_resource.h.
+  enum {
+    LB_BITS = window_type::LB_BITS,
+    LB_RAMS = window_type::LB_RAMS,
+    WINDOW_BITS = window_type::WINDOW_BITS,
+    LATENCY_LINES = window_type::LATENCY_LINES,
+    LATENCY_PIXELS = window_type::LATENCY_PIXELS
+  };
+
+  ac_window_2d_flag_mc() {}
+  ac_window_2d_flag_mc(T bval) : w(planes_type(bval)) {}
+  void reset() { w.reset(); }
+  T &operator()      (int p, int r, int c);
+  const T &operator()(int p, int r, int c) const;
+  planes_type &operator()      (int r, int c) { return w(r, c); }
+  const planes_type &operator()(int r, int c) const { return w(r, c); }
+  void write(const planes_type &src, bool sof, bool eof, bool sol, bool eol) { w.write(src, sof, eof, sol, eol); }
+  bool valid() { return w.valid(); }
+  void readFlags(bool &sof, bool &eof, bool &sol, bool &eol) { w.readFlags(sof, eof, sol, eol); }
+  void rewind() { w.rewind(); }
+
+private:
+  window_type w; // Shared control, all planes
+};
+
+template<class T, int AC_NPLANES, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, bool AC_SPLIT>
+inline T &ac_window_2d_flag_mc<T,AC_NPLANES,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_SPLIT>::operator() (int p, int r, int c)
+{
+  #ifndef __SYNTHESIS__
+  assert((0 <= p) && (p < AC_NPLANES));
+  #endif
+  return w(r, c).p[p];
+}
+
+template<class T, int AC_NPLANES, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, bool AC_SPLIT>
+inline const T &ac_window_2d_flag_mc<T,AC_NPLANES,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_SPLIT>::operator()(int p, int r, int c) const
+{
+  #ifndef __SYNTHESIS__
+  assert((0 <= p) && (p < AC_NPLANES));
+  #endif
+  return w(r, c).p[p];
+}
+
+#endif
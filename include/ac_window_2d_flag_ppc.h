@@ -0,0 +1,623 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_window_2d_flag_ppc.h
+//
+// Description:
+//  Multi-pixel-per-clock (N-PPC) version of ac_window_2d_flag. Each call to write() accepts AC_PPC
+//  horizontally adjacent pixels, and the window exposes AC_PPC overlapping AC_WN_ROW x AC_WN_COL
+//  views, one centered on each of the pixels of the output group.
+//
+//  The line buffers store one ac_ppc_pixels word (AC_PPC pixels) per address, so their depth is
+//  AC_NCOL/AC_PPC. The horizontal shift register holds AC_WN_COL/2 + (AC_DELAY_WORDS+1)*AC_PPC
+//  columns and advances by AC_PPC columns per write. Boundary processing (AC_CLIP, AC_MIRROR and
+//  AC_BOUNDARY) is done separately for each view, using per-column sol/eol flags.
+//
+// Usage:
+//    typedef ac_window_2d_flag_ppc<ac_int<8,false>, 3, 3, 1920, AC_MIRROR, 2> windType;
+//    windType win;
+//    windType::ppc_type pix;
+//    ...
+//    win.write(pix, sof, eof, sol, eol);
+//    if (win.valid()) {
+//      win.readFlags(sofOut, eofOut, solOut, eolOut);
+//      for (int p = 0; p < 2; p++) {
+//        out.px[p] = win(p, -1, -1) + ... + win(p, 1, 1);
+//      }
+//    }
+//
+// Notes:
+//  - Only odd window sizes are supported, and AC_WIN mode is not supported.
+//  - sol marks the first pixel of the group (px[0]) and eol marks the last pixel of the group
+//    (px[AC_PPC-1]). The image width must therefore be a multiple of AC_PPC.
+//  - As with ac_window_2d_flag, the window must be flushed with dummy inputs until eofOut is seen.
+//  - With AC_PPC = 1, the outputs are identical to those of ac_window_2d_flag.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_WINDOW_2D_FLAG_PPC_H
+#define __AC_WINDOW_2D_FLAG_PPC_H
+
+#include <ac_int.h>
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+#include "ac_buffer_2d.h"
+#include "ac_window_1d_flag.h"
+
+#ifndef ac_compile_time_assert
+#ifdef BOOST_STATIC_ASSERT
+#define ac_compile_time_assert(cond, msg) \
+      BOOST_STATIC_ASSERT(cond) ;
+#else
+#define ac_compile_time_assert(cond, msg) \
+      typedef char msg[(cond) ? 1 : -1]
+#endif
+#endif
+
+// Group of AC_PPC horizontally adjacent pixels. This is both the input type of ac_window_2d_flag_ppc and
+// the word type stored in its line buffers.
+template<typename T, int AC_PPC>
+struct ac_ppc_pixels {
+  T px[AC_PPC];
+
+  ac_ppc_pixels() {}
+
+  // Initialize all pixels in the group to a single value.
+  template<class T2> ac_ppc_pixels(T2 p) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_PPC; k++) { px[k] = p; }
+  }
+
+  // Copy a group of pixels with a different pixel type (e.g. the wider words used for singleport RAMs).
+  template<class T2> ac_ppc_pixels(const ac_ppc_pixels<T2, AC_PPC> &p) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_PPC; k++) { px[k] = p.px[k]; }
+  }
+
+  T &operator[](int k) { return px[k]; }
+  const T &operator[](int k) const { return px[k]; }
+};
+
+// ac_ppc_pixels singleport support: each pixel of the group is packed with ac_width2x<T>.
+template<typename T, int AC_PPC>
+struct ac_width2x<ac_ppc_pixels<T, AC_PPC>, true> {
+  typedef ac_width2x<T, true> ac_width2x_internal_type;
+  typedef ac_ppc_pixels<typename ac_width2x_internal_type::data, AC_PPC> data;
+  static void set_half(bool sel_half, ac_ppc_pixels<T, AC_PPC> din, data &dout) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_PPC; k++) { ac_width2x_internal_type::set_half(sel_half, din.px[k], dout.px[k]); }
+  }
+  static void get_half(bool sel_half, data din, ac_ppc_pixels<T, AC_PPC> &dout) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k = 0; k < AC_PPC; k++) { ac_width2x_internal_type::get_half(sel_half, din.px[k], dout.px[k]); }
+  }
+};
+
+// ac_ppc_pixels dualport support.
+template<typename T, int AC_PPC>
+struct ac_width2x<ac_ppc_pixels<T, AC_PPC>, false> {
+  typedef ac_ppc_pixels<T, AC_PPC> data;
+  static void set_half(bool sel_half, data din, data &dout) { }
+  static void get_half(bool sel_half, data din, data &dout) { }
+};
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+class ac_window_2d_flag_ppc
+{
+public:
+  typedef ac_ppc_pixels<T, AC_PPC> ppc_type;
+
+  ac_window_2d_flag_ppc();
+  ac_window_2d_flag_ppc(T bval);
+  void reset();
+  T &operator()      (int p, int r, int c);
+  const T &operator()(int p, int r, int c) const ;
+  void write(const ppc_type &src, bool sof, bool eof, bool sol, bool eol);
+  bool valid();
+  void readFlags(bool &sof, bool &eof, bool &sol, bool &eol);
+
+  enum {
+    AC_HALO_COL = AC_WN_COL/2,
+    AC_DELAY_WORDS = (AC_HALO_COL + AC_PPC - 1)/AC_PPC,     // Horizontal latency of the window, in writes.
+    AC_HSPAN = AC_HALO_COL + (AC_DELAY_WORDS + 1)*AC_PPC,   // Number of columns held in the horizontal shift register.
+    AC_NCOL_WORDS = (AC_NCOL + AC_PPC - 1)/AC_PPC,           // Line buffer depth.
+    logAC_NCOL_WORDS = ac::nbits< AC_NCOL_WORDS >::val
+  };
+  // Latency, see ac_resource.h. The first valid window group of a frame is output once
+  // LATENCY_LINES*width/AC_PPC + LATENCY_PIXELS/AC_PPC groups have been written.
+  enum {
+    LATENCY_LINES = AC_WN_ROW/2,
+    LATENCY_PIXELS = AC_DELAY_WORDS*AC_PPC
+  };
+
+private:
+  void init(T bval);
+
+  ac_buffer_2d<ppc_type,AC_NCOL_WORDS,AC_WN_ROW,AC_WMODE> vWind; // Vertical window
+
+  T    data_[AC_WN_ROW][AC_HSPAN];                 // This array stores the input samples
+  T    woutH_[AC_PPC][AC_WN_ROW][AC_WN_COL];       // One window view per pixel of the output group
+  bool colSol_[AC_HSPAN];  // Per-column start of line control
+  bool colEol_[AC_HSPAN];  // Per-column end of line control
+  bool sol_[AC_DELAY_WORDS + 1];  // Start of line control
+  bool eol_[AC_DELAY_WORDS + 1];  // End of line control
+
+  ppc_type wout_[AC_WN_ROW];             // This array stores the vWind output
+  ac_int<logAC_NCOL_WORDS,false> addr;   // Address counter for line buffers
+  bool sofOut_[AC_DELAY_WORDS + 1];  // Start of frame output control
+  bool eofOut_[AC_DELAY_WORDS + 1];  // End of frame output control
+  bool sof_[AC_WN_ROW];  // Start of frame control
+  bool eof_[AC_WN_ROW];  // End of frame control
+  bool solOut;  // Start of line output control
+  bool eolOut;  // End of line output control
+
+  bool rampup_;              // Has the window ramped up?
+  bool s;                   // start bit set when start detected in shift reg
+  bool e;                   // end bit set when start detected in shift reg
+  int m;
+
+  T boundaryVal;   // constant for boundary condition
+};
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::ac_window_2d_flag_ppc()
+{
+  init(T(0));
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::ac_window_2d_flag_ppc(T bval)
+{
+  init(bval);
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+void ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::init(T bval)
+{
+  ac_compile_time_assert((AC_WN_ROW%2 == 1), ac_window_ppc_rows_must_be_odd);
+  ac_compile_time_assert((AC_WN_COL%2 == 1), ac_window_ppc_cols_must_be_odd);
+  ac_compile_time_assert((AC_PPC > 0), ac_window_ppc_must_be_positive);
+  ac_compile_time_assert(!(AC_WMODE&AC_WIN), ac_window_ppc_does_not_support_ac_win);
+  #ifndef __SYNTHESIS__
+  assert((AC_HSPAN <= AC_NCOL) && "ac_window_ppc horizontal span must be smaller than array width");
+  #endif
+
+  boundaryVal = bval;
+  reset();
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int j = 0; j < AC_WN_ROW; j++) {
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int i = 0; i < AC_HSPAN; i++) {
+      data_[j][i] = T(0); // Zero out data_ array to prevent UMR violations being detected in CDesignChecker.
+    }
+  }
+}
+
+// Reset member variables in order to start with new configurations with different
+// frame sizes.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+void ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::reset()
+{
+  addr = 0;
+  rampup_ = false;
+  s = false;
+  e = false;
+  m = 0;
+  solOut = false;
+  eolOut = false;
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i = 0; i < AC_WN_ROW; i++) {
+    wout_[i] = ppc_type(0);
+    sof_[i] = 0;
+    eof_[i] = 0;
+  }
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i = 0; i < AC_DELAY_WORDS + 1; i++) {
+    sol_[i] = 0;
+    eol_[i] = 0;
+    sofOut_[i] = 0;
+    eofOut_[i] = 0;
+  }
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i = 0; i < AC_HSPAN; i++) {
+    colSol_[i] = 0;
+    colEol_[i] = 0;
+  }
+}
+
+// Have we passed the rampup cycles? Is this now valid data?
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+bool ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::valid()
+{
+  return rampup_;
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+void ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::write(const ppc_type &src, bool sof, bool eof, bool sol, bool eol)
+{
+  if (sol) {                     // Store sof at start of each new line
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int i=0; i<AC_WN_ROW - 1; i++) {
+      sof_[i] = sof_[i+1];
+    }
+    sof_[AC_WN_ROW - 1] = sof;
+  }
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_DELAY_WORDS; i++) {
+    sofOut_[i] = sofOut_[i+1];
+  }
+  sofOut_[AC_DELAY_WORDS] = sol ? sof_[AC_WN_ROW/2]:(bool)0;
+
+  if (sol) {
+    #ifndef __SYNTHESIS__
+    if (bool(AC_WMODE&AC_SINGLEPORT)) {
+      AC_ASSERT(sof || addr%int(ac_linebuf_pack<ppc_type, AC_WMODE>::N) == 0 || addr == AC_NCOL_WORDS - 1, "eol pixel was not written to singleport RAM. Add an extra iteration to complete the write and avoid UMRs.");
+    }
+    #endif
+
+    addr = 0; // Address resets at each start of line
+  }
+
+  vWind.write(src,(int)(addr),1);
+
+  if (addr<AC_NCOL_WORDS-1) { addr++; }
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_WN_ROW; i++) {   // get vertical window output
+    wout_[i] = vWind[i];
+  }
+
+  // Vertical boundary processing is done on whole words, since all the pixels in a word belong to the same row.
+  #pragma hls_waive CNS
+  if (AC_WMODE&AC_CLIP) {
+    s = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes // vertical lower clipping
+    #endif
+    for (int i=AC_WN_ROW/2-1; i>=0; i--) {
+      s |= sof_[i+1];
+      wout_[i] = s ? wout_[i+1] : wout_[i];
+    }
+
+    e = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //  vertical upper clipping
+    #endif
+    for (int i=AC_WN_ROW/2+1; i< AC_WN_ROW; i++) {
+      e |= eof_[i];
+      wout_[i] = e ? wout_[i-1] : wout_[i];
+    }
+  }
+
+  #pragma hls_waive CNS
+  if (AC_WMODE&AC_MIRROR) {
+    s = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //  vertical lower clipping
+    #endif
+    for (int i=AC_WN_ROW/2-1; i>=0; i--) {
+      s |= sof_[i+1];
+      if (sof_[i+1]==1) { m = i+1; }
+      wout_[i] = s ? wout_[m*2-i] : wout_[i];
+    }
+
+    e = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //  vertical upper clipping
+    #endif
+    for (int i=AC_WN_ROW/2+1; i< AC_WN_ROW; i++) {
+      e |= eof_[i];
+      if (eof_[i]==1) { m = i-1; }
+      wout_[i] = e ? wout_[m*2-i] : wout_[i];
+    }
+  }
+
+  #pragma hls_waive CNS
+  if (AC_WMODE&AC_BOUNDARY) {
+    s = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes // vertical lower clipping
+    #endif
+    for (int i=AC_WN_ROW/2-1; i>=0; i--) {
+      s |= sof_[i+1];
+      wout_[i] = s ? ppc_type(boundaryVal) : wout_[i];
+    }
+
+    e = false;
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes //  vertical upper clipping
+    #endif
+    for (int i=AC_WN_ROW/2+1; i< AC_WN_ROW; i++) {
+      e |= eof_[i];
+      wout_[i] = e ? ppc_type(boundaryVal) : wout_[i];
+    }
+  }
+
+  if (eol) {                     // Store eof at end of each new line
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int i=0; i<AC_WN_ROW - 1; i++) {
+      eof_[i] = eof_[i+1];
+    }
+    eof_[AC_WN_ROW - 1] = eof;
+  }
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_DELAY_WORDS; i++) {
+    eofOut_[i] = eofOut_[i+1];
+  }
+  eofOut_[AC_DELAY_WORDS] = eol ? eof_[AC_WN_ROW/2]:(bool)0;
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_DELAY_WORDS; i++) {
+    sol_[i] = sol_[i+1];
+    eol_[i] = eol_[i+1];
+  }
+  sol_[AC_DELAY_WORDS] = sol;
+  eol_[AC_DELAY_WORDS] = eol;
+
+  // Per-column flags advance by one word: sol belongs to the first pixel of the group and eol to the last.
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int i=0; i<AC_HSPAN - AC_PPC; i++) {
+    colSol_[i] = colSol_[i+AC_PPC];
+    colEol_[i] = colEol_[i+AC_PPC];
+  }
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int k=0; k<AC_PPC; k++) {
+    colSol_[AC_HSPAN - AC_PPC + k] = (k == 0) ? sol : (bool)0;
+    colEol_[AC_HSPAN - AC_PPC + k] = (k == AC_PPC - 1) ? eol : (bool)0;
+  }
+
+  #ifdef __SYNTHESIS__
+  #pragma hls_unroll yes
+  #endif
+  for (int j=0; j<AC_WN_ROW; j++) {
+    // HORIZONTAL WINDOWS
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int i=0; i<AC_HSPAN - AC_PPC; i++) {
+      data_[j][i] = data_[j][i+AC_PPC];
+    }
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int k=0; k<AC_PPC; k++) {
+      data_[j][AC_HSPAN - AC_PPC + k] = wout_[j].px[k];
+    }
+
+    // View p covers columns p to p + AC_WN_COL - 1 of the shift register.
+    #ifdef __SYNTHESIS__
+    #pragma hls_unroll yes
+    #endif
+    for (int p=0; p<AC_PPC; p++) {
+      #ifdef __SYNTHESIS__
+      #pragma hls_unroll yes
+      #endif
+      for (int i=0; i<AC_WN_COL; i++) {
+        woutH_[p][j][i] = data_[j][p+i];
+      }
+
+      bool s_, e_;
+      #pragma hls_waive CNS
+      if (AC_WMODE&AC_CLIP) {
+        s_ = false;
+        #ifdef __SYNTHESIS__
+        #pragma hls_unroll yes // lower clipping
+        #endif
+        for (int i=AC_WN_COL/2-1; i>=0; i--) {
+          s_ |= colSol_[p+i+1];
+          woutH_[p][j][i] = s_ ? woutH_[p][j][i+1] : woutH_[p][j][i];
+        }
+
+        e_ = false;
+        #ifdef __SYNTHESIS__
+        #pragma hls_unroll yes // upper clipping
+        #endif
+        for (int i=AC_WN_COL/2+1; i< AC_WN_COL; i++) {
+          e_ |= colEol_[p+i-1];
+          woutH_[p][j][i] = e_ ? woutH_[p][j][i-1] : woutH_[p][j][i];
+        }
+      }
+
+      #pragma hls_waive CNS
+      if (AC_WMODE&AC_MIRROR) {
+        s_ = false;
+        int m_ = 0;
+        #ifdef __SYNTHESIS__
+        #pragma hls_unroll yes // lower clipping
+        #endif
+        for (int i=AC_WN_COL/2 - 1; i>=0; i--) {
+          s_ |= colSol_[p+i+1];
+          if (colSol_[p+i+1]==1) { m_ = i+1; }
+          woutH_[p][j][i] = s_ ? woutH_[p][j][m_*2 - i] : woutH_[p][j][i];
+        }
+
+        e_ = false;
+        #ifdef __SYNTHESIS__
+        #pragma hls_unroll yes // upper clipping
+        #endif
+        for (int i=AC_WN_COL/2+1; i< AC_WN_COL; i++) {
+          e_ |= colEol_[p+i-1];
+          if (colEol_[p+i-1]==1) { m_ = i-1; }
+          woutH_[p][j][i] = e_ ? woutH_[p][j][m_*2-i] : woutH_[p][j][i];
+        }
+      }
+
+      #pragma hls_waive CNS
+      if (AC_WMODE&AC_BOUNDARY) {
+        s_ = false;
+        #ifdef __SYNTHESIS__
+        #pragma hls_unroll yes // lower clipping
+        #endif
+        for (int i=AC_WN_COL/2-1; i>=0; i--) {
+          s_ |= colSol_[p+i+1];
+          woutH_[p][j][i] = s_ ? boundaryVal : woutH_[p][j][i];
+        }
+
+        e_ = false;
+        #ifdef __SYNTHESIS__
+        #pragma hls_unroll yes // upper clipping
+        #endif
+        for (int i=AC_WN_COL/2+1; i< AC_WN_COL; i++) {
+          e_ |= colEol_[p+i-1];
+          woutH_[p][j][i] = e_ ? boundaryVal : woutH_[p][j][i];
+        }
+      }
+    }
+  }
+
+  solOut = sol_[0];
+  eolOut = eol_[0];
+
+  if (sof_[AC_WN_ROW/2]==1 && solOut) { // prefill finished
+    rampup_=true;
+  }
+}
+
+// Access tap (r, c) of the window view centered on pixel p of the output group.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+inline  T &ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::operator() (int p, int r, int c)
+{
+  #ifndef __SYNTHESIS__
+  assert((0 <= p) && (p < AC_PPC));
+  if (!(AC_WMODE&AC_LIN_INDEX)) {
+    assert((-AC_WN_ROW/2 <= r) && (r <= AC_WN_ROW/2));
+    assert((-AC_WN_COL/2 <= c) && (c <= AC_WN_COL/2));
+  } else {
+    assert((0 <= r) && (r < AC_WN_ROW));
+    assert((0 <= c) && (c < AC_WN_COL));
+  }
+  #endif
+  #pragma hls_waive CNS
+  if (!(AC_WMODE&AC_LIN_INDEX)) {
+    return woutH_[p][r+AC_WN_ROW/2][c+AC_WN_COL/2];
+  } else {
+    return woutH_[p][r][c];
+  }
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+inline  const T &ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::operator() (int p, int r, int c) const
+{
+  #ifndef __SYNTHESIS__
+  assert((0 <= p) && (p < AC_PPC));
+  if (!(AC_WMODE&AC_LIN_INDEX)) {
+    assert((-AC_WN_ROW/2 <= r) && (r <= AC_WN_ROW/2));
+    assert((-AC_WN_COL/2 <= c) && (c <= AC_WN_COL/2));
+  } else {
+    assert((0 <= r) && (r < AC_WN_ROW));
+    assert((0 <= c) && (c < AC_WN_COL));
+  }
+  #endif
+  #pragma hls_waive CNS
+  if (!(AC_WMODE&AC_LIN_INDEX)) {
+    return woutH_[p][r+AC_WN_ROW/2][c+AC_WN_COL/2];
+  } else {
+    return woutH_[p][r][c];
+  }
+}
+
+// The flags apply to the whole output group: sol to view 0 and eol to view AC_PPC-1.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NCOL, int AC_WMODE, int AC_PPC>
+void ac_window_2d_flag_ppc<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE,AC_PPC>::readFlags(bool &sof, bool &eof, bool &sol, bool &eol)
+{
+  sof = sofOut_[0];
+  eof = eofOut_[0];
+  sol = solOut & rampup_;
+  eol = eolOut & rampup_;
+}
+
+#if __cplusplus >= 201103L
+// Conversion between the AXI4-Stream RGB_2PPC pixel type and the 2-PPC window input/output type.
+// TUSER and TLAST are not carried by ac_ppc_pixels and must be handled by the caller.
+template<unsigned CDEPTH>
+void ac_ppc_unpack(const ac_ipl::RGB_2PPC<CDEPTH> &din, ac_ppc_pixels<ac_ipl::RGB_imd<ac_int<CDEPTH,false> >, 2> &dout)
+{
+  dout.px[0].R = din.R0;
+  dout.px[0].G = din.G0;
+  dout.px[0].B = din.B0;
+  dout.px[1].R = din.R1;
+  dout.px[1].G = din.G1;
+  dout.px[1].B = din.B1;
+}
+
+template<unsigned CDEPTH>
+void ac_ppc_pack(const ac_ppc_pixels<ac_ipl::RGB_imd<ac_int<CDEPTH,false> >, 2> &din, ac_ipl::RGB_2PPC<CDEPTH> &dout)
+{
+  dout.R0 = din.px[0].R;
+  dout.G0 = din.px[0].G;
+  dout.B0 = din.px[0].B;
+  dout.R1 = din.px[1].R;
+  dout.G1 = din.px[1].G;
+  dout.B1 = din.px[1].B;
+}
+#endif
+
+#endif
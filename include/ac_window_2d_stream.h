@@ -51,7 +51,29 @@
 
 
 #include "ac_window_2d_flag.h"
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE = AC_WIN|AC_DUALPORT>
+
+// Direct-addressing C simulation model. When the source is a complete frame in host memory, defining
+// AC_WINDOW_2D_STREAM_DIRECT_SIM computes each window tap by clamped (AC_CLIP) or mirrored (AC_MIRROR)
+// index arithmetic directly into the source array, instead of pushing every pixel through the line buffers
+// of ac_window_2d_flag. The window values and valid() are bit-identical to the line buffer model. Each
+// array passed to write() must hold a complete frame (or several frames back to back). A frame can be in
+// a different array than the previous one: the previous array must then stay valid until the last window
+// of its frame has been output, i.e. AC_WN_ROW/2 lines and AC_WN_COL/2 pixels into the new frame. All the
+// frames of a stream must have the same size, and the pixels written after the last frame to flush the
+// window are not read. Only odd window sizes with AC_CLIP or AC_MIRROR use the direct model; other window
+// modes always use the line buffer model.
+//
+// The AC_DIRECT_SIM template argument selects the model for one window type, e.g. to compare the two
+// models in one test. It defaults to the setting of AC_WINDOW_2D_STREAM_DIRECT_SIM, and is ignored in
+// synthesis.
+#if defined(AC_WINDOW_2D_STREAM_DIRECT_SIM) && !defined(__SYNTHESIS__)
+#define AC_WINDOW_2D_STREAM_DIRECT 1
+#else
+#define AC_WINDOW_2D_STREAM_DIRECT 0
+#endif
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE = AC_WIN|AC_DUALPORT,
+         bool AC_DIRECT_SIM = bool(AC_WINDOW_2D_STREAM_DIRECT)>
 class ac_window_2d_stream
 {
 public:
@@ -78,6 +100,20 @@ private:
                   AC_NCOL < 32768 ? 15 : AC_NCOL < 65536 ? 16 : 32)
   };
   ac_window_2d_flag<T,AC_WN_ROW,AC_WN_COL,AC_NCOL,AC_WMODE> w;   //window flag class
+#ifdef __SYNTHESIS__
+  enum { AC_DIRECT = 0 };
+#else
+  enum {
+    AC_DIRECT = AC_DIRECT_SIM && (AC_WN_ROW%2 == 1) && (AC_WN_COL%2 == 1) && bool(AC_WMODE&(AC_CLIP|AC_MIRROR))
+  };
+#endif
+  int directIndex(int i, int n) const;
+  T    *base_;         // Direct model: start of the frame being output
+  T    *nextBase_;     // Direct model: start of the frame being input, once it has started
+  long  outIdx_;       // Direct model: index of the output pixel in that frame, negative during rampup
+  int   outRows_;      // Direct model: size of that frame
+  int   outCols_;
+  bool  dvalid_;       // Direct model: has the window ramped up?
   ac_int<logAC_NROW+1, false> row_cnt_;
   ac_int<logAC_NCOL+1, false> col_cnt_;                              // Counter, state variable used to determine if:
   //  1/ window has ramped up and data is valid
@@ -94,7 +130,7 @@ private:
 };
 
 // The only defined CTOR
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE> ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE>::ac_window_2d_stream()
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE, bool AC_DIRECT_SIM> ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE, AC_DIRECT_SIM>::ac_window_2d_stream()
 {
   row_cnt_= 0;
   col_cnt_= 0;
@@ -102,6 +138,12 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC
   row_sz_prev_=0;
   col_sz_=0;
   col_sz_prev_=0;
+  base_ = 0;
+  nextBase_ = 0;
+  outIdx_ = 0;
+  outRows_ = 0;
+  outCols_ = 0;
+  dvalid_ = false;
 
   ac_compile_time_assert((AC_WN_ROW > 0), ac_window_must_have_positive_window_width ) ;
   ac_compile_time_assert((AC_WN_COL > 0), ac_window_must_have_positive_window_height ) ;
@@ -118,8 +160,8 @@ template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC
 
 // "Connect" the input data to the window.
 // Can't be done in the ctor anymore, as the object must be made static...
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE>
-void ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL,AC_WMODE>::write(T *s, int row_sz, int col_sz)
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE, bool AC_DIRECT_SIM>
+void ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE, AC_DIRECT_SIM>::write(T *s, int row_sz, int col_sz)
 {
   src_=s;
   row_sz_=row_sz;
@@ -127,14 +169,16 @@ void ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL,AC_WMODE>::wr
 };
 
 // Have we passed the first WN/2+1 rampup cycles? Is this now valid data?
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE>
-bool ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE>::valid()
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE, bool AC_DIRECT_SIM>
+bool ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE, AC_DIRECT_SIM>::valid()
 {
+  #pragma hls_waive CNS
+  if (AC_DIRECT) { return dvalid_; }
   return w.valid();
 };
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE>
-int ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE>::operator++ ()
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE, bool AC_DIRECT_SIM>
+int ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE, AC_DIRECT_SIM>::operator++ ()
 {
 
   if (col_cnt_==0)
@@ -161,7 +205,35 @@ int ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE>::op
   else
   { eof_ = 0; }
 
-  w.write(*src_++,sof_,eof_,sol_,eol_);
+  #pragma hls_waive CNS
+  if (AC_DIRECT) {
+    // The output lags the input by AC_WN_ROW/2 lines and AC_WN_COL/2 pixels. The first write of the first
+    // frame starts the output counter, which then runs on through the following frames. The start of each
+    // following frame is recorded when its first pixel is written, which may be in a new source array, and
+    // the output moves to it after the last window of the previous frame.
+    if (sof_) {
+      if (base_ == 0) {
+        base_ = src_;
+        outRows_ = row_sz_prev_;
+        outCols_ = col_sz_prev_;
+        outIdx_ = -long(AC_WN_ROW/2)*outCols_ - AC_WN_COL/2 - 1;
+      } else {
+        #ifndef __SYNTHESIS__
+        assert(row_sz_prev_ == outRows_ && col_sz_prev_ == outCols_ && "The direct model needs frames of the same size");
+        #endif
+        nextBase_ = src_;
+      }
+    }
+    src_++;
+    outIdx_++;
+    if (outIdx_ == long(outRows_)*outCols_) {
+      base_ = nextBase_;
+      outIdx_ = 0;
+    }
+    dvalid_ = dvalid_ || outIdx_ >= 0;
+  } else {
+    w.write(*src_++,sof_,eof_,sol_,eol_);
+  }
 
   if (col_cnt_!=(col_sz_prev_-1))
   { col_cnt_++; }
@@ -173,14 +245,45 @@ int ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE>::op
   return (int)(row_cnt_ * row_sz_prev_ + col_cnt_);
 }
 
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE>
-inline  T &ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE>::operator() (int r, int c)
+// Source index of window tap i of a line or column of n pixels, with the boundary processing of the window mode.
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE, bool AC_DIRECT_SIM>
+inline int ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE, AC_DIRECT_SIM>::directIndex(int i, int n) const
 {
+  if (AC_WMODE&AC_MIRROR) {
+    if (i < 0) { i = -i; }
+    if (i > n - 1) { i = 2*(n - 1) - i; }
+  }
+  if (i < 0) { i = 0; }
+  if (i > n - 1) { i = n - 1; }
+  return i;
+}
+
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE, bool AC_DIRECT_SIM>
+inline  T &ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE, AC_DIRECT_SIM>::operator() (int r, int c)
+{
+  #pragma hls_waive CNS
+  if (AC_DIRECT) {
+    if (AC_WMODE&AC_LIN_INDEX) {
+      r -= AC_WN_ROW/2;
+      c -= AC_WN_COL/2;
+    }
+    const int y = outIdx_/outCols_, x = outIdx_%outCols_;
+    return base_[directIndex(y + r, outRows_)*outCols_ + directIndex(x + c, outCols_)];
+  }
   return w(r,c);
 }
-template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE>
-inline  const T &ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE>::operator()(int r, int c) const
+template<class T, int AC_WN_ROW, int AC_WN_COL, int AC_NROW, int AC_NCOL, int AC_WMODE, bool AC_DIRECT_SIM>
+inline  const T &ac_window_2d_stream<T, AC_WN_ROW, AC_WN_COL, AC_NROW, AC_NCOL, AC_WMODE, AC_DIRECT_SIM>::operator()(int r, int c) const
 {
+  #pragma hls_waive CNS
+  if (AC_DIRECT) {
+    if (AC_WMODE&AC_LIN_INDEX) {
+      r -= AC_WN_ROW/2;
+      c -= AC_WN_COL/2;
+    }
+    const int y = outIdx_/outCols_, x = outIdx_%outCols_;
+    return base_[directIndex(y + r, outRows_)*outCols_ + directIndex(x + c, outCols_)];
+  }
   return w(r,c);
 }
 
@@ -0,0 +1,121 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_window_2d_subview.h
+//
+// Description:
+//  Concentric sub-views of a 2D window. ac_window_2d_subview gives read access to the centered
+//  AC_SUB_ROW x AC_SUB_COL part of a larger window, e.g. the 3x3 and 5x5 neighborhoods of a 7x7
+//  ac_window_2d_flag. Filters of several kernel sizes can thus be evaluated on the same input from a
+//  single set of line buffers, instead of one window (and one set of AC_NCOL-deep line buffers) per
+//  kernel size.
+//
+//  With AC_CLIP, AC_MIRROR and AC_BOUNDARY, the boundary processing of each output does not depend on
+//  the window size, so a sub-view holds the same values as a separate AC_SUB_ROW x AC_SUB_COL window
+//  with the same window mode. The sub-view shares the valid() and readFlags() state of the full window.
+//
+// Usage:
+//    typedef ac_window_2d_flag<ac_int<8,false>, 7, 7, 1920, AC_MIRROR> windType;
+//    windType win;
+//    ...
+//    win.write(pix, sof, eof, sol, eol);
+//    if (win.valid()) {
+//      ac_window_2d_subview<windType, 3, 3> win3(win);
+//      ac_window_2d_subview<windType, 5, 5> win5(win);
+//      out3 = win3(-1, -1) + ... + win3(1, 1);
+//      out5 = win5(-2, -2) + ... + win5(2, 2);
+//    }
+//
+// Notes:
+//  - Sub-view and window sizes must be odd, and the sub-view must not be larger than the window.
+//  - Indexing follows the window mode of the full window: -AC_SUB_ROW/2 .. AC_SUB_ROW/2 by default, or
+//    0 .. AC_SUB_ROW-1 with AC_LIN_INDEX.
+//  - With AC_WIN, only the windows of the full window size are output, so the sub-views only cover
+//    the output positions of the full window.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_WINDOW_2D_SUBVIEW_H
+#define __AC_WINDOW_2D_SUBVIEW_H
+
+#include "ac_window_1d_flag.h"
+
+#ifndef __SYNTHESIS__
+#include <cassert>
+#endif
+
+template<class WINDOW_TYPE, int AC_SUB_ROW, int AC_SUB_COL>
+class ac_window_2d_subview
+{
+public:
+  typedef typename WINDOW_TYPE::value_type value_type;
+  enum {
+    ROWS = AC_SUB_ROW,
+    COLS = AC_SUB_COL,
+    WMODE = WINDOW_TYPE::WMODE,
+    OFFSET_ROW = (WINDOW_TYPE::ROWS - AC_SUB_ROW)/2, // Position of the sub-view in the window, with AC_LIN_INDEX.
+    OFFSET_COL = (WINDOW_TYPE::COLS - AC_SUB_COL)/2
+  };
+
+  ac_window_2d_subview(const WINDOW_TYPE &w) : wind(w) {
+    #ifndef __SYNTHESIS__
+    assert(AC_SUB_ROW%2 == 1 && AC_SUB_COL%2 == 1);
+    assert(WINDOW_TYPE::ROWS%2 == 1 && WINDOW_TYPE::COLS%2 == 1);
+    assert(AC_SUB_ROW <= int(WINDOW_TYPE::ROWS) && AC_SUB_COL <= int(WINDOW_TYPE::COLS));
+    #endif
+  }
+  const value_type &operator()(int r, int c) const;
+
+private:
+  const WINDOW_TYPE &wind;
+};
+
+template<class WINDOW_TYPE, int AC_SUB_ROW, int AC_SUB_COL>
+inline const typename WINDOW_TYPE::value_type &ac_window_2d_subview<WINDOW_TYPE,AC_SUB_ROW,AC_SUB_COL>::operator()(int r, int c) const
+{
+  #ifndef __SYNTHESIS__
+  if (!(WMODE&AC_LIN_INDEX)) {
+    assert((-AC_SUB_ROW/2 <= r) && (r <= AC_SUB_ROW/2));
+    assert((-AC_SUB_COL/2 <= c) && (c <= AC_SUB_COL/2));
+  } else {
+    assert((0 <= r) && (r < AC_SUB_ROW));
+    assert((0 <= c) && (c < AC_SUB_COL));
+  }
+  #endif
+  #pragma hls_waive CNS
+  if (!(WMODE&AC_LIN_INDEX)) {
+    return wind(r, c);
+  } else {
+    return wind(r + OFFSET_ROW, c + OFFSET_COL);
+  }
+}
+
+#endif
@@ -248,4 +248,51 @@ struct ac_width2x<unsigned char, IS_SINGLEPORT> {
   }
 };
 
+// Structs that pack AC_N narrow pixels into one line buffer word, for the AC_PACK4/AC_PACK8/AC_PACK16
+// line buffer modes. set_part() and get_part() access the pixel at position sel of the word.
+template<typename T, int AC_N>
+struct ac_widthNx {
+  typedef T data;
+  static void set_part(int sel, T din, data &dout) {
+    #ifndef __SYNTHESIS__
+    printf("ERROR: A user-defined specialization of this struct ac_widthNx must be created when using\n");
+    printf("user-defined classes and packed line buffers (AC_PACK4/AC_PACK8/AC_PACK16).\n");
+    assert(0);
+    #endif
+  }
+  static void get_part(int sel, data  din, T &dout) {
+    #ifndef __SYNTHESIS__
+    printf("ERROR: A user-defined specialization of this struct ac_widthNx must be created when using\n");
+    printf("user-defined classes and packed line buffers (AC_PACK4/AC_PACK8/AC_PACK16).\n");
+    assert(0);
+    #endif
+  }
+};
+
+//ac_int packed line buffer support
+template<int AC_WIDTH, bool AC_SIGN, int AC_N>
+struct ac_widthNx<ac_int<AC_WIDTH,AC_SIGN>, AC_N> {
+  typedef ac_int<AC_WIDTH*AC_N,false> data;
+  static void set_part(int sel, ac_int<AC_WIDTH,AC_SIGN> din, data &dout) {
+    dout.set_slc(sel*AC_WIDTH, din);
+  }
+  static void get_part(int sel, data  din, ac_int<AC_WIDTH,AC_SIGN> &dout) {
+    ac_int<AC_WIDTH, false> part_slc = din.template slc<AC_WIDTH>(sel*AC_WIDTH);
+    dout.set_slc(0, part_slc);
+  }
+};
+
+//ac_fixed packed line buffer support
+template<int AC_WIDTH, int AC_INTEGER, bool AC_SIGN, ac_q_mode AC_Q, ac_o_mode AC_O, int AC_N>
+struct ac_widthNx<ac_fixed<AC_WIDTH, AC_INTEGER, AC_SIGN, AC_Q, AC_O>, AC_N> {
+  typedef ac_int<AC_WIDTH*AC_N,false> data;
+  static void set_part(int sel, ac_fixed<AC_WIDTH,AC_INTEGER,AC_SIGN,AC_Q,AC_O> din, data &dout) {
+    dout.set_slc(sel*AC_WIDTH, din.template slc<AC_WIDTH>(0));
+  }
+  static void get_part(int sel, data  din, ac_fixed<AC_WIDTH,AC_INTEGER,AC_SIGN,AC_Q,AC_O> &dout) {
+    ac_int<AC_WIDTH, false> part_slc = din.template slc<AC_WIDTH>(sel*AC_WIDTH);
+    dout.set_slc(0, part_slc);
+  }
+};
+
 #endif
@@ -18,7 +18,31 @@ set SOURCES_CPP=rtest_ac_canny;^
   rtest_ac_dwt2_pyr;^
   rtest_ac_packed_vector;^
   rtest_ac_flag_gen;^
-  rtest_ac_window_v2
+  rtest_ac_window_v2;^
+  rtest_ac_window_2d_flag_ppc;^
+  rtest_ac_window_2d_flag_write_line;^
+  rtest_ac_window_2d_flag_separable;^
+  rtest_ac_window_2d_flag_pack;^
+  rtest_ac_window_2d_flag_stripe;^
+  rtest_ac_window_2d_flag_mc;^
+  rtest_ac_window_2d_flag_b2b;^
+  rtest_ac_window_2d_flag_storage;^
+  rtest_ac_stencil_2d;^
+  rtest_ac_stencil_2d_axis;^
+  rtest_ac_window_2d_subview;^
+  rtest_ac_fir_1d_polyphase;^
+  rtest_ac_window_2d_stream_direct;^
+  rtest_ac_transpose_tile;^
+  rtest_ac_window_2d_dilated;^
+  rtest_ac_perf;^
+  rtest_ac_range;^
+  rtest_ac_resource;^
+  rtest_ac_trace;^
+  rtest_ac_delay_line;^
+  rtest_ac_dataflow;^
+  rtest_ac_buffer_2d_host;^
+  rtest_ac_buffer_2d_hw_sim;^
+  rtest_ac_window_edge
 
 ::Compile and execute the unit tests
 (for %%a in (%SOURCES_CPP%) do ( 
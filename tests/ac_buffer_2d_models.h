@@ -0,0 +1,182 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_buffer_2d_models.h
+//
+// Description:
+//  Regression tests of the ac_buffer_2d line buffer, shared by rtest_ac_buffer_2d_host.cpp, which builds
+//  them with the host-optimized C simulation model, and rtest_ac_buffer_2d_hw_sim.cpp, which builds them
+//  with the synthesis model (AC_BUFFER_2D_HW_SIM). Both models are checked against the same reference
+//  models, window by window and output by output, so the two tests together check that the models are
+//  interchangeable in every mode: AC_CLIP, AC_MIRROR, AC_BOUNDARY, AC_SINGLEPORT, AC_REWIND and the packed
+//  modes.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_BUFFER_2D_MODELS_H
+#define __AC_BUFFER_2D_MODELS_H
+
+#include <ac_window_2d_flag.h>
+#include <ac_buffer_2d.h>
+#include "ac_window_2d_ref.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Stream a random width x height image through ac_window_2d_flag, whose line buffers are an ac_buffer_2d,
+// followed by dummy inputs until the end-of-frame output is seen. Every window and its output flags are
+// compared against the reference model.
+template <class T, int K_SZ, int W_MAX, int WMODE>
+bool test_driver_window(const char *modeName, int width, int height)
+{
+  std::cout << "TEST: ac_buffer_2d window K_SZ: " << K_SZ << " WMODE: ";
+  std::cout.width(27);
+  std::cout << std::left << modeName << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  const T bval = 7;
+  std::vector<int> img(width*height);
+  for (int k = 0; k < width*height; k++) { img[k] = rand() & 255; }
+
+  ac_window_2d_flag<T, K_SZ, K_SZ, W_MAX, WMODE> acWindObj(bval);
+  int i = 0, j = 0, oi = 0, oj = 0, nOut = 0;
+  bool inRead = true, eofOut = false, pass = true;
+  do {
+    T pixIn = inRead ? T(img[i*width + j]) : T(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    acWindObj.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool sofOut, solOut, eolOut;
+    acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (acWindObj.valid()) {
+      if (solOut != (oj == 0) || eolOut != (oj == width - 1) || sofOut != (oi == 0 && oj == 0) || eofOut != (oi == height - 1 && oj == width - 1)) {
+        std::cout << "FAILED. Unexpected output flag value(s) at row " << oi << ", column " << oj << "." << std::endl;
+        pass = false;
+      }
+      for (int r = -K_SZ/2; r <= K_SZ/2 && pass; r++) {
+        for (int c = -K_SZ/2; c <= K_SZ/2 && pass; c++) {
+          if (acWindObj(r, c) != refTap<T, WMODE>(&img[0], width, height, oi, oj, r, c, bval)) {
+            std::cout << "FAILED. Window mismatch at row " << oi << ", column " << oj << "." << std::endl;
+            pass = false;
+          }
+        }
+      }
+      nOut++;
+      oj++;
+      if (oj == width) {
+        oj = 0;
+        oi++;
+      }
+    }
+  } while (!eofOut && pass);
+
+  if (pass && nOut != width*height) {
+    std::cout << "FAILED. Incorrect output size." << std::endl;
+    pass = false;
+  }
+
+  if (pass) { std::cout << "PASSED." << std::endl; }
+  return pass;
+}
+
+// Write n_lines random lines of width pixels to an ac_buffer_2d of AC_NROW rows. With AC_REWIND, each line
+// is followed by n_passes-1 passes that read the stored lines again without writing (w false). At column i
+// of line L, row k of the output must hold pixel i of line L-k, for every line written so far.
+template <class T, int AC_NCOL, int AC_NROW, int WMODE>
+bool test_driver_buffer(const char *modeName, int width, int n_lines, int n_passes)
+{
+  std::cout << "TEST: ac_buffer_2d lines  NROW: " << AC_NROW << " WMODE: ";
+  std::cout.width(27);
+  std::cout << std::left << modeName << " SIZE: " << width << "x" << n_lines << " RESULT: ";
+
+  ac_buffer_2d<T, AC_NCOL, AC_NROW, WMODE> buf;
+  std::vector<std::vector<int> > lines;
+  bool pass = true;
+  for (int L = 0; L < n_lines && pass; L++) {
+    lines.push_back(std::vector<int>(width));
+    for (int i = 0; i < width; i++) { lines[L][i] = rand() & 255; }
+    for (int p = 0; p < n_passes && pass; p++) {
+      const bool w = (p == 0);
+      for (int i = 0; i < width && pass; i++) {
+        buf.write(T(lines[L][i]), i, w);
+        for (int k = (w || (WMODE & AC_REWIND)) ? 0 : 1; k < AC_NROW && k <= L; k++) {
+          // buf[AC_NROW-1] is the newest row.
+          if (buf[AC_NROW - 1 - k] != T(lines[L - k][i])) {
+            std::cout << "FAILED. Mismatch in row " << k << " at line " << L << ", pass " << p << ", column " << i << "." << std::endl;
+            pass = false;
+          }
+        }
+      }
+    }
+  }
+
+  if (pass) { std::cout << "PASSED." << std::endl; }
+  return pass;
+}
+
+// Run all the tests on the ac_buffer_2d model that the including test is built with.
+inline bool test_ac_buffer_2d_models()
+{
+  typedef ac_int<8, false> pixType;
+  typedef ac_int<2, false> angType;
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver_window<pixType, 3, 64, AC_CLIP>("AC_CLIP", 20, 9)                                      && all_tests_pass;
+  all_tests_pass = test_driver_window<pixType, 5, 64, AC_MIRROR>("AC_MIRROR", 21, 12)                                 && all_tests_pass;
+  all_tests_pass = test_driver_window<pixType, 5, 64, AC_BOUNDARY>("AC_BOUNDARY", 16, 7)                              && all_tests_pass;
+  all_tests_pass = test_driver_window<pixType, 3, 64, AC_CLIP|AC_SINGLEPORT>("AC_CLIP|AC_SINGLEPORT", 24, 8)          && all_tests_pass;
+  all_tests_pass = test_driver_window<pixType, 5, 64, AC_MIRROR|AC_SINGLEPORT>("AC_MIRROR|AC_SINGLEPORT", 22, 9)      && all_tests_pass;
+  all_tests_pass = test_driver_window<pixType, 3, 64, AC_BOUNDARY|AC_SINGLEPORT>("AC_BOUNDARY|AC_SINGLEPORT", 18, 6)  && all_tests_pass;
+  all_tests_pass = test_driver_window<angType, 3, 64, AC_BOUNDARY|AC_PACK8>("AC_BOUNDARY|AC_PACK8", 21, 8)            && all_tests_pass;
+  all_tests_pass = test_driver_window<angType, 5, 64, AC_MIRROR|AC_PACK4|AC_SINGLEPORT>("AC_MIRROR|AC_PACK4|AC_SP", 20, 10) && all_tests_pass;
+  all_tests_pass = test_driver_window<angType, 5, 64, AC_CLIP|AC_PACK16>("AC_CLIP|AC_PACK16", 37, 9)                  && all_tests_pass;
+
+  all_tests_pass = test_driver_buffer<pixType, 32, 3, AC_DUALPORT>("AC_DUALPORT", 20, 6, 1)                           && all_tests_pass;
+  all_tests_pass = test_driver_buffer<pixType, 32, 3, AC_SINGLEPORT>("AC_SINGLEPORT", 20, 6, 1)                       && all_tests_pass;
+  all_tests_pass = test_driver_buffer<pixType, 32, 3, AC_DUALPORT|AC_PACK4>("AC_DUALPORT|AC_PACK4", 21, 6, 1)         && all_tests_pass;
+  all_tests_pass = test_driver_buffer<pixType, 32, 3, AC_DUALPORT|AC_REWIND>("AC_DUALPORT|AC_REWIND", 20, 6, 3)       && all_tests_pass;
+  all_tests_pass = test_driver_buffer<pixType, 32, 3, AC_SINGLEPORT|AC_REWIND>("AC_SINGLEPORT|AC_REWIND", 20, 6, 3)   && all_tests_pass;
+  all_tests_pass = test_driver_buffer<pixType, 32, 5, AC_DUALPORT|AC_REWIND|AC_PACK4>("AC_REWIND|AC_PACK4", 22, 8, 2) && all_tests_pass;
+
+  return all_tests_pass;
+}
+
+#endif
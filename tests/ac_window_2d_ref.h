@@ -0,0 +1,67 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+//*********************************************************************************************************
+// File: ac_window_2d_ref.h
+//
+// Description:
+//  Reference model of the window taps, shared by the window regression tests. refTap() returns the value a
+//  window centered on pixel (y, x) of an image should hold at tap (r, c), after applying the boundary
+//  condition selected by the AC_CLIP, AC_MIRROR or AC_BOUNDARY bit of WMODE.
+//
+//*********************************************************************************************************
+
+#ifndef __AC_WINDOW_2D_REF_H
+#define __AC_WINDOW_2D_REF_H
+
+#include <ac_window_1d_flag.h>
+
+// Reference model for a single window tap. Returns the value of pixel (y + r, x + c), after applying the
+// boundary condition specified by WMODE.
+template <class T, int WMODE>
+T refTap(const int *img, int width, int height, int y, int x, int r, int c, T bval)
+{
+  int row = y + r;
+  int col = x + c;
+  if (WMODE & AC_BOUNDARY) {
+    if (row < 0 || row >= height || col < 0 || col >= width) { return bval; }
+  }
+  if (WMODE & AC_CLIP) {
+    row = row < 0 ? 0 : (row >= height ? height - 1 : row);
+    col = col < 0 ? 0 : (col >= width ? width - 1 : col);
+  }
+  if (WMODE & AC_MIRROR) {
+    row = row < 0 ? -row : (row >= height ? 2*(height - 1) - row : row);
+    col = col < 0 ? -col : (col >= width ? 2*(width - 1) - col : col);
+  }
+  return T(img[row*width + col]);
+}
+
+#endif
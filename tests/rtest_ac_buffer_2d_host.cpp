@@ -0,0 +1,58 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+// The host-optimized C simulation model of ac_buffer_2d.
+#undef AC_BUFFER_2D_HW_SIM
+#include "ac_buffer_2d_models.h"
+
+#include <iostream>
+using namespace std;
+
+// See ac_buffer_2d_models.h. Runs the line buffer tests on the host-optimized C simulation model.
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_buffer_2d_host.cpp ---------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = test_ac_buffer_2d_models();
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_buffer_2d_host - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_buffer_2d_host - PASSED" << endl;
+
+  return 0;
+}
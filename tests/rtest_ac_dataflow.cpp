@@ -0,0 +1,286 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+// Shallow FIFOs, so that the blocks wait on each other all the time.
+#define AC_DATAFLOW_THREADS
+#define AC_DATAFLOW_FIFO_DEPTH 16
+#include <ac_ipl/ac_canny.h>
+#include <ac_ipl/ac_harris.h>
+#include <ac_ipl/ac_localcontrastnorm.h>
+#include <ac_ipl/ac_opticalflow.h>
+#include <ac_ipl/ac_gaussian_pyr.h>
+#include <ac_ipl/ac_dwt2_pyr.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+// Compare and read out the design outputs.
+template <class T>
+bool same(const T &a, const T &b) { return a == b; }
+
+template <unsigned CDEPTH>
+bool same(const ac_ipl::RGB_1PPC<CDEPTH> &a, const ac_ipl::RGB_1PPC<CDEPTH> &b)
+{
+  return a.R == b.R && a.G == b.G && a.B == b.B;
+}
+
+template <class T>
+bool same(const out_struct<T> &a, const out_struct<T> &b)
+{
+  return a.out_ap == b.out_ap && a.out_ho == b.out_ho && a.out_ve == b.out_ve && a.out_di == b.out_di;
+}
+
+template <class T>
+void drain(ac_channel<T> &chan, vector<T> &out)
+{
+  while (chan.available(1)) { out.push_back(chan.read()); }
+}
+
+// The chain of blocks of the FIFO test.
+void produce(ac_spsc_channel<int> &out, int n)
+{
+  for (int i = 0; i < n; i++) { out.write(i); }
+}
+
+void relay(ac_spsc_channel<int> &in, ac_spsc_channel<int> &out, int n)
+{
+  for (int i = 0; i < n; i++) { out.write(3*in.read() + 1); }
+}
+
+void consume(ac_spsc_channel<int> &in, vector<int> &out, int n)
+{
+  for (int i = 0; i < n; i++) { out.push_back(in.read()); }
+}
+
+// Stream n tokens through a chain of three blocks, and check the token order and the FIFO occupancy: at most
+// the depth of the FIFO with threads, all of them with the sequential schedule. The first FIFO has a depth
+// of depthA tokens, the second one the default depth.
+bool test_driver_fifo(bool threads, int n, int depthA = AC_DATAFLOW_FIFO_DEPTH)
+{
+  cout << "TEST: ac_spsc_channel THREADS: " << (threads ? "true " : "false") << " TOKENS: " << n;
+  cout << " DEPTH: " << depthA << " RESULT: ";
+
+  ac_dataflow_set_threads(threads);
+  ac_spsc_channel<int> a, b, c;
+  AC_DATAFLOW_DEPTH(a, depthA);
+  AC_DATAFLOW_DISCARD(c, true);
+  vector<int> out;
+  AC_DATAFLOW_BEGIN(df);
+  AC_DATAFLOW_CALL(df, produce(a, n));
+  AC_DATAFLOW_CALL(df, relay(a, b, n));
+  AC_DATAFLOW_CALL(df, consume(b, out, n));
+  AC_DATAFLOW_CALL(df, produce(c, n));
+  AC_DATAFLOW_END(df);
+
+  bool pass = (int)out.size() == n && a.empty() && b.empty() && c.empty();
+  for (int i = 0; pass && i < n; i++) { pass = out[i] == 3*i + 1; }
+  if (threads) {
+    pass = pass && (int)a.depth() == depthA && (int)a.max_size() <= depthA && b.max_size() <= AC_DATAFLOW_FIFO_DEPTH;
+  } else {
+    pass = pass && (int)a.max_size() == n && (int)b.max_size() == n;
+  }
+  ac_dataflow_set_threads(true);
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Each design test runs two random frames through a fresh design object, and collects the outputs.
+template <int W_MAX, int H_MAX>
+struct canny_test {
+  typedef ac_canny<8, W_MAX, H_MAX> design_type;
+  typedef typename design_type::pixOutType out_type;
+  static const char *name() { return "ac_canny"; }
+  static void run(int width, int height, vector<out_type> &out) {
+    design_type design;
+    for (int f = 0; f < 2; f++) {
+      ac_channel<typename design_type::pixInType> streamIn;
+      ac_channel<out_type> streamOut;
+      for (int k = 0; k < width*height; k++) { streamIn.write(rand() & 255); }
+      design.run(streamIn, streamOut, width, height, 20, 60);
+      drain(streamOut, out);
+    }
+  }
+};
+
+template <int W_MAX, int H_MAX>
+struct harris_test {
+  typedef ac_int<8, false> out_type;
+  typedef ac_harris<ac_int<8, false>, out_type, 8, W_MAX, H_MAX> design_type;
+  static const char *name() { return "ac_harris"; }
+  static void run(int width, int height, vector<out_type> &out) {
+    design_type design;
+    for (int f = 0; f < 2; f++) {
+      ac_channel<ac_int<8, false> > streamIn;
+      ac_channel<out_type> streamOut;
+      for (int k = 0; k < width*height; k++) { streamIn.write(rand() & 255); }
+      design.run(streamIn, streamOut, width, height, 0, 6, 100);
+      drain(streamOut, out);
+    }
+  }
+};
+
+template <int W_MAX, int H_MAX>
+struct localcontrastnorm_test {
+  typedef ac_localcontrastnorm<8, W_MAX, H_MAX> design_type;
+  typedef typename design_type::pixOutType out_type;
+  static const char *name() { return "ac_localcontrastnorm"; }
+  static void run(int width, int height, vector<out_type> &out) {
+    design_type design;
+    for (int f = 0; f < 2; f++) {
+      ac_channel<typename design_type::pixInType> streamIn;
+      ac_channel<out_type> streamOut;
+      for (int k = 0; k < width*height; k++) {
+        typename design_type::pixInType pixIn;
+        pixIn.R = rand() & 255;
+        pixIn.G = rand() & 255;
+        pixIn.B = rand() & 255;
+        streamIn.write(pixIn);
+      }
+      design.run(streamIn, streamOut, width, height);
+      drain(streamOut, out);
+    }
+  }
+};
+
+template <int W_MAX, int H_MAX>
+struct opticalflow_test {
+  typedef ac_int<8, false> out_type;
+  typedef ac_opticalflow<out_type, 8, W_MAX, H_MAX> design_type;
+  static const char *name() { return "ac_opticalflow"; }
+  static void run(int width, int height, vector<out_type> &out) {
+    design_type design;
+    for (int f = 0; f < 2; f++) {
+      ac_channel<out_type> frame1, frame2, vx, vy;
+      for (int k = 0; k < width*height; k++) {
+        int pix = rand() & 255;
+        frame1.write(pix);
+        frame2.write((pix + (rand() & 15)) & 255);
+      }
+      design.run(frame1, frame2, vx, vy, width, height);
+      drain(vx, out);
+      drain(vy, out);
+    }
+  }
+};
+
+template <int W_MAX, int H_MAX>
+struct gaussian_pyr_test {
+  enum { N_LEVELS = 3 };
+  typedef ac_fixed<18, 8, false> out_type;
+  typedef ac_gaussian_pyr<ac_int<8, false>, out_type, W_MAX, H_MAX, N_LEVELS> design_type;
+  static const char *name() { return "ac_gaussian_pyr"; }
+  static void run(int width, int height, vector<out_type> &out) {
+    design_type design;
+    for (int f = 0; f < 2; f++) {
+      ac_channel<ac_int<8, false> > streamIn;
+      ac_channel<out_type> streamOut[N_LEVELS];
+      for (int k = 0; k < width*height; k++) { streamIn.write(rand() & 255); }
+      design.run(streamIn, streamOut, width, height);
+      for (int l = 0; l < N_LEVELS; l++) { drain(streamOut[l], out); }
+    }
+  }
+};
+
+template <int W_MAX, int H_MAX>
+struct dwt2_pyr_test {
+  enum { N_LEVELS = 3 };
+  typedef ac_fixed<24, 12, true> st_type;
+  typedef out_struct<st_type> out_type;
+  typedef ac_dwt2_pyr<AC_HAAR, ac_int<8, false>, st_type, W_MAX, H_MAX, N_LEVELS> design_type;
+  static const char *name() { return "ac_dwt2_pyr"; }
+  static void run(int width, int height, vector<out_type> &out) {
+    design_type design;
+    for (int f = 0; f < 2; f++) {
+      ac_channel<ac_int<8, false> > streamIn;
+      ac_channel<out_type> streamOut[N_LEVELS];
+      for (int k = 0; k < width*height; k++) { streamIn.write(rand() & 255); }
+      design.run(streamIn, streamOut, width, height);
+      for (int l = 0; l < N_LEVELS; l++) { drain(streamOut[l], out); }
+    }
+  }
+};
+
+// Run the design with the sequential schedule and with one thread per block, on the same input frames, and
+// check that the outputs are identical.
+template <class TEST>
+bool test_driver(int width, int height)
+{
+  cout << "TEST: ";
+  cout.width(20);
+  cout << left << TEST::name() << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  vector<typename TEST::out_type> ref, out;
+  ac_dataflow_set_threads(false);
+  srand(width*height);
+  TEST::run(width, height, ref);
+  ac_dataflow_set_threads(true);
+  srand(width*height);
+  TEST::run(width, height, out);
+
+  bool pass = !ref.empty() && out.size() == ref.size();
+  for (unsigned k = 0; pass && k < ref.size(); k++) { pass = same(out[k], ref[k]); }
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_dataflow.cpp ---------------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver_fifo(true, 10000)                                    && all_tests_pass;
+  all_tests_pass = test_driver_fifo(false, 1000)                                    && all_tests_pass;
+  all_tests_pass = test_driver_fifo(true, 10000, 7)                                 && all_tests_pass;
+  all_tests_pass = test_driver<canny_test<128, 64> >(64, 40)                        && all_tests_pass;
+  all_tests_pass = test_driver<canny_test<128, 64> >(37, 23)                        && all_tests_pass;
+  all_tests_pass = test_driver<harris_test<128, 64> >(64, 40)                       && all_tests_pass;
+  all_tests_pass = test_driver<localcontrastnorm_test<128, 64> >(48, 32)            && all_tests_pass;
+  all_tests_pass = test_driver<opticalflow_test<128, 64> >(48, 32)                  && all_tests_pass;
+  all_tests_pass = test_driver<gaussian_pyr_test<128, 64> >(64, 40)                 && all_tests_pass;
+  all_tests_pass = test_driver<gaussian_pyr_test<128, 64> >(45, 27)                 && all_tests_pass;
+  all_tests_pass = test_driver<dwt2_pyr_test<128, 64> >(64, 48)                     && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_dataflow - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_dataflow - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#define AC_PERF_COUNTERS
+#include <ac_ipl/ac_delay_line.h>
+#include <ac_ipl/ac_canny.h>
+#include <ac_ipl/ac_denoise_filter.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+using namespace std;
+
+// Ramp-up iterations of each block of one frame, from the "AC_PERF block=... rampup=..." lines. The ramp-up
+// of a block is the number of input pixels it reads before its first output.
+map<string, unsigned long long> parse_rampup(const string &log)
+{
+  map<string, unsigned long long> rampup;
+  istringstream is(log);
+  string line;
+  while (getline(is, line)) {
+    istringstream ls(line);
+    string tok, block;
+    ls >> tok;
+    if (tok != "AC_PERF") { continue; }
+    while (ls >> tok) {
+      size_t eq = tok.find('=');
+      if (tok.substr(0, eq) == "block") { block = tok.substr(eq + 1); }
+      if (tok.substr(0, eq) == "rampup") { rampup[block] += strtoull(tok.substr(eq + 1).c_str(), 0, 10); }
+    }
+  }
+  return rampup;
+}
+
+// Stream two width x height frames through the delay line, and check that the output is the input stream,
+// delayed by LINES*width + PIXELS iterations.
+template <int LINES, int PIXELS, int W_MAX, int H_MAX>
+bool test_driver(int width, int height)
+{
+  typedef ac_delay_line<ac_int<10, false>, LINES, PIXELS, W_MAX, H_MAX> delayType;
+  cout << "TEST: ac_delay_line LINES: " << LINES << " PIXELS: " << PIXELS;
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  delayType delayInst;
+  bool pass = true;
+  for (int f = 0; f < 2; f++) {
+    ac_channel<ac_int<10, false> > streamIn, streamOut, streamRef;
+    for (int k = 0; k < width*height; k++) {
+      ac_int<10, false> pix = rand() & 1023;
+      streamIn.write(pix);
+      streamRef.write(pix);
+    }
+    ostringstream log;
+    ac_perf_set_stream(log);
+    ac_perf_reset();
+    delayInst.run(streamIn, streamOut, width, height);
+    ac_perf_set_stream(cout);
+
+    pass = pass && streamOut.size() == streamRef.size();
+    while (pass && streamOut.available(1)) { pass = streamOut.read() == streamRef.read(); }
+    pass = pass && parse_rampup(log.str())["ac_delay_line::run"] == (unsigned long long)(LINES*width + PIXELS);
+  }
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Align the input image with the ac_canny and ac_denoise_filter outputs: the delay lines configured from the
+// kernel latency enums ramp up for as many input pixels as the kernel stages together.
+template <int W_MAX, int H_MAX>
+bool test_driver_align(int width, int height)
+{
+  typedef ac_canny<8, W_MAX, H_MAX> cannyType;
+  typedef ac_denoise_filter<8, W_MAX, H_MAX> denoiseType;
+  typedef typename ac_delay_line_for<cannyType, ac_int<8, false>, W_MAX, H_MAX>::type cannyAlignType;
+  typedef typename ac_delay_line_for<denoiseType, ac_int<8, false>, W_MAX, H_MAX>::type denoiseAlignType;
+  cout << "TEST: ac_delay_line alignment ac_canny/ac_denoise_filter SIZE: " << width << "x" << height << " RESULT: ";
+
+  cannyType cannyInst;
+  denoiseType denoiseInst;
+  cannyAlignType cannyAlign;
+  denoiseAlignType denoiseAlign;
+  ac_channel<ac_int<8, false> > cannyIn, denoiseIn, denoiseOut, cannySide, denoiseSide, cannySideOut, denoiseSideOut;
+  ac_channel<ac_int<1, false> > cannyOut;
+  for (int k = 0; k < width*height; k++) {
+    ac_int<8, false> pix = rand() & 255;
+    cannyIn.write(pix);
+    denoiseIn.write(pix);
+    cannySide.write(pix);
+    denoiseSide.write(pix);
+  }
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  cannyInst.run(cannyIn, cannyOut, width, height, 20, 60);
+  denoiseInst.run(denoiseIn, denoiseOut, width, height);
+  cannyAlign.run(cannySide, cannySideOut, width, height);
+  ac_perf_set_stream(cout);
+  map<string, unsigned long long> recs = parse_rampup(log.str());
+
+  ostringstream log2;
+  ac_perf_set_stream(log2);
+  ac_perf_reset();
+  denoiseAlign.run(denoiseSide, denoiseSideOut, width, height);
+  ac_perf_set_stream(cout);
+  map<string, unsigned long long> recsAlign = parse_rampup(log2.str());
+
+  unsigned long long cannyRampup = recs["ac_canny::gaussFilter"] + recs["ac_canny::edgeFilter"] +
+                                   recs["ac_canny::NMS"] + recs["ac_canny::hysThresh"];
+  bool pass = recs["ac_delay_line::run"] == cannyRampup;
+  pass = pass && recsAlign["ac_delay_line::run"] == recs["ac_denoise_filter::run"];
+  pass = pass && cannySideOut.size() == cannyOut.size() && denoiseSideOut.size() == denoiseOut.size();
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_delay_line.cpp -------------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver<0, 0, 64, 32>(24, 12)  && all_tests_pass;
+  all_tests_pass = test_driver<0, 3, 64, 32>(24, 12)  && all_tests_pass;
+  all_tests_pass = test_driver<1, 1, 64, 32>(24, 12)  && all_tests_pass;
+  all_tests_pass = test_driver<2, 5, 64, 32>(17, 9)   && all_tests_pass;
+  all_tests_pass = test_driver<4, 0, 64, 32>(64, 32)  && all_tests_pass;
+  all_tests_pass = test_driver_align<64, 32>(24, 12)  && all_tests_pass;
+  all_tests_pass = test_driver_align<64, 32>(40, 16)  && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_delay_line - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_delay_line - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_fir_1d_polyphase.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+typedef ac_int<8, true> dataType;
+typedef ac_int<6, true> coeffType;
+typedef ac_int<24, true> accType;
+
+// Direct form reference: output n of filter f for the signal x, with zeros before the start of the signal.
+template<int NTAPS, int NFILT>
+int ref_fir(const vector<int> &x, int n, const coeffType (&coeff)[NFILT][NTAPS], int f)
+{
+  int sum = 0;
+  for (int i = 0; i < NTAPS; i++) {
+    int k = n - (NTAPS - 1) + i;
+    if (k >= 0 && k < (int)x.size()) { sum += coeff[f][i].to_int()*x[k]; }
+  }
+  return sum;
+}
+
+// Decimate and interpolate several signals of different lengths, and compare against the direct form
+// filter outputs that are kept.
+template<int NTAPS, int NPHASE, int NFILT>
+bool test_driver()
+{
+  cout << "TEST: ac_fir_1d_polyphase NTAPS: " << NTAPS << " NPHASE: " << NPHASE << " NFILT: " << NFILT << " RESULT: ";
+
+  coeffType coeff[NFILT][NTAPS];
+  for (int f = 0; f < NFILT; f++) {
+    for (int i = 0; i < NTAPS; i++) { coeff[f][i] = (rand() % 64) - 32; }
+  }
+
+  ac_fir_1d_polyphase<dataType, coeffType, accType, NTAPS, NPHASE, NFILT> dec, interp;
+  bool pass = true;
+  const int lens[3] = {8*NPHASE, 3*NPHASE, 13*NPHASE};
+  for (int s = 0; s < 3; s++) {
+    vector<int> x(lens[s]);
+    for (int n = 0; n < lens[s]; n++) { x[n] = (rand() % 256) - 128; }
+
+    // Decimation: output m is the direct form output of sample m*NPHASE.
+    int m = 0;
+    for (int n = 0; n < lens[s]; n++) {
+      accType out[NFILT];
+      bool valid = dec.decimate(dataType(x[n]), n == 0, coeff, out);
+      pass = pass && (valid == (n%NPHASE == NPHASE - 1));
+      if (valid) {
+        for (int f = 0; f < NFILT; f++) { pass = pass && out[f] == ref_fir<NTAPS, NFILT>(x, m*NPHASE, coeff, f); }
+        m++;
+      }
+    }
+    pass = pass && (m == lens[s]/NPHASE);
+
+    // Interpolation: output n*NPHASE + p is the direct form output of the zero-stuffed signal.
+    vector<int> up(lens[s]*NPHASE, 0);
+    for (int n = 0; n < lens[s]; n++) { up[n*NPHASE] = x[n]; }
+    for (int n = 0; n < lens[s]; n++) {
+      interp.write(dataType(x[n]), n == 0);
+      for (int p = 0; p < NPHASE; p++) {
+        accType out[NFILT];
+        interp.interpolate(p, coeff, out);
+        for (int f = 0; f < NFILT; f++) { pass = pass && out[f] == ref_fir<NTAPS, NFILT>(up, n*NPHASE + p, coeff, f); }
+      }
+    }
+  }
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_fir_1d_polyphase.cpp -------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver<4, 2, 2>() && all_tests_pass;
+  all_tests_pass = test_driver<5, 2, 1>() && all_tests_pass;
+  all_tests_pass = test_driver<7, 3, 1>() && all_tests_pass;
+  all_tests_pass = test_driver<9, 3, 2>() && all_tests_pass;
+  all_tests_pass = test_driver<8, 4, 1>() && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_fir_1d_polyphase - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_fir_1d_polyphase - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,503 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#define AC_PERF_COUNTERS
+#include <ac_ipl/ac_canny.h>
+#include <ac_ipl/ac_denoise_filter.h>
+#include <ac_ipl/ac_harris.h>
+#include <ac_ipl/ac_localcontrastnorm.h>
+#include <ac_ipl/ac_gaussian_pyr.h>
+#include <ac_ipl/ac_dwt2_pyr.h>
+#include <ac_ipl/ac_transpose_tile.h>
+#include <ac_stencil_2d.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+using namespace std;
+
+// Counters of one block and frame, parsed from an "AC_PERF block=... frame=... key=value ..." line.
+typedef map<string, unsigned long long> perfRecord;
+
+map<string, perfRecord> parse_perf(const string &log)
+{
+  map<string, perfRecord> recs;
+  istringstream is(log);
+  string line;
+  while (getline(is, line)) {
+    istringstream ls(line);
+    string tok, block;
+    perfRecord rec;
+    ls >> tok;
+    if (tok != "AC_PERF" && tok != "AC_PERF_CHANNEL") { continue; }
+    while (ls >> tok) {
+      size_t eq = tok.find('=');
+      if (tok.substr(0, eq) == "block" || tok.substr(0, eq) == "channel") { block = tok.substr(eq + 1); }
+      else { rec[tok.substr(0, eq)] = strtoull(tok.substr(eq + 1).c_str(), 0, 10); }
+    }
+    ostringstream key;
+    key << block << "#" << rec["frame"];
+    recs[key.str()] = rec;
+  }
+  return recs;
+}
+
+// Checks that hold for every block: each iteration is either a ramp-up iteration or produces a valid
+// output, the flush iterations are the ones without an input read, and no read stalled.
+bool check_common(perfRecord &r, unsigned long long nPix, unsigned long long readsPerPix, unsigned long long writesPerPix)
+{
+  return r["iterations"] == r["valid"] + r["rampup"] && r["valid"] == nPix && r["reads"] == readsPerPix*nPix &&
+         r["writes"] == writesPerPix*nPix && r["flush"] == r["iterations"] - nPix && r["flush"] > 0 && r["stalls"] == 0;
+}
+
+// Run two frames through ac_canny and ac_denoise_filter, and check the counters of each block.
+template<int W_MAX, int H_MAX, bool USE_SINGLEPORT>
+bool test_driver_stencil(int width, int height)
+{
+  cout << "TEST: ac_perf ac_canny/ac_denoise_filter USE_SP: " << (USE_SINGLEPORT ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_canny<8, W_MAX, H_MAX, USE_SINGLEPORT> cannyInst;
+  ac_denoise_filter<8, W_MAX, H_MAX, USE_SINGLEPORT> denoiseInst;
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  for (int f = 0; f < 2; f++) {
+    ac_channel<ac_int<8, false> > cannyIn, denoiseIn, denoiseOut;
+    ac_channel<ac_int<1, false> > cannyOut;
+    for (int k = 0; k < width*height; k++) {
+      ac_int<8, false> pix = rand() & 255;
+      cannyIn.write(pix);
+      denoiseIn.write(pix);
+    }
+    cannyInst.run(cannyIn, cannyOut, width, height, 20, 60);
+    denoiseInst.run(denoiseIn, denoiseOut, width, height);
+  }
+  ac_perf_set_stream(cout);
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  const unsigned long long nPix = width*height;
+  bool pass = recs.size() == 10;
+  for (int f = 0; f < 2; f++) {
+    const string fr = f == 0 ? "#0" : "#1";
+    pass = pass && check_common(recs["ac_canny::gaussFilter" + fr], nPix, 1, 1);
+    pass = pass && check_common(recs["ac_canny::edgeFilter" + fr], nPix, 1, 2);
+    pass = pass && check_common(recs["ac_canny::NMS" + fr], nPix, 2, 1);
+    pass = pass && check_common(recs["ac_canny::hysThresh" + fr], nPix, 1, 1);
+    pass = pass && check_common(recs["ac_denoise_filter::run" + fr], nPix, 1, 1);
+  }
+  // The 5x5 Gaussian window has two lines and two pixels of ramp-up, the 3x3 windows one line and one pixel.
+  pass = pass && recs["ac_canny::gaussFilter#0"]["rampup"] == (unsigned long long)(2*width + 2);
+  pass = pass && recs["ac_canny::edgeFilter#0"]["rampup"] == (unsigned long long)(width + 1);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Run two frames through ac_localcontrastnorm and check the counters of both stages and the profile of the
+// internal channel, which holds the centered image.
+template<int W_MAX, int H_MAX>
+bool test_driver_lcn(int width, int height)
+{
+  cout << "TEST: ac_perf ac_localcontrastnorm SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_localcontrastnorm<8, W_MAX, H_MAX> lcnInst;
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  for (int f = 0; f < 2; f++) {
+    ac_channel<ac_ipl::RGB_1PPC<8> > lcnIn, lcnOut;
+    for (int k = 0; k < width*height; k++) {
+      ac_ipl::RGB_1PPC<8> pix;
+      pix.R = rand() & 255;
+      pix.G = rand() & 255;
+      pix.B = rand() & 255;
+      pix.TUSER = k == 0;
+      pix.TLAST = k%width == width - 1;
+      lcnIn.write(pix);
+    }
+    lcnInst.run(lcnIn, lcnOut, width, height);
+  }
+  ac_perf_channel_report();
+  ac_perf_set_stream(cout);
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  const unsigned long long nPix = width*height;
+  bool pass = recs.size() == 5;
+  for (int f = 0; f < 2; f++) {
+    const string fr = f == 0 ? "#0" : "#1";
+    pass = pass && check_common(recs["ac_localcontrastnorm::getcenteredimage" + fr], nPix, 1, 1);
+    pass = pass && check_common(recs["ac_localcontrastnorm::getstddeviation" + fr], nPix, 1, 1);
+  }
+  // The 9x9 Gaussian windows have four lines and four pixels of ramp-up.
+  pass = pass && recs["ac_localcontrastnorm::getcenteredimage#0"]["rampup"] == (unsigned long long)(4*width + 4);
+  perfRecord &p1 = recs["ac_localcontrastnorm::P1#0"];
+  pass = pass && p1["writes"] == 2*nPix && p1["reads"] == 2*nPix && p1["max_occupancy"] > 0;
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Checks for a pyramid level: every input pixel of the level produces a valid window, the flush iterations
+// are the ones without an input read, and each output pixel is written both to the output of the level
+// and to the input of the next level.
+bool check_level(perfRecord &r, unsigned long long nPix, unsigned long long nOutPix)
+{
+  return r["iterations"] == r["valid"] + r["rampup"] && r["valid"] == nPix && r["reads"] == nPix &&
+         r["writes"] == 2*nOutPix && r["flush"] == r["iterations"] - nPix && r["flush"] > 0 && r["stalls"] == 0;
+}
+
+// Run one frame through 3-level ac_gaussian_pyr and ac_dwt2_pyr, and check the counters of each level.
+// Each level block is recorded as ac_gaussian_pyr::level[N] and ac_dwt2_pyr::level[N], with level 1 being
+// the full resolution level.
+template<int W_MAX, int H_MAX, bool USE_SP>
+bool test_driver_pyr(int width, int height)
+{
+  cout << "TEST: ac_perf ac_gaussian_pyr/ac_dwt2_pyr USE_SP: " << (USE_SP ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  const int N_LEVELS = 3;
+  ac_gaussian_pyr<ac_int<8, false>, ac_fixed<18, 8, false>, W_MAX, H_MAX, N_LEVELS, 16, USE_SP> gaussPyrInst;
+  ac_dwt2_pyr<AC_DB2, ac_int<8, false>, ac_fixed<24, 12, true>, W_MAX, H_MAX, N_LEVELS, 24, 12, USE_SP> dwt2PyrInst;
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  ac_channel<ac_int<8, false> > gaussIn, dwt2In;
+  ac_channel<ac_fixed<18, 8, false> > gaussOut[N_LEVELS];
+  ac_channel<out_struct<ac_fixed<24, 12, true> > > dwt2Out[N_LEVELS];
+  for (int k = 0; k < width*height; k++) {
+    ac_int<8, false> pix = rand() & 255;
+    gaussIn.write(pix);
+    dwt2In.write(pix);
+  }
+  gaussPyrInst.run(gaussIn, gaussOut, width, height);
+  dwt2PyrInst.run(dwt2In, dwt2Out, width, height);
+  ac_perf_set_stream(cout);
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  bool pass = recs.size() == 2*N_LEVELS;
+  // The Gaussian pyramid keeps the even rows and columns, i.e. it rounds the dimensions up at each level,
+  // the DWT pyramid keeps the odd ones and rounds them down.
+  unsigned long long gW = width, gH = height, dW = width, dH = height;
+  for (int l = 0; l < N_LEVELS; l++) {
+    ostringstream gName, dName;
+    gName << "ac_gaussian_pyr::level[" << l + 1 << "]#0";
+    dName << "ac_dwt2_pyr::level[" << l + 1 << "]#0";
+    pass = pass && check_level(recs[gName.str()], gW*gH, ((gW + 1)/2)*((gH + 1)/2));
+    pass = pass && check_level(recs[dName.str()], dW*dH, (dW/2)*(dH/2));
+    pass = pass && gaussOut[l].size() == ((gW + 1)/2)*((gH + 1)/2) && dwt2Out[l].size() == (dW/2)*(dH/2);
+    gW = (gW + 1)/2;
+    gH = (gH + 1)/2;
+    dW = dW/2;
+    dH = dH/2;
+  }
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Profile the internal channels of ac_canny and ac_harris. All the windowed stages of both designs run on
+// ac_stencil_2d, i.e. one iteration per input pixel, so each internal channel only needs to hold one or two
+// tokens.
+template<int W_MAX, int H_MAX>
+bool test_driver_channels(int width, int height)
+{
+  cout << "TEST: ac_perf channel occupancy ac_canny/ac_harris SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_canny<8, W_MAX, H_MAX> cannyInst;
+  ac_harris<ac_int<8, false>, ac_int<8, false>, 8, W_MAX, H_MAX> harrisInst;
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  ac_channel<ac_int<8, false> > cannyIn, harrisIn, harrisOut;
+  ac_channel<ac_int<1, false> > cannyOut;
+  for (int k = 0; k < width*height; k++) {
+    ac_int<8, false> pix = rand() & 255;
+    cannyIn.write(pix);
+    harrisIn.write(pix);
+  }
+  cannyInst.run(cannyIn, cannyOut, width, height, 20, 60);
+  harrisInst.run(harrisIn, harrisOut, width, height, 0, 1, 100);
+  ac_perf_channel_report();
+  ac_perf_set_stream(cout);
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  const unsigned long long nPix = width*height;
+  bool pass = recs.size() == 8 + 9;
+  const char *cannyCh[] = { "ac_canny::P1", "ac_canny::P2", "ac_canny::P3", "ac_canny::P4" };
+  for (int c = 0; c < 4; c++) {
+    perfRecord &r = recs[string(cannyCh[c]) + "#0"];
+    pass = pass && r["writes"] == nPix && r["reads"] == nPix && r["max_occupancy"] >= 1 && r["max_occupancy"] <= 2;
+  }
+  const char *harrisCh[] = { "ac_harris::P1", "ac_harris::P2", "ac_harris::P3", "ac_harris::P4", "ac_harris::P5" };
+  for (int c = 0; c < 5; c++) {
+    perfRecord &r = recs[string(harrisCh[c]) + "#0"];
+    pass = pass && r["writes"] == nPix && r["reads"] == nPix && r["max_occupancy"] >= 1 && r["max_occupancy"] <= 2;
+  }
+  // The downstream stages wait for the ramp-up of the upstream ones.
+  pass = pass && recs["ac_canny::gaussFilter#0"]["waits"] == 0 && recs["ac_canny::edgeFilter#0"]["waits"] > 0;
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Run one frame through ac_transpose_tile and ac_tile_rasterizer, whose latency is one band of TILE lines.
+template<int TILE, int W_MAX, int H_MAX>
+bool test_driver_tile(int width, int height)
+{
+  cout << "TEST: ac_perf ac_transpose_tile/ac_tile_rasterizer TILE: " << TILE;
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_transpose_tile<ac_int<8, false>, TILE, W_MAX, H_MAX> tileInst;
+  ac_tile_rasterizer<ac_int<8, false>, TILE, W_MAX, H_MAX> rastInst;
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  ac_channel<ac_int<8, false> > streamIn, tileStream, streamOut;
+  for (int k = 0; k < width*height; k++) { streamIn.write(rand() & 255); }
+  tileInst.run(streamIn, tileStream, width, height);
+  rastInst.run(tileStream, streamOut, width, height);
+  ac_perf_set_stream(cout);
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  const unsigned long long nPix = width*height, band = TILE*width;
+  bool pass = recs.size() == 2;
+  pass = pass && check_common(recs["ac_transpose_tile::run#0"], nPix, 1, 1);
+  pass = pass && check_common(recs["ac_tile_rasterizer::run#0"], nPix, 1, 1);
+  pass = pass && recs["ac_transpose_tile::run#0"]["iterations"] == nPix + band;
+  pass = pass && recs["ac_transpose_tile::run#0"]["rampup"] == band;
+  pass = pass && recs["ac_tile_rasterizer::run#0"]["flush"] == band;
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Stencil functor: writes the center pixel of each window.
+struct centerOut {
+  ac_channel<ac_int<8, false> > &streamOut;
+  centerOut(ac_channel<ac_int<8, false> > &o) : streamOut(o) { }
+  template<class WINDOW_TYPE>
+  void operator()(const WINDOW_TYPE &w, bool sof, bool eof, bool sol, bool eol) {
+    AC_PERF_WRITE(streamOut);
+    streamOut.write(w(0, 0));
+  }
+};
+
+// Block that streams nFrames frames through one ac_stencil_2d run() call.
+template<int K_SZ, int W_MAX, int WMODE>
+void stencil_frames(ac_channel<ac_int<8, false> > &streamIn, ac_channel<ac_int<8, false> > &streamOut, int width,
+                    int height, int nFrames)
+{
+  AC_PERF_SCOPE("stencil_frames");
+  centerOut func(streamOut);
+  ac_stencil_2d<ac_int<8, false>, K_SZ, K_SZ, W_MAX, WMODE, centerOut> stencil;
+  stencil.run(streamIn, width, height, nFrames, func);
+}
+
+// Stream nFrames frames back to back through ac_stencil_2d, and check that the flush iterations are only
+// paid once: the call takes as many flush iterations as a single frame.
+template<int K_SZ, int W_MAX, int WMODE>
+bool test_driver_frames(int width, int height, int nFrames)
+{
+  cout << "TEST: ac_perf ac_stencil_2d frames K_SZ: " << K_SZ << " SIZE: " << width << "x" << height;
+  cout << " FRAMES: " << nFrames << " RESULT: ";
+
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  // One frame in the first call, nFrames frames in the second.
+  const int frames[2] = { 1, nFrames };
+  for (int t = 0; t < 2; t++) {
+    const int n = frames[t];
+    ac_channel<ac_int<8, false> > streamIn, streamOut;
+    for (int k = 0; k < n*width*height; k++) { streamIn.write(rand() & 255); }
+    stencil_frames<K_SZ, W_MAX, WMODE>(streamIn, streamOut, width, height, n);
+  }
+  ac_perf_set_stream(cout);
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  const unsigned long long nPix = width*height;
+  perfRecord &one = recs["stencil_frames#0"], &all = recs["stencil_frames#1"];
+  bool pass = recs.size() == 2;
+  pass = pass && check_common(one, nPix, 1, 1) && check_common(all, nFrames*nPix, 1, 1);
+  pass = pass && all["flush"] == one["flush"] && all["rampup"] == one["rampup"];
+  pass = pass && all["iterations"] == nFrames*nPix + one["flush"];
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Stream nFrames TUSER/TLAST frames back to back through ac_localcontrastnorm::run_axis(), and check that
+// both stages only pay their flush iterations once per call. The first call also primes the lookahead
+// pixel, and the trailing TUSER pixel ends up held in the lookahead.
+template<int W_MAX, int H_MAX>
+bool test_driver_axis_frames(int width, int height, int nFrames)
+{
+  cout << "TEST: ac_perf ac_localcontrastnorm::run_axis frames SIZE: " << width << "x" << height;
+  cout << " FRAMES: " << nFrames << " RESULT: ";
+
+  ac_localcontrastnorm<8, W_MAX, H_MAX> lcnInst;
+  ac_channel<ac_ipl::RGB_1PPC<8> > lcnIn, lcnOut;
+  for (int k = 0; k < (1 + nFrames)*width*height + 1; k++) {
+    ac_ipl::RGB_1PPC<8> pix;
+    pix.R = rand() & 255;
+    pix.G = rand() & 255;
+    pix.B = rand() & 255;
+    pix.TUSER = k%(width*height) == 0;
+    pix.TLAST = k%width == width - 1;
+    lcnIn.write(pix);
+  }
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  // One frame in the first call, nFrames frames in the second.
+  lcnInst.run_axis(lcnIn, lcnOut, 1);
+  lcnInst.run_axis(lcnIn, lcnOut, nFrames);
+  ac_perf_set_stream(cout);
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  const unsigned long long nPix = width*height;
+  bool pass = lcnOut.size() == (1 + nFrames)*nPix && lcnIn.size() == 0;
+  const char *stages[] = { "ac_localcontrastnorm::getcenteredimage_axis", "ac_localcontrastnorm::getstddeviation_axis" };
+  for (int s = 0; s < 2; s++) {
+    perfRecord &one = recs[string(stages[s]) + "#0"], &all = recs[string(stages[s]) + "#1"];
+    pass = pass && one["reads"] == nPix + (s == 0) && check_common(all, nFrames*nPix, 1, 1);
+    pass = pass && one["valid"] == nPix && one["flush"] == one["iterations"] - nPix;
+    pass = pass && all["flush"] == one["flush"] && all["iterations"] == nFrames*nPix + one["flush"];
+  }
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Stream nFrames frames back to back through ac_canny, ac_denoise_filter and ac_harris with their nFramesIn
+// ports, and check the outputs against one call per frame. Each stage only pays its flush iterations once
+// per call, so the call takes nFrames*width*height iterations plus the flush iterations of a single frame.
+template<int W_MAX, int H_MAX>
+bool test_driver_kernel_frames(int width, int height, int nFrames)
+{
+  cout << "TEST: ac_perf ac_canny/ac_denoise_filter/ac_harris frames SIZE: " << width << "x" << height;
+  cout << " FRAMES: " << nFrames << " RESULT: ";
+
+  ac_canny<8, W_MAX, H_MAX> cannyInst;
+  ac_denoise_filter<8, W_MAX, H_MAX> denoiseInst;
+  ac_harris<ac_int<8, false>, ac_int<8, false>, 8, W_MAX, H_MAX> harrisInst;
+  const int nPix = width*height;
+  int *img = new int[nFrames*nPix];
+  for (int k = 0; k < nFrames*nPix; k++) { img[k] = rand() & 255; }
+
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  // One call per frame first, then one call for all the frames.
+  ac_channel<ac_int<1, false> > cannyRef, cannyOut;
+  ac_channel<ac_int<8, false> > denoiseRef, denoiseOut, harrisRef, harrisOut;
+  for (int f = 0; f < nFrames; f++) {
+    ac_channel<ac_int<8, false> > cannyIn, denoiseIn, harrisIn;
+    for (int k = f*nPix; k < (f + 1)*nPix; k++) {
+      cannyIn.write(img[k]);
+      denoiseIn.write(img[k]);
+      harrisIn.write(img[k]);
+    }
+    cannyInst.run(cannyIn, cannyRef, width, height, 20, 60);
+    denoiseInst.run(denoiseIn, denoiseRef, width, height);
+    harrisInst.run(harrisIn, harrisRef, width, height, 0, 1, 100);
+  }
+  ac_channel<ac_int<8, false> > cannyIn, denoiseIn, harrisIn;
+  for (int k = 0; k < nFrames*nPix; k++) {
+    cannyIn.write(img[k]);
+    denoiseIn.write(img[k]);
+    harrisIn.write(img[k]);
+  }
+  cannyInst.run(cannyIn, cannyOut, width, height, 20, 60, nFrames);
+  denoiseInst.run(denoiseIn, denoiseOut, width, height, nFrames);
+  harrisInst.run(harrisIn, harrisOut, width, height, 0, 1, 100, nFrames);
+  ac_perf_set_stream(cout);
+  delete[] img;
+
+  bool pass = cannyOut.size() == (unsigned)(nFrames*nPix) && denoiseOut.size() == (unsigned)(nFrames*nPix) &&
+              harrisOut.size() == (unsigned)(nFrames*nPix);
+  while (pass && cannyOut.available(1)) {
+    pass = cannyOut.read() == cannyRef.read() && denoiseOut.read() == denoiseRef.read() && harrisOut.read() == harrisRef.read();
+  }
+
+  map<string, perfRecord> recs = parse_perf(log.str());
+  const char *stages[] = { "ac_canny::gaussFilter", "ac_canny::edgeFilter", "ac_canny::NMS", "ac_canny::hysThresh",
+                           "ac_denoise_filter::run", "ac_harris::intensity", "ac_harris::harrisresponse",
+                           "ac_harris::localmaxima", "ac_harris::thresholding" };
+  ostringstream last;
+  last << "#" << nFrames;
+  for (int s = 0; s < 9; s++) {
+    perfRecord &one = recs[string(stages[s]) + "#0"], &all = recs[string(stages[s]) + last.str()];
+    pass = pass && one["valid"] == (unsigned long long)nPix && all["valid"] == (unsigned long long)(nFrames*nPix);
+    pass = pass && all["flush"] == one["flush"] && all["iterations"] == nFrames*nPix + one["flush"];
+  }
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_perf.cpp -------------------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver_stencil<64, 32, false>(24, 12) && all_tests_pass;
+  all_tests_pass = test_driver_stencil<64, 32, true>(32, 10)  && all_tests_pass;
+  all_tests_pass = test_driver_channels<64, 32>(32, 16)       && all_tests_pass;
+  all_tests_pass = test_driver_channels<64, 32>(20, 24)       && all_tests_pass;
+  all_tests_pass = test_driver_tile<4, 64, 32>(32, 16)        && all_tests_pass;
+  all_tests_pass = test_driver_tile<8, 64, 32>(48, 24)        && all_tests_pass;
+  all_tests_pass = test_driver_frames<3, 64, AC_MIRROR>(24, 12, 3)                && all_tests_pass;
+  all_tests_pass = test_driver_frames<5, 64, AC_CLIP|AC_SINGLEPORT>(32, 10, 4)    && all_tests_pass;
+  all_tests_pass = test_driver_kernel_frames<64, 32>(24, 12, 3)                   && all_tests_pass;
+  all_tests_pass = test_driver_kernel_frames<64, 32>(17, 9, 2)                    && all_tests_pass;
+  all_tests_pass = test_driver_lcn<64, 32>(24, 12)                                && all_tests_pass;
+  all_tests_pass = test_driver_axis_frames<64, 32>(24, 12, 3)                     && all_tests_pass;
+  all_tests_pass = test_driver_pyr<64, 32, true>(41, 30)                          && all_tests_pass;
+  all_tests_pass = test_driver_pyr<64, 32, false>(40, 27)                         && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_perf - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_perf - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,193 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#define AC_RANGE_PROFILE
+#include <ac_range.h>
+#include <ac_ipl/ac_canny.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+using namespace std;
+
+// Fields of the "AC_RANGE name=... key=value ..." report lines, by name.
+map<string, map<string, string> > parse_range(const string &log)
+{
+  map<string, map<string, string> > recs;
+  istringstream is(log);
+  string line;
+  while (getline(is, line)) {
+    istringstream ls(line);
+    string tok, name;
+    map<string, string> rec;
+    ls >> tok;
+    if (tok != "AC_RANGE") { continue; }
+    while (ls >> tok) {
+      size_t eq = tok.find('=');
+      rec[tok.substr(0, eq)] = tok.substr(eq + 1);
+    }
+    recs[rec["name"]] = rec;
+  }
+  return recs;
+}
+
+map<string, map<string, string> > report(double psnrDb)
+{
+  ostringstream log;
+  ac_range_set_stream(log);
+  ac_range_report(psnrDb);
+  ac_range_set_stream(cout);
+  return parse_range(log.str());
+}
+
+// Track a few values with known minimal widths, and check the reported widths for several PSNR bounds.
+bool test_driver_values()
+{
+  cout << "TEST: ac_range known values RESULT: ";
+
+  ac_range_reset();
+  const double fxVals[] = { -3.25, 5.5, 0.125 };
+  for (int k = 0; k < 3; k++) { AC_RANGE_TRACK("fx", (ac_fixed<16, 8, true>(fxVals[k]))); }
+  AC_RANGE_TRACK("int", (ac_int<12, false>(3)));
+  AC_RANGE_TRACK("int", (ac_int<12, false>(200)));
+  AC_RANGE_TRACK("ufx", (ac_fixed<10, 2, false>(0.3125)));
+  AC_RANGE_TRACK("ufx", (ac_fixed<10, 2, false>(0.5)));
+
+  map<string, map<string, string> > r = report(50);
+  bool pass = r.size() == 3;
+  pass = pass && r["fx"]["type"] == "ac_fixed<16,8,true>" && r["fx"]["count"] == "3";
+  pass = pass && r["fx"]["min"] == "-3.25" && r["fx"]["max"] == "5.5" && r["fx"]["sign"] == "true";
+  pass = pass && r["fx"]["int_bits"] == "4" && r["fx"]["frac_bits_exact"] == "3" && r["fx"]["frac_bits_psnr"] == "3";
+  pass = pass && r["int"]["type"] == "ac_int<12,false>" && r["int"]["sign"] == "false";
+  pass = pass && r["int"]["int_bits"] == "8" && r["int"]["frac_bits_exact"] == "0";
+  pass = pass && r["ufx"]["int_bits"] == "0" && r["ufx"]["frac_bits_exact"] == "4";
+
+  // Truncating the fx samples to 2, 1 and 0 fraction bits gives about 37.6, 30.6 and 20.4 dB.
+  pass = pass && report(35)["fx"]["frac_bits_psnr"] == "2";
+  pass = pass && report(30)["fx"]["frac_bits_psnr"] == "1";
+  pass = pass && report(20)["fx"]["frac_bits_psnr"] == "0";
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Track intermediates wider than the 53 bit mantissa of a double, whose lowest bits are lost when they are
+// converted to double, and check that the reported widths are still exact.
+bool test_driver_wide()
+{
+  cout << "TEST: ac_range wide types RESULT: ";
+
+  ac_range_reset();
+  // 8 + 2^-56
+  ac_int<60, false> ubits = 1;
+  ubits[59] = 1;
+  ac_fixed<60, 4, false> u;
+  u.set_slc(0, ubits);
+  AC_RANGE_TRACK("ufx", u);
+  // -2^29 + 2^-28, with a 58 bit type like the harris response for 8 bit components
+  ac_int<58, true> sbits = 1;
+  sbits[57] = 1;
+  ac_fixed<58, 30, true> sv;
+  sv.set_slc(0, sbits);
+  AC_RANGE_TRACK("sfx", sv);
+  // 2^56 - 1 and -2^56, which need 57 integer bits
+  ac_int<58, true> sint = 0;
+  sint[56] = 1;
+  AC_RANGE_TRACK("sint", (ac_int<58, true>(sint - 1)));
+  AC_RANGE_TRACK("sint", (ac_int<58, true>(-sint)));
+
+  map<string, map<string, string> > r = report(400);
+  bool pass = r.size() == 3;
+  pass = pass && r["ufx"]["sign"] == "false" && r["ufx"]["int_bits"] == "4" && r["ufx"]["frac_bits_exact"] == "56";
+  pass = pass && r["sfx"]["sign"] == "true" && r["sfx"]["int_bits"] == "30" && r["sfx"]["frac_bits_exact"] == "28";
+  pass = pass && r["sint"]["sign"] == "true" && r["sint"]["int_bits"] == "57" && r["sint"]["frac_bits_exact"] == "0";
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Run ac_canny on a random image and check that each tracked intermediate fits its declared type.
+template<int W_MAX, int H_MAX>
+bool test_driver_canny(int width, int height)
+{
+  cout << "TEST: ac_range ac_canny SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_range_reset();
+  ac_canny<8, W_MAX, H_MAX> cannyInst;
+  ac_channel<ac_int<8, false> > streamIn;
+  ac_channel<ac_int<1, false> > streamOut;
+  for (int k = 0; k < width*height; k++) { streamIn.write(rand() & 255); }
+  cannyInst.run(streamIn, streamOut, width, height, 20, 60);
+
+  map<string, map<string, string> > r = report(60);
+  const char *names[] = { "ac_canny::gaussOp", "ac_canny::Gx", "ac_canny::Gy", "ac_canny::magOp" };
+  bool pass = r.size() == 4;
+  for (int n = 0; n < 4 && pass; n++) {
+    map<string, string> &rec = r[names[n]];
+    int w, i;
+    char s[8];
+    pass = sscanf(rec["type"].c_str(), "ac_fixed<%d,%d,%5[a-z]>", &w, &i, s) == 3;
+    pass = pass && atoi(rec["count"].c_str()) == width*height;
+    pass = pass && atoi(rec["int_bits"].c_str()) <= i && atoi(rec["frac_bits_exact"].c_str()) <= w - i;
+    pass = pass && atoi(rec["frac_bits_psnr"].c_str()) <= atoi(rec["frac_bits_exact"].c_str());
+  }
+  pass = pass && r["ac_canny::gaussOp"]["sign"] == "false" && r["ac_canny::magOp"]["sign"] == "false";
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_range.cpp ------------------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver_values()                && all_tests_pass;
+  all_tests_pass = test_driver_wide()                  && all_tests_pass;
+  all_tests_pass = test_driver_canny<64, 32>(32, 16)   && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_range - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_range - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,217 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#define AC_PERF_COUNTERS
+#include <ac_window_2d_flag.h>
+#include <ac_window_2d_flag_ppc.h>
+#include <ac_window_1d_flag.h>
+#include <ac_ipl/ac_canny.h>
+#include <ac_resource.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+using namespace std;
+
+// Stream a width x height frame through ac_window_2d_flag and check that the first valid window is output
+// after LATENCY_LINES*width + LATENCY_PIXELS pixels have been written.
+template <int K_ROW, int K_COL, int WMODE>
+bool test_driver_window_latency(const char *modeName, int width, int height)
+{
+  typedef ac_window_2d_flag<ac_int<8, false>, K_ROW, K_COL, 64, WMODE> windowType;
+  cout << "TEST: ac_resource window latency MODE: ";
+  cout.width(11);
+  cout << left << modeName << " SIZE: " << K_ROW << "x" << K_COL << " FRAME: " << width << "x" << height << " RESULT: ";
+
+  windowType win;
+  int nWritten = 0, firstValid = -1;
+  for (int i = 0; i < height && firstValid < 0; i++) {
+    for (int j = 0; j < width && firstValid < 0; j++) {
+      win.write(rand() & 255, i == 0 && j == 0, i == height - 1 && j == width - 1, j == 0, j == width - 1);
+      nWritten++;
+      if (win.valid()) { firstValid = nWritten - 1; }
+    }
+  }
+
+  bool pass = firstValid == windowType::LATENCY_LINES*width + windowType::LATENCY_PIXELS;
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Same for the 1D window, within one line.
+template <int K_SZ, int WMODE>
+bool test_driver_window_1d_latency(const char *modeName, int width)
+{
+  typedef ac_window_1d_flag<ac_int<8, false>, K_SZ, WMODE> windowType;
+  cout << "TEST: ac_resource 1D window latency MODE: ";
+  cout.width(11);
+  cout << left << modeName << " SIZE: " << K_SZ << " LINE: " << width << " RESULT: ";
+
+  windowType win;
+  int firstValid = -1;
+  for (int j = 0; j < width && firstValid < 0; j++) {
+    win.write(rand() & 255, j == 0, j == width - 1);
+    if (win.valid()) { firstValid = j; }
+  }
+
+  bool pass = windowType::LATENCY_LINES == 0 && firstValid == windowType::LATENCY_PIXELS;
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Same for the N-PPC window, in writes of AC_PPC pixel groups.
+template <int K_ROW, int K_COL, int WMODE, int PPC>
+bool test_driver_window_ppc_latency(const char *modeName, int width, int height)
+{
+  typedef ac_window_2d_flag_ppc<ac_int<8, false>, K_ROW, K_COL, 64, WMODE, PPC> windowType;
+  cout << "TEST: ac_resource PPC window latency MODE: ";
+  cout.width(11);
+  cout << left << modeName << " SIZE: " << K_ROW << "x" << K_COL << " PPC: " << PPC;
+  cout << " FRAME: " << width << "x" << height << " RESULT: ";
+
+  windowType win;
+  const int nWords = width/PPC;
+  int nWritten = 0, firstValid = -1;
+  for (int i = 0; i < height && firstValid < 0; i++) {
+    for (int j = 0; j < nWords && firstValid < 0; j++) {
+      typename windowType::ppc_type pix;
+      for (int p = 0; p < PPC; p++) { pix.px[p] = rand() & 255; }
+      win.write(pix, i == 0 && j == 0, i == height - 1 && j == nWords - 1, j == 0, j == nWords - 1);
+      nWritten++;
+      if (win.valid()) { firstValid = nWritten - 1; }
+    }
+  }
+
+  bool pass = firstValid == windowType::LATENCY_LINES*nWords + windowType::LATENCY_PIXELS/PPC;
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Line buffer bits for a few configurations: one line less than the window rows, each rounded up to
+// whole packed words.
+bool test_driver_lb_bits()
+{
+  cout << "TEST: ac_resource line buffer bits RESULT: ";
+  typedef ac_window_2d_flag<ac_int<8, false>, 5, 5, 64, AC_MIRROR> mirrorType;
+  typedef ac_window_2d_flag<ac_int<8, false>, 5, 5, 66, AC_CLIP|AC_PACK4> packType;
+  typedef ac_window_2d_flag<ac_int<1, false>, 3, 3, 64, AC_BOUNDARY|AC_PACK16> maskType;
+  bool pass = mirrorType::LB_BITS == 4*64*8 && mirrorType::LB_RAMS == 4;
+  pass = pass && packType::LB_WORDS == 17 && packType::LB_WORD_BITS == 32 && packType::LB_BITS == 4*17*32;
+  pass = pass && maskType::LB_BITS == 2*4*16 && maskType::LB_RAMS == 2;
+  pass = pass && mirrorType::WINDOW_BITS >= 5*5*8;
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Sum of the ramp-up iterations of the blocks of one frame, from the "AC_PERF block=... rampup=..." lines.
+unsigned long long sum_rampup(const string &log, const string &prefix)
+{
+  unsigned long long sum = 0;
+  istringstream is(log);
+  string line;
+  while (getline(is, line)) {
+    istringstream ls(line);
+    string tok;
+    bool match = false;
+    ls >> tok;
+    if (tok != "AC_PERF") { continue; }
+    while (ls >> tok) {
+      size_t eq = tok.find('=');
+      if (tok.substr(0, eq) == "block") { match = tok.substr(eq + 1, prefix.size()) == prefix; }
+      if (match && tok.substr(0, eq) == "rampup") { sum += strtoull(tok.substr(eq + 1).c_str(), 0, 10); }
+    }
+  }
+  return sum;
+}
+
+// The kernel latency is the sum of the ramp-up of its windowed stages.
+template<int W_MAX, int H_MAX>
+bool test_driver_kernel_latency(int width, int height)
+{
+  typedef ac_canny<8, W_MAX, H_MAX> cannyType;
+  cout << "TEST: ac_resource ac_canny latency SIZE: " << width << "x" << height << " RESULT: ";
+
+  cannyType cannyInst;
+  ostringstream log;
+  ac_perf_set_stream(log);
+  ac_perf_reset();
+  ac_channel<ac_int<8, false> > cannyIn;
+  ac_channel<ac_int<1, false> > cannyOut;
+  for (int k = 0; k < width*height; k++) { cannyIn.write(rand() & 255); }
+  cannyInst.run(cannyIn, cannyOut, width, height, 20, 60);
+  ac_perf_set_stream(cout);
+
+  bool pass = sum_rampup(log.str(), "ac_canny::") ==
+              (unsigned long long)(cannyType::LATENCY_LINES*width + cannyType::LATENCY_PIXELS);
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_resource.cpp ---------------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver_window_latency<3, 3, AC_WIN>("AC_WIN", 20, 8)                          && all_tests_pass;
+  all_tests_pass = test_driver_window_latency<5, 5, AC_WIN>("AC_WIN", 20, 8)                          && all_tests_pass;
+  all_tests_pass = test_driver_window_latency<3, 3, AC_CLIP>("AC_CLIP", 20, 8)                        && all_tests_pass;
+  all_tests_pass = test_driver_window_latency<4, 4, AC_CLIP>("AC_CLIP", 17, 8)                        && all_tests_pass;
+  all_tests_pass = test_driver_window_latency<5, 5, AC_MIRROR>("AC_MIRROR", 20, 8)                    && all_tests_pass;
+  all_tests_pass = test_driver_window_latency<7, 3, AC_MIRROR>("AC_MIRROR", 23, 10)                   && all_tests_pass;
+  all_tests_pass = test_driver_window_latency<3, 5, AC_BOUNDARY>("AC_BOUNDARY", 16, 8)                && all_tests_pass;
+  all_tests_pass = test_driver_window_latency<5, 5, AC_BOUNDARY|AC_SINGLEPORT>("AC_BOUNDARY", 24, 8)  && all_tests_pass;
+  all_tests_pass = test_driver_window_1d_latency<3, AC_WIN>("AC_WIN", 12)                            && all_tests_pass;
+  all_tests_pass = test_driver_window_1d_latency<4, AC_CLIP>("AC_CLIP", 12)                          && all_tests_pass;
+  all_tests_pass = test_driver_window_1d_latency<5, AC_MIRROR>("AC_MIRROR", 12)                      && all_tests_pass;
+  all_tests_pass = test_driver_window_1d_latency<6, AC_BOUNDARY>("AC_BOUNDARY", 12)                  && all_tests_pass;
+  all_tests_pass = test_driver_window_ppc_latency<3, 3, AC_MIRROR, 2>("AC_MIRROR", 16, 6)            && all_tests_pass;
+  all_tests_pass = test_driver_window_ppc_latency<7, 7, AC_BOUNDARY, 2>("AC_BOUNDARY", 16, 8)        && all_tests_pass;
+  all_tests_pass = test_driver_window_ppc_latency<5, 7, AC_CLIP, 4>("AC_CLIP", 32, 6)                && all_tests_pass;
+  all_tests_pass = test_driver_lb_bits()                                                              && all_tests_pass;
+  all_tests_pass = test_driver_kernel_latency<64, 32>(24, 12)                                         && all_tests_pass;
+  all_tests_pass = test_driver_kernel_latency<64, 32>(40, 16)                                         && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_resource - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_resource - PASSED" << endl;
+
+  return 0;
+}
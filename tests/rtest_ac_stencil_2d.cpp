@@ -0,0 +1,240 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_stencil_2d.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+typedef ac_int<8, false> pixType;
+typedef ac_int<12, false> sumType;
+
+// Stencil functor: writes the sum of the K_SZ x K_SZ window, and records the output flags.
+template<int K_SZ>
+struct sumOut {
+  ac_channel<sumType> &streamOut;
+  vector<int> flags;
+  sumOut(ac_channel<sumType> &o) : streamOut(o) { }
+  template<class WINDOW_TYPE>
+  void operator()(const WINDOW_TYPE &w, bool sof, bool eof, bool sol, bool eol) {
+    sumType sum = 0;
+    for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+      for (int c = -K_SZ/2; c <= K_SZ/2; c++) { sum += w(r, c); }
+    }
+    streamOut.write(sum);
+    flags.push_back(sof*8 + eof*4 + sol*2 + eol);
+  }
+};
+
+// Same as sumOut, for the AC_PPC views of a multi-pixel window.
+template<int K_SZ, int PPC>
+struct sumOutPpc {
+  ac_channel<sumType> &streamOut;
+  vector<int> flags;
+  sumOutPpc(ac_channel<sumType> &o) : streamOut(o) { }
+  template<class WINDOW_TYPE>
+  void operator()(const WINDOW_TYPE &w, bool sof, bool eof, bool sol, bool eol) {
+    for (int p = 0; p < PPC; p++) {
+      sumType sum = 0;
+      for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+        for (int c = -K_SZ/2; c <= K_SZ/2; c++) { sum += w(p, r, c); }
+      }
+      streamOut.write(sum);
+    }
+    flags.push_back(sof*8 + eof*4 + sol*2 + eol);
+  }
+};
+
+// Reference: the hand-written kernel loop, as used by the library kernels.
+template<int K_SZ, int W_MAX, int WMODE>
+void ref_run(const vector<pixType> &img, int width, int height, pixType bval, vector<sumType> &out, vector<int> &flags)
+{
+  ac_window_2d_flag<pixType, K_SZ, K_SZ, W_MAX, WMODE> acWindObj(bval);
+  int i = 0, j = 0, k = 0;
+  bool inRead = true, eofOut = false;
+  do {
+    pixType pixIn = inRead ? img[k++] : pixType(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    acWindObj.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+    bool sofOut, solOut, eolOut;
+    acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (acWindObj.valid()) {
+      sumType sum = 0;
+      for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+        for (int c = -K_SZ/2; c <= K_SZ/2; c++) { sum += acWindObj(r, c); }
+      }
+      out.push_back(sum);
+      flags.push_back(sofOut*8 + eofOut*4 + solOut*2 + eolOut);
+    }
+  } while (!eofOut);
+}
+
+// Run two back-to-back frames through ac_stencil_2d (one pixel per clock, then AC_PPC pixels per clock) and
+// check the outputs and flags against the reference loop.
+template<int K_SZ, int W_MAX, int WMODE, int PPC>
+bool test_driver(int width, int height)
+{
+  cout << "TEST: ac_stencil_2d K_SZ: " << K_SZ << " WMODE: ";
+  cout.width(3);
+  cout << left << WMODE << " PPC: " << PPC << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  const pixType bval = 7;
+  ac_stencil_2d<pixType, K_SZ, K_SZ, W_MAX, WMODE, sumOut<K_SZ> > stencil(bval);
+  ac_stencil_2d<pixType, K_SZ, K_SZ, W_MAX, WMODE, sumOutPpc<K_SZ, PPC>, PPC> stencilPpc(bval);
+  bool pass = true;
+  for (int frame = 0; frame < 2; frame++) {
+    vector<pixType> img(width*height);
+    for (int k = 0; k < width*height; k++) { img[k] = rand() & 255; }
+
+    vector<sumType> refOut;
+    vector<int> refFlags;
+    ref_run<K_SZ, W_MAX, WMODE>(img, width, height, bval, refOut, refFlags);
+
+    ac_channel<pixType> streamIn;
+    ac_channel<typename ac_window_2d_flag_ppc<pixType, K_SZ, K_SZ, W_MAX, WMODE, PPC>::ppc_type> streamInPpc;
+    ac_channel<sumType> streamOut, streamOutPpc;
+    for (int k = 0; k < width*height; k++) { streamIn.write(img[k]); }
+    for (int k = 0; k < width*height; k += PPC) {
+      typename ac_window_2d_flag_ppc<pixType, K_SZ, K_SZ, W_MAX, WMODE, PPC>::ppc_type pix;
+      for (int p = 0; p < PPC; p++) { pix.px[p] = img[k + p]; }
+      streamInPpc.write(pix);
+    }
+
+    sumOut<K_SZ> func(streamOut);
+    sumOutPpc<K_SZ, PPC> funcPpc(streamOutPpc);
+    stencil.run(streamIn, width, height, func);
+    stencilPpc.run(streamInPpc, width, height, funcPpc);
+
+    pass = pass && (int)refOut.size() == width*height && func.flags == refFlags;
+    pass = pass && funcPpc.flags.size() == refFlags.size()/PPC;
+    for (unsigned k = 0; pass && k < refOut.size(); k++) {
+      pass = streamOut.available(1) && streamOutPpc.available(1);
+      pass = pass && streamOut.read() == refOut[k] && streamOutPpc.read() == refOut[k];
+    }
+    pass = pass && !streamOut.available(1) && !streamOutPpc.available(1) && !streamIn.available(1) && !streamInPpc.available(1);
+  }
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Stream nFrames frames back to back through one run() call (one pixel per clock, then AC_PPC pixels per
+// clock), and check the outputs and flags against the reference loop run on each frame separately.
+template<int K_SZ, int W_MAX, int WMODE, int PPC>
+bool test_driver_frames(int width, int height, int nFrames)
+{
+  cout << "TEST: ac_stencil_2d frames K_SZ: " << K_SZ << " WMODE: ";
+  cout.width(3);
+  cout << left << WMODE << " PPC: " << PPC << " SIZE: " << width << "x" << height << " FRAMES: " << nFrames;
+  cout << " RESULT: ";
+
+  typedef typename ac_window_2d_flag_ppc<pixType, K_SZ, K_SZ, W_MAX, WMODE, PPC>::ppc_type ppcType;
+  const pixType bval = 7;
+  ac_stencil_2d<pixType, K_SZ, K_SZ, W_MAX, WMODE, sumOut<K_SZ> > stencil(bval);
+  ac_stencil_2d<pixType, K_SZ, K_SZ, W_MAX, WMODE, sumOutPpc<K_SZ, PPC>, PPC> stencilPpc(bval);
+
+  ac_channel<pixType> streamIn;
+  ac_channel<ppcType> streamInPpc;
+  vector<sumType> refOut;
+  vector<int> refFlags;
+  for (int frame = 0; frame < nFrames; frame++) {
+    vector<pixType> img(width*height);
+    for (int k = 0; k < width*height; k++) { img[k] = rand() & 255; }
+    ref_run<K_SZ, W_MAX, WMODE>(img, width, height, bval, refOut, refFlags);
+    for (int k = 0; k < width*height; k++) { streamIn.write(img[k]); }
+    for (int k = 0; k < width*height; k += PPC) {
+      ppcType pix;
+      for (int p = 0; p < PPC; p++) { pix.px[p] = img[k + p]; }
+      streamInPpc.write(pix);
+    }
+  }
+
+  ac_channel<sumType> streamOut, streamOutPpc;
+  sumOut<K_SZ> func(streamOut);
+  sumOutPpc<K_SZ, PPC> funcPpc(streamOutPpc);
+  stencil.run(streamIn, width, height, nFrames, func);
+  stencilPpc.run(streamInPpc, width, height, nFrames, funcPpc);
+
+  bool pass = (int)refOut.size() == nFrames*width*height && func.flags == refFlags;
+  pass = pass && funcPpc.flags.size() == refFlags.size()/PPC;
+  for (unsigned k = 0; pass && k < refOut.size(); k++) {
+    pass = streamOut.available(1) && streamOutPpc.available(1);
+    pass = pass && streamOut.read() == refOut[k] && streamOutPpc.read() == refOut[k];
+  }
+  pass = pass && !streamOut.available(1) && !streamOutPpc.available(1) && !streamIn.available(1) && !streamInPpc.available(1);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_stencil_2d.cpp -------------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver<3, 64, AC_MIRROR,                 2>(38, 9)  && all_tests_pass;
+  all_tests_pass = test_driver<5, 64, AC_MIRROR,                 2>(20, 12) && all_tests_pass;
+  all_tests_pass = test_driver<3, 64, AC_BOUNDARY,               4>(32, 7)  && all_tests_pass;
+  all_tests_pass = test_driver<5, 64, AC_CLIP,                   4>(24, 10) && all_tests_pass;
+  all_tests_pass = test_driver<3, 64, AC_BOUNDARY|AC_SINGLEPORT, 2>(40, 8)  && all_tests_pass;
+
+  all_tests_pass = test_driver_frames<3, 64, AC_MIRROR,                 2>(38, 9, 3)  && all_tests_pass;
+  all_tests_pass = test_driver_frames<5, 64, AC_CLIP,                   4>(24, 10, 3) && all_tests_pass;
+  all_tests_pass = test_driver_frames<5, 64, AC_BOUNDARY,               2>(20, 6, 4)  && all_tests_pass;
+  all_tests_pass = test_driver_frames<3, 64, AC_MIRROR|AC_SINGLEPORT,   2>(40, 8, 3)  && all_tests_pass;
+  all_tests_pass = test_driver_frames<5, 64, AC_CLIP|AC_SINGLEPORT,     4>(32, 7, 2)  && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_stencil_2d - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_stencil_2d - PASSED" << endl;
+
+  return 0;
+}
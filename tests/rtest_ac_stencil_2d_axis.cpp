@@ -0,0 +1,348 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_stencil_2d.h>
+#include <ac_ipl/ac_pixels.h>
+#include <ac_ipl/ac_denoise_filter.h>
+#include <ac_ipl/ac_localcontrastnorm.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+using namespace ac_ipl;
+
+typedef RGB_1PPC<8> pixType;
+typedef RGB_1PPC<12> sumType;
+
+// Window sum of each color plane. The window flags are copied to TUSER/TLAST of the output pixel.
+template<int K_SZ, class WINDOW_TYPE>
+sumType windSum(const WINDOW_TYPE &w, bool sof, bool eol)
+{
+  sumType sum = 0;
+  for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+    for (int c = -K_SZ/2; c <= K_SZ/2; c++) {
+      sum.R += w(r, c).R;
+      sum.G += w(r, c).G;
+      sum.B += w(r, c).B;
+    }
+  }
+  sum.TUSER = sof;
+  sum.TLAST = eol;
+  return sum;
+}
+
+template<int K_SZ>
+struct sumOut {
+  ac_channel<sumType> &streamOut;
+  sumOut(ac_channel<sumType> &o) : streamOut(o) { }
+  template<class WINDOW_TYPE>
+  void operator()(const WINDOW_TYPE &w, bool sof, bool eof, bool sol, bool eol) {
+    streamOut.write(windSum<K_SZ>(w, sof, eol));
+  }
+};
+
+// Reference: run one frame with known width and height through the width/height driven run().
+template<int K_SZ, int W_MAX, int WMODE>
+void ref_run(const vector<pixType> &img, int width, int height, vector<sumType> &out)
+{
+  ac_channel<pixType> streamIn;
+  ac_channel<sumType> streamOut;
+  for (unsigned k = 0; k < img.size(); k++) { streamIn.write(img[k]); }
+  sumOut<K_SZ> func(streamOut);
+  ac_stencil_2d<pixType, K_SZ, K_SZ, W_MAX, WMODE, sumOut<K_SZ> > stencil(pixType(3));
+  stencil.run(streamIn, width, height, func);
+  while (streamOut.available(1)) { out.push_back(streamOut.read()); }
+}
+
+// Stream frames of different sizes back to back, with the frame flags only carried by TUSER/TLAST, and check
+// each output frame against the reference.
+template<int K_SZ, int W_MAX, int WMODE>
+bool test_driver(const int (&sizes)[4][2])
+{
+  cout << "TEST: ac_stencil_2d TUSER/TLAST frames K_SZ: " << K_SZ << " WMODE: ";
+  cout.width(3);
+  cout << left << WMODE << " RESULT: ";
+
+  ac_channel<pixType> streamIn;
+  vector<sumType> refOut[4];
+  for (int f = 0; f < 4; f++) {
+    int width = sizes[f][0], height = sizes[f][1];
+    vector<pixType> img;
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j++) {
+        pixType pix;
+        pix.R = rand() & 255;
+        pix.G = rand() & 255;
+        pix.B = rand() & 255;
+        pix.TUSER = (i == 0 && j == 0);
+        pix.TLAST = (j == width - 1);
+        img.push_back(pix);
+        streamIn.write(pix);
+      }
+    }
+    ref_run<K_SZ, W_MAX, WMODE>(img, width, height, refOut[f]);
+  }
+  // Start of the next frame, which marks the end of the last frame.
+  pixType sofPix = 0;
+  sofPix.TUSER = true;
+  sofPix.TLAST = false;
+  streamIn.write(sofPix);
+
+  ac_channel<sumType> streamOut;
+  sumOut<K_SZ> func(streamOut);
+  ac_stencil_2d<pixType, K_SZ, K_SZ, W_MAX, WMODE, sumOut<K_SZ> > stencil(pixType(3));
+  bool pass = true;
+  for (int f = 0; f < 4; f++) {
+    stencil.run(streamIn, func);
+    pass = pass && (int)refOut[f].size() == sizes[f][0]*sizes[f][1];
+    for (unsigned k = 0; pass && k < refOut[f].size(); k++) {
+      pass = streamOut.available(1) && streamOut.read() == refOut[f][k];
+    }
+    pass = pass && !streamOut.available(1);
+  }
+  // Only the lookahead pixel (the start of the next frame) has been read.
+  pass = pass && !streamIn.available(1);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Stream groups of frames through run(streamIn, nFrames, func): the frames of a group have the same width and
+// different heights and are streamed back to back in one call. Each output frame is checked against the
+// reference.
+template<int K_SZ, int W_MAX, int WMODE, int N_GROUPS>
+bool test_driver_groups(const int (&sizes)[5][2], const int (&groups)[N_GROUPS])
+{
+  cout << "TEST: ac_stencil_2d TUSER/TLAST frame groups K_SZ: " << K_SZ << " WMODE: ";
+  cout.width(3);
+  cout << left << WMODE << " RESULT: ";
+
+  ac_channel<pixType> streamIn;
+  vector<sumType> refOut;
+  for (int f = 0; f < 5; f++) {
+    int width = sizes[f][0], height = sizes[f][1];
+    vector<pixType> img;
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j++) {
+        pixType pix;
+        pix.R = rand() & 255;
+        pix.G = rand() & 255;
+        pix.B = rand() & 255;
+        pix.TUSER = (i == 0 && j == 0);
+        pix.TLAST = (j == width - 1);
+        img.push_back(pix);
+        streamIn.write(pix);
+      }
+    }
+    ref_run<K_SZ, W_MAX, WMODE>(img, width, height, refOut);
+  }
+  pixType sofPix = 0;
+  sofPix.TUSER = true;
+  sofPix.TLAST = false;
+  streamIn.write(sofPix);
+
+  ac_channel<sumType> streamOut;
+  sumOut<K_SZ> func(streamOut);
+  ac_stencil_2d<pixType, K_SZ, K_SZ, W_MAX, WMODE, sumOut<K_SZ> > stencil(pixType(3));
+  for (int g = 0; g < N_GROUPS; g++) {
+    stencil.run(streamIn, ac_int<4, false>(groups[g]), func);
+  }
+  bool pass = streamOut.size() == refOut.size();
+  for (unsigned k = 0; pass && k < refOut.size(); k++) {
+    pass = streamOut.read() == refOut[k];
+  }
+  pass = pass && !streamIn.available(1);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Monochrome AXI4-Stream video pixel, with the conversions that the median filter of ac_denoise_filter uses
+// on its window elements.
+struct monoPix {
+  ac_int<8, false> V;
+  bool TUSER; // Start-of-Frame
+  bool TLAST; // End-of-Line
+  monoPix() : V(0), TUSER(false), TLAST(false) { }
+  monoPix(int v) : V(v), TUSER(false), TLAST(false) { }
+  monoPix(double v) : V(int(v)), TUSER(false), TLAST(false) { }
+  operator int() const { return V.to_int(); }
+  operator ac_int<8, false>() const { return V; }
+};
+
+// Stencil functor: the ac_denoise_filter median of each window.
+template<int W_MAX, int H_MAX>
+struct denoiseOut {
+  typedef ac_denoise_filter<8, W_MAX, H_MAX> filtType;
+  filtType &filt;
+  ac_channel<ac_int<8, false> > &streamOut;
+  denoiseOut(filtType &f, ac_channel<ac_int<8, false> > &o) : filt(f), streamOut(o) { }
+  template<class WINDOW_TYPE>
+  void operator()(const WINDOW_TYPE &w, bool sof, bool eof, bool sol, bool eol) {
+    streamOut.write(filt.medianFilt(w));
+  }
+};
+
+// Run the median filter of ac_denoise_filter on frames of different sizes, which are streamed back to back
+// as monochrome TUSER/TLAST pixels through run(streamIn, func). Each output frame is compared against
+// ac_denoise_filter::run() on the same frame, with the frame width and height.
+template<int W_MAX, int H_MAX>
+bool test_driver_denoise(const int (&sizes)[4][2])
+{
+  typedef ac_denoise_filter<8, W_MAX, H_MAX> filtType;
+  cout << "TEST: ac_stencil_2d TUSER/TLAST frames ac_denoise_filter RESULT: ";
+
+  filtType filt;
+  ac_channel<monoPix> streamIn;
+  vector<ac_int<8, false> > refOut[4];
+  for (int f = 0; f < 4; f++) {
+    int width = sizes[f][0], height = sizes[f][1];
+    ac_channel<ac_int<8, false> > refIn, refStreamOut;
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j++) {
+        monoPix pix(rand() & 255);
+        pix.TUSER = (i == 0 && j == 0);
+        pix.TLAST = (j == width - 1);
+        streamIn.write(pix);
+        refIn.write(pix.V);
+      }
+    }
+    filt.run(refIn, refStreamOut, width, height);
+    while (refStreamOut.available(1)) { refOut[f].push_back(refStreamOut.read()); }
+  }
+  monoPix sofPix(0);
+  sofPix.TUSER = true;
+  streamIn.write(sofPix);
+
+  ac_channel<ac_int<8, false> > streamOut;
+  denoiseOut<W_MAX, H_MAX> func(filt, streamOut);
+  ac_stencil_2d<monoPix, 3, 3, W_MAX, AC_MIRROR, denoiseOut<W_MAX, H_MAX> > stencil;
+  bool pass = true;
+  for (int f = 0; f < 4; f++) {
+    stencil.run(streamIn, func);
+    pass = pass && (int)refOut[f].size() == sizes[f][0]*sizes[f][1];
+    for (unsigned k = 0; pass && k < refOut[f].size(); k++) {
+      pass = streamOut.available(1) && streamOut.read() == refOut[f][k];
+    }
+    pass = pass && !streamOut.available(1);
+  }
+  pass = pass && !streamIn.available(1);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Stream RGB_1PPC frames of different sizes through ac_localcontrastnorm::run_axis(), which only takes the frame
+// flags from TUSER/TLAST, in groups of frames of the same width. The output pixels, along with their TUSER/TLAST
+// flags, are checked against ac_localcontrastnorm::run() on each frame, with the frame width and height.
+template<int W_MAX, int H_MAX, int N_GROUPS>
+bool test_driver_lcn(const int (&sizes)[5][2], const int (&groups)[N_GROUPS])
+{
+  cout << "TEST: ac_stencil_2d TUSER/TLAST frames ac_localcontrastnorm RESULT: ";
+
+  ac_localcontrastnorm<8, W_MAX, H_MAX> lcn;
+  ac_channel<pixType> streamIn, refStreamOut;
+  for (int f = 0; f < 5; f++) {
+    int width = sizes[f][0], height = sizes[f][1];
+    ac_channel<pixType> refIn;
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j++) {
+        pixType pix;
+        pix.R = rand() & 255;
+        pix.G = rand() & 255;
+        pix.B = rand() & 255;
+        pix.TUSER = (i == 0 && j == 0);
+        pix.TLAST = (j == width - 1);
+        streamIn.write(pix);
+        refIn.write(pix);
+      }
+    }
+    lcn.run(refIn, refStreamOut, width, height);
+  }
+  pixType sofPix = 0;
+  sofPix.TUSER = true;
+  sofPix.TLAST = false;
+  streamIn.write(sofPix);
+
+  ac_channel<pixType> streamOut;
+  for (int g = 0; g < N_GROUPS; g++) {
+    lcn.run_axis(streamIn, streamOut, groups[g]);
+  }
+  bool pass = streamOut.size() == refStreamOut.size();
+  while (pass && streamOut.available(1)) {
+    pixType out = streamOut.read(), ref = refStreamOut.read();
+    pass = out == ref && out.TUSER == ref.TUSER && out.TLAST == ref.TLAST;
+  }
+  pass = pass && !streamIn.available(1);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_stencil_2d_axis.cpp --------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  const int sizes[4][2] = {{24, 8}, {40, 5}, {16, 12}, {24, 8}};
+
+  all_tests_pass = test_driver<3, 64, AC_MIRROR>(sizes)                 && all_tests_pass;
+  all_tests_pass = test_driver<5, 64, AC_CLIP>(sizes)                   && all_tests_pass;
+  all_tests_pass = test_driver<3, 64, AC_BOUNDARY>(sizes)               && all_tests_pass;
+  all_tests_pass = test_driver<5, 64, AC_BOUNDARY>(sizes)               && all_tests_pass;
+  all_tests_pass = test_driver_denoise<64, 16>(sizes)                   && all_tests_pass;
+
+  // Frames 0-2 have the same width and are streamed in one call, as are frames 3 and 4.
+  const int groupSizes[5][2] = {{24, 8}, {24, 5}, {24, 12}, {16, 10}, {16, 6}};
+  const int groups[2] = {3, 2};
+  const int lcnSizes[5][2] = {{24, 12}, {24, 10}, {40, 10}, {16, 14}, {16, 11}};
+  const int lcnGroups[3] = {2, 1, 2};
+
+  all_tests_pass = test_driver_groups<3, 64, AC_MIRROR>(groupSizes, groups)       && all_tests_pass;
+  all_tests_pass = test_driver_groups<5, 64, AC_CLIP>(groupSizes, groups)         && all_tests_pass;
+  all_tests_pass = test_driver_groups<5, 64, AC_BOUNDARY>(groupSizes, groups)     && all_tests_pass;
+  all_tests_pass = test_driver_lcn<64, 16>(lcnSizes, lcnGroups)                   && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_stencil_2d_axis - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_stencil_2d_axis - PASSED" << endl;
+
+  return 0;
+}
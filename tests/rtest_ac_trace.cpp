@@ -0,0 +1,157 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#define AC_TRACE_LEVEL AC_TRACE_PIXEL
+#define AC_TRACE_CATEGORIES (AC_TRACE_CAT_GAMMA|AC_TRACE_CAT_BUFFER|AC_TRACE_CAT_USER)
+#define AC_TRACE_RING_SIZE 64
+#include <ac_ipl/ac_gamma.h>
+#include <ac_buffer_2d.h>
+#include <ac_trace.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+vector<string> split_lines(const string &s)
+{
+  vector<string> lines;
+  istringstream is(s);
+  string line;
+  while (getline(is, line)) { lines.push_back(line); }
+  return lines;
+}
+
+// Run nPix greyscale pixels through ac_gamma with a stream sink, and check that each pixel is traced with
+// six records in the gamma category.
+bool test_driver_gamma(int nPix)
+{
+  cout << "TEST: ac_trace ac_gamma PIXELS: " << nPix << " RESULT: ";
+
+  ac_gamma<ac_int<8, false>, 8> gammaInst;
+  ac_channel<ac_int<8, false> > streamIn, streamOut;
+  ac_gamma<ac_int<8, false>, 8>::gamma_in_type gammaIn = 2.2;
+  for (int k = 0; k < nPix; k++) { streamIn.write(rand() & 255); }
+  ostringstream log;
+  ac_trace_set_stream(log);
+  gammaInst.run(streamIn, streamOut, gammaIn);
+  ac_trace_set_ring();
+
+  vector<string> lines = split_lines(log.str());
+  bool pass = (int)lines.size() == 6*nPix && streamOut.size() == (unsigned)nPix;
+  for (unsigned i = 0; i < lines.size(); i++) {
+    pass = pass && lines[i].compare(0, 31, "AC_TRACE level=PIXEL cat=gamma ") == 0;
+    if (i%6 == 0) { pass = pass && lines[i].find("RGB_IN") != string::npos; }
+    if (i%6 == 5) { pass = pass && lines[i].find("RGB_OUT") != string::npos; }
+  }
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Trace more records than the ring buffer holds: only the last AC_TRACE_RING_SIZE are kept, oldest first.
+// Records of a category outside AC_TRACE_CATEGORIES are not written.
+bool test_driver_ring(int nRec)
+{
+  cout << "TEST: ac_trace ring buffer RECORDS: " << nRec << " RESULT: ";
+
+  ac_trace_clear();
+  for (int k = 0; k < nRec; k++) {
+    AC_TRACE(AC_TRACE_INFO, AC_TRACE_CAT_USER, "record " << k);
+    AC_TRACE(AC_TRACE_INFO, AC_TRACE_CAT_WINDOW, "filtered " << k);
+  }
+  ostringstream dump;
+  ac_trace_dump(dump);
+
+  vector<string> lines = split_lines(dump.str());
+  int nKept = nRec < AC_TRACE_RING_SIZE ? nRec : AC_TRACE_RING_SIZE;
+  bool pass = (int)lines.size() == nKept;
+  for (int k = 0; k < (int)lines.size(); k++) {
+    ostringstream exp;
+    exp << "AC_TRACE level=INFO cat=user record " << nRec - nKept + k;
+    pass = pass && lines[k] == exp.str();
+  }
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Dump an ac_buffer_2d to a file sink: one record per stored line, plus one with the read/write state.
+bool test_driver_buffer_file()
+{
+  cout << "TEST: ac_trace ac_buffer_2d print to file RESULT: ";
+
+  const char *path = "ac_trace_buffer.txt";
+  ac_buffer_2d<ac_int<8, false>, 8, 3, AC_CLIP> buf;
+  bool pass = ac_trace_set_file(path);
+  buf.print();
+  ac_trace_set_ring();
+
+  ifstream is(path);
+  string line;
+  int nLines = 0;
+  while (getline(is, line)) {
+    pass = pass && line.compare(0, 32, "AC_TRACE level=DEBUG cat=buffer ") == 0;
+    nLines++;
+  }
+  is.close();
+  remove(path);
+  pass = pass && nLines == 3;
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_trace.cpp ------------------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver_gamma(16)        && all_tests_pass;
+  all_tests_pass = test_driver_ring(40)         && all_tests_pass;
+  all_tests_pass = test_driver_ring(200)        && all_tests_pass;
+  all_tests_pass = test_driver_buffer_file()    && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_trace - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_trace - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_ipl/ac_transpose_tile.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+typedef ac_int<10, false> pixType;
+
+// Reference tile-raster output: source row and column of output pixel k of a width x height image.
+void ref_src(int k, int width, int tile, int mode, int &row, int &col)
+{
+  int band = k/(tile*width);
+  int k1 = k%(tile*width);
+  int tileIdx = k1/(tile*tile);
+  int r = (k1%(tile*tile))/tile;
+  int c = k1%tile;
+  int sr = c, sc = r;
+  if (mode == AC_TILE_ROT90_CW) { sr = tile - 1 - c; }
+  if (mode == AC_TILE_ROT90_CCW) { sc = tile - 1 - r; }
+  row = band*tile + sr;
+  col = tileIdx*tile + sc;
+}
+
+// Stream several random frames through ac_transpose_tile and check the tile-raster order against the
+// reference. Then re-rasterize the stream with ac_tile_rasterizer and check that every tile of the image is
+// transposed or rotated in place.
+template<int TILE, int W_MAX, int H_MAX, int MODE>
+bool test_driver(const char *modeName, int width, int height)
+{
+  cout << "TEST: ac_transpose_tile MODE: ";
+  cout.width(17);
+  cout << left << modeName << " TILE: " << TILE << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_transpose_tile<pixType, TILE, W_MAX, H_MAX, MODE> tileInst;
+  ac_tile_rasterizer<pixType, TILE, W_MAX, H_MAX> rastInst;
+  bool pass = true;
+
+  for (int f = 0; f < 2 && pass; f++) {
+    ac_channel<pixType> streamIn, tileStream, streamOut;
+    vector<int> img(width*height);
+    for (int k = 0; k < width*height; k++) {
+      img[k] = rand() & 1023;
+      streamIn.write(img[k]);
+    }
+
+    tileInst.run(streamIn, tileStream, width, height);
+    pass = pass && (streamIn.available(1) == false) && (tileStream.size() == (unsigned)(width*height));
+
+    vector<int> tiled(width*height);
+    for (int k = 0; k < width*height && pass; k++) {
+      int row, col;
+      ref_src(k, width, TILE, MODE, row, col);
+      tiled[k] = img[row*width + col];
+      pixType pix = tileStream.read();
+      pass = (pix.to_int() == tiled[k]);
+      tileStream.write(pix);
+    }
+    if (!pass) { break; }
+
+    rastInst.run(tileStream, streamOut, width, height);
+    pass = pass && (streamOut.size() == (unsigned)(width*height));
+    for (int k = 0; k < width*height && pass; k++) {
+      int row = k/width, col = k%width;
+      int band = row/TILE, r = row%TILE, tileIdx = col/TILE, c = col%TILE;
+      pass = (streamOut.read().to_int() == tiled[band*TILE*width + tileIdx*TILE*TILE + r*TILE + c]);
+    }
+  }
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_transpose_tile.cpp ---------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver<4, 64, 32, AC_TILE_TRANSPOSE>("AC_TILE_TRANSPOSE", 32, 16) && all_tests_pass;
+  all_tests_pass = test_driver<4, 64, 32, AC_TILE_ROT90_CW>("AC_TILE_ROT90_CW", 24, 12)   && all_tests_pass;
+  all_tests_pass = test_driver<4, 64, 32, AC_TILE_ROT90_CCW>("AC_TILE_ROT90_CCW", 64, 8)  && all_tests_pass;
+  all_tests_pass = test_driver<8, 64, 64, AC_TILE_ROT90_CW>("AC_TILE_ROT90_CW", 40, 24)   && all_tests_pass;
+  all_tests_pass = test_driver<3, 48, 24, AC_TILE_TRANSPOSE>("AC_TILE_TRANSPOSE", 15, 9)  && all_tests_pass;
+  all_tests_pass = test_driver<1, 16, 16, AC_TILE_ROT90_CCW>("AC_TILE_ROT90_CCW", 7, 5)   && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_transpose_tile - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_transpose_tile - PASSED" << endl;
+
+  return 0;
+}
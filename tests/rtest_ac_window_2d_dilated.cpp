@@ -0,0 +1,170 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag.h>
+#include <ac_window_2d_dilated.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+typedef ac_int<8, false> pixType;
+
+// Reference: pixel (y, x) of a width x height image, with the boundary processing of window mode WMODE.
+template<int WMODE>
+int ref_pix(const vector<int> &img, int width, int height, int y, int x, int bval)
+{
+  if (y < 0 || y >= height || x < 0 || x >= width) {
+    if (WMODE & AC_BOUNDARY) { return bval; }
+    if (WMODE & AC_CLIP) {
+      y = y < 0 ? 0 : (y >= height ? height - 1 : y);
+      x = x < 0 ? 0 : (x >= width ? width - 1 : x);
+    }
+    if (WMODE & AC_MIRROR) {
+      y = y < 0 ? -y : (y >= height ? 2*(height - 1) - y : y);
+      x = x < 0 ? -x : (x >= width ? 2*(width - 1) - x : x);
+    }
+  }
+  return img[y*width + x];
+}
+
+// Stream a random image through a dense window with a footprint of (K_SZ-1)*DIL+1 and check that the
+// K_SZ x K_SZ dilated taps at every output position hold the image pixels AC_DIL rows/columns apart.
+template<int K_SZ, int DIL, int W_MAX, int WMODE>
+bool test_driver(const char *modeName, int width, int height)
+{
+  cout << "TEST: ac_window_2d_dilated WMODE: ";
+  cout.width(22);
+  cout << left << modeName << " K_SZ: " << K_SZ << " DIL: " << DIL << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  enum { FP = (K_SZ - 1)*DIL + 1 };
+  typedef ac_window_2d_flag<pixType, FP, FP, W_MAX, WMODE> windType;
+  typedef ac_window_2d_dilated<windType, DIL> viewType;
+  const int bval = 9;
+  windType win(bval);
+  bool pass = (int)viewType::ROWS == K_SZ && (int)viewType::COLS == K_SZ;
+
+  vector<int> img(width*height);
+  for (int k = 0; k < width*height; k++) { img[k] = rand() & 255; }
+
+  int i = 0, j = 0, k = 0, nOut = 0;
+  bool inRead = true, eofOut = false;
+  do {
+    pixType pixIn = inRead ? pixType(img[k++]) : pixType(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    win.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool f[4];
+    win.readFlags(f[0], f[1], f[2], f[3]);
+    eofOut = f[1];
+    if (win.valid()) {
+      viewType taps(win);
+      const int y = nOut/width, x = nOut%width;
+      const bool lin = (WMODE & AC_LIN_INDEX) != 0;
+      for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+        for (int c = -K_SZ/2; c <= K_SZ/2; c++) {
+          pixType tap = lin ? taps(r + K_SZ/2, c + K_SZ/2) : taps(r, c);
+          pass = pass && tap.to_int() == ref_pix<WMODE>(img, width, height, y + r*DIL, x + c*DIL, bval);
+        }
+      }
+      nOut++;
+    }
+  } while (!eofOut && pass);
+
+  pass = pass && (nOut == width*height);
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Check which window sizes ac_window_2d_dilated accepts. The tap pattern must be centered, so configurations
+// with an even number of taps (e.g. a 7x7 window with DIL = 2, which would read 2*DIL = 4 rows off the center
+// of a window that only extends 3) must be rejected by the static_assert of the class.
+bool test_driver_fits()
+{
+  cout << "TEST: ac_window_2d_dilated accepted sizes RESULT: ";
+
+  typedef ac_window_2d_flag<pixType, 7, 7, 64, AC_CLIP> wind7x7;
+  typedef ac_window_2d_flag<pixType, 9, 9, 64, AC_CLIP> wind9x9;
+  typedef ac_window_2d_flag<pixType, 13, 13, 64, AC_CLIP> wind13x13;
+  typedef ac_window_2d_flag<pixType, 9, 5, 64, AC_CLIP> wind9x5;
+
+  bool pass = true;
+  pass = pass && !ac_window_2d_dilated_fits<wind7x7, 2>::value;   // 4x4 taps
+  pass = pass && !ac_window_2d_dilated_fits<wind13x13, 4>::value; // 4x4 taps
+  pass = pass && !ac_window_2d_dilated_fits<wind9x5, 4>::value;   // 3x2 taps
+  pass = pass && !ac_window_2d_dilated_fits<wind9x9, 0>::value;
+  pass = pass && ac_window_2d_dilated_fits<wind7x7, 3>::value;    // 3x3 taps
+  pass = pass && ac_window_2d_dilated_fits<wind9x9, 2>::value;    // 5x5 taps
+  pass = pass && ac_window_2d_dilated_fits<wind9x9, 4>::value;    // 3x3 taps
+  pass = pass && ac_window_2d_dilated_fits<wind9x5, 2>::value;    // 5x3 taps
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_window_2d_dilated.cpp ------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver<3, 2, 64, AC_CLIP>("AC_CLIP", 20, 11)                                && all_tests_pass;
+  all_tests_pass = test_driver<5, 2, 64, AC_MIRROR>("AC_MIRROR", 17, 12)                            && all_tests_pass;
+  all_tests_pass = test_driver<5, 2, 64, AC_BOUNDARY>("AC_BOUNDARY", 32, 10)                        && all_tests_pass;
+  all_tests_pass = test_driver<3, 4, 64, AC_MIRROR|AC_LIN_INDEX>("AC_MIRROR|AC_LIN_INDEX", 14, 12)  && all_tests_pass;
+  all_tests_pass = test_driver<5, 4, 64, AC_CLIP>("AC_CLIP", 40, 20)                                && all_tests_pass;
+  all_tests_pass = test_driver<3, 3, 64, AC_CLIP|AC_SINGLEPORT>("AC_CLIP|AC_SINGLEPORT", 24, 10)    && all_tests_pass;
+  all_tests_pass = test_driver_fits()                                                               && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_dilated - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_dilated - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag_flush_support.h>
+#include "ac_window_2d_ref.h"
+
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+// Stream N_FRAMES width x height frames back to back, with no flushing lines between frames, and check
+// every valid window and its output flags against the reference model of its own frame. With CONT_LINES,
+// the lines also follow each other without the flushItCol flushing iterations. Singleport windows then
+// still need one extra write after each line of odd width.
+template <class T, int K_SZ, int W_MAX, int WMODE, bool CONT_LINES>
+bool test_driver(int width, int height)
+{
+  typedef ac_window_2d_flag_flush_support<T, K_SZ, K_SZ, W_MAX, WMODE> windType;
+  const T bval = 5;
+  const int N_FRAMES = 3;
+
+  cout << "TEST: ac_window_2d_flag_flush_support back-to-back K_SZ: " << K_SZ << " WMODE: ";
+  cout.width(8);
+  cout << left << ((WMODE & AC_CLIP) ? "CLIP" : ((WMODE & AC_MIRROR) ? "MIRROR" : "BOUNDARY"));
+  cout << " USE_SP: " << ((WMODE & AC_SINGLEPORT) ? "true " : "false");
+  cout << " CONT_LINES: " << (CONT_LINES ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " FRAMES: " << N_FRAMES << " RESULT: ";
+
+  int *img = new int[N_FRAMES*width*height];
+  for (int k = 0; k < N_FRAMES*width*height; k++) {
+    img[k] = rand() % 256;
+  }
+
+  windType acWindObj(bval);
+  bool pass = true;
+  int nOut = 0;
+  int of = 0, oi = 0, oj = 0; // Output frame, row and column counters.
+  // Input iterations per line, and in total. Only the last frame is followed by flushing lines, and with
+  // CONT_LINES, only the last line is followed by flushing iterations.
+  const int spGap = (WMODE & AC_SINGLEPORT) && width%2 != 0;
+  const int lineIt = CONT_LINES ? width + spGap : width + windType::flushItCol;
+  const int totalIt = (N_FRAMES*height + windType::flushItRow)*lineIt + (CONT_LINES ? windType::flushItCol : 0);
+  for (int it = 0; it < totalIt && pass; it++) {
+    const int ii = it/lineIt;
+    const int j = it%lineIt;
+    const int f = ii/height;
+    const int i = ii%height;
+    const bool inFrame = (f < N_FRAMES) && (j < width);
+    T pixIn = inFrame ? T(img[(f*height + i)*width + j]) : T(0);
+    bool sol = (ii < N_FRAMES*height + windType::flushItRow) && (j == 0);
+    bool eol = (ii < N_FRAMES*height + windType::flushItRow) && (j == width - 1);
+    bool sof = (f < N_FRAMES) && (i == 0) && sol;
+    bool eof = (f < N_FRAMES) && (i == height - 1) && eol;
+    acWindObj.write(pixIn, sof, eof, sol, eol);
+    bool sofOut, eofOut, solOut, eolOut;
+    acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (acWindObj.valid()) {
+      if (solOut != (oj == 0) || eolOut != (oj == width - 1) || sofOut != (oi == 0 && oj == 0) || eofOut != (oi == height - 1 && oj == width - 1)) {
+        cout << "FAILED. Unexpected output flag value(s) in frame " << of << " at row " << oi << ", column " << oj << "." << endl;
+        pass = false;
+      }
+      for (int r = -K_SZ/2; r <= K_SZ/2 && pass; r++) {
+        for (int c = -K_SZ/2; c <= K_SZ/2 && pass; c++) {
+          if (acWindObj(r, c) != refTap<T, WMODE>(img + of*width*height, width, height, oi, oj, r, c, bval)) {
+            cout << "FAILED. Window mismatch in frame " << of << " at row " << oi << ", column " << oj << "." << endl;
+            pass = false;
+          }
+        }
+      }
+      nOut++;
+      oj++;
+      if (oj == width) {
+        oj = 0;
+        oi++;
+        if (oi == height) {
+          oi = 0;
+          of++;
+        }
+      }
+    }
+  }
+
+  if (pass && nOut != N_FRAMES*width*height) {
+    cout << "FAILED. Incorrect output size." << endl;
+    pass = false;
+  }
+
+  if (pass) { cout << "PASSED." << endl; }
+
+  delete[] img;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "-------------------- Running rtest_ac_window_2d_flag_b2b.cpp ---------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  typedef ac_int<8, false> pixType;
+
+  all_tests_pass = test_driver<pixType, 3, 64, AC_CLIP, false>(20, 7)                      && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_MIRROR, false>(20, 7)                    && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_BOUNDARY, false>(21, 6)                  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 64, AC_BOUNDARY|AC_SINGLEPORT, false>(22, 6)    && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_MIRROR|AC_SINGLEPORT, false>(20, 6)      && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_CLIP|AC_SINGLEPORT, false>(22, 7)        && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 64, AC_CLIP, true>(20, 7)                       && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_CLIP, true>(21, 7)                       && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_MIRROR, true>(20, 7)                     && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_BOUNDARY, true>(21, 6)                   && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 64, AC_BOUNDARY|AC_SINGLEPORT, true>(22, 6)     && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_MIRROR|AC_SINGLEPORT, true>(20, 6)       && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_CLIP|AC_SINGLEPORT, true>(21, 7)         && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_flag_b2b - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_flag_b2b - PASSED" << endl;
+
+  return 0;
+}
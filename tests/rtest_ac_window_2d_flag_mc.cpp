@@ -0,0 +1,127 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag_mc.h>
+
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+// Stream a random NPLANES-plane width x height image through one ac_window_2d_flag_mc object and through
+// NPLANES ac_window_2d_flag objects, one per plane, and check that the window outputs and flags are identical.
+template <class T, int NPLANES, int K_SZ, int W_MAX, int WMODE, bool SPLIT>
+bool test_driver(int width, int height)
+{
+  cout << "TEST: ac_window_2d_flag_mc NPLANES: " << NPLANES << " K_SZ: " << K_SZ << " WMODE: ";
+  cout.width(8);
+  cout << left << ((WMODE & AC_CLIP) ? "CLIP" : ((WMODE & AC_MIRROR) ? "MIRROR" : "BOUNDARY"));
+  cout << " USE_SP: " << ((WMODE & AC_SINGLEPORT) ? "true " : "false");
+  cout << " SPLIT: " << (SPLIT ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  typedef ac_window_2d_flag_mc<T, NPLANES, K_SZ, K_SZ, W_MAX, WMODE, SPLIT> windType;
+  const T bval = 3;
+  windType winMc(bval);
+  ac_window_2d_flag<T, K_SZ, K_SZ, W_MAX, WMODE> winRef[NPLANES];
+  for (int p = 0; p < NPLANES; p++) { winRef[p] = ac_window_2d_flag<T, K_SZ, K_SZ, W_MAX, WMODE>(bval); }
+
+  int i = 0, j = 0, nOut = 0;
+  bool inRead = true, eofOut = false, pass = true;
+  do {
+    typename windType::planes_type pixIn(0);
+    if (inRead) {
+      for (int p = 0; p < NPLANES; p++) { pixIn[p] = rand()%256; }
+    }
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol && inRead;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol && inRead;
+    winMc.write(pixIn, sof, eof, sol, eol);
+    for (int p = 0; p < NPLANES; p++) { winRef[p].write(pixIn[p], sof, eof, sol, eol); }
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool f0[4], f1[4];
+    winRef[0].readFlags(f0[0], f0[1], f0[2], f0[3]);
+    winMc.readFlags(f1[0], f1[1], f1[2], f1[3]);
+    eofOut = f0[1];
+    pass = (winRef[0].valid() == winMc.valid());
+    for (int k = 0; k < 4; k++) { pass = pass && f0[k] == f1[k]; }
+    if (winMc.valid()) {
+      for (int p = 0; p < NPLANES; p++) {
+        for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+          for (int c = -K_SZ/2; c <= K_SZ/2; c++) {
+            pass = pass && winRef[p](r, c) == winMc(p, r, c);
+          }
+        }
+      }
+      nOut++;
+    }
+  } while (!eofOut && pass);
+
+  pass = pass && (nOut == width*height);
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------- Running rtest_ac_window_2d_flag_mc.cpp -----------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  typedef ac_int<8, false> pixType;
+
+  all_tests_pass = test_driver<pixType, 3, 3, 64, AC_CLIP,                   false>(33, 9)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 5, 64, AC_MIRROR,                 true >(40, 11) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 5, 64, AC_BOUNDARY,               false>(21, 8)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 6, 5, 64, AC_BOUNDARY,               true >(26, 7)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 5, 64, AC_BOUNDARY|AC_SINGLEPORT, false>(24, 8)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 4, 3, 64, AC_MIRROR|AC_SINGLEPORT,   true >(18, 6)  && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_flag_mc - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_flag_mc - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,202 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag_ppc.h>
+#include <ac_window_2d_flag.h>
+#include "ac_window_2d_ref.h"
+
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+// Stream a width x height image through the N-PPC window, followed by dummy inputs until the end-of-frame
+// output is seen. Every window view produced is compared against the reference model.
+template <class T, int K_SZ, int W_MAX, int WMODE, int PPC>
+bool test_driver(int width, int height)
+{
+  typedef ac_window_2d_flag_ppc<T, K_SZ, K_SZ, W_MAX, WMODE, PPC> windType;
+  const T bval = 3;
+
+  cout << "TEST: ac_window_2d_flag_ppc K_SZ: " << K_SZ << " PPC: " << PPC;
+  cout << " WMODE: ";
+  cout.width(8);
+  cout << left << ((WMODE & AC_CLIP) ? "CLIP" : ((WMODE & AC_MIRROR) ? "MIRROR" : "BOUNDARY"));
+  cout << " USE_SP: " << ((WMODE & AC_SINGLEPORT) ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  int *img = new int[width*height];
+  for (int k = 0; k < width*height; k++) {
+    img[k] = rand() % 256;
+  }
+
+  windType acWindObj(bval);
+  int i = 0, j = 0; // Input row and column counters. j counts groups of PPC pixels.
+  int oi = 0, oj = 0; // Output row and column counters.
+  int nOut = 0;
+  bool inRead = true, eofOut = false, pass = true;
+  const int widthG = width/PPC;
+  do {
+    typename windType::ppc_type pixIn;
+    for (int k = 0; k < PPC; k++) {
+      pixIn.px[k] = inRead ? T(img[i*width + j*PPC + k]) : T(0);
+    }
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == widthG - 1);
+    bool eof = (i == height - 1) && eol;
+    acWindObj.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == widthG) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool sofOut, solOut, eolOut;
+    acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (acWindObj.valid()) {
+      if (solOut != (oj == 0) || eolOut != (oj == widthG - 1) || sofOut != (oi == 0 && oj == 0) || eofOut != (oi == height - 1 && oj == widthG - 1)) {
+        cout << "FAILED. Unexpected output flag value(s) at row " << oi << ", group " << oj << "." << endl;
+        pass = false;
+        break;
+      }
+      for (int p = 0; p < PPC && pass; p++) {
+        for (int r = -K_SZ/2; r <= K_SZ/2 && pass; r++) {
+          for (int c = -K_SZ/2; c <= K_SZ/2 && pass; c++) {
+            T ref = refTap<T, WMODE>(img, width, height, oi, oj*PPC + p, r, c, bval);
+            if (acWindObj(p, r, c) != ref) {
+              cout << "FAILED. Window mismatch at row " << oi << ", column " << oj*PPC + p << ", tap (" << r << ", " << c << ")." << endl;
+              pass = false;
+            }
+          }
+        }
+      }
+      nOut++;
+      oj++;
+      if (oj == widthG) {
+        oj = 0;
+        oi++;
+      }
+    }
+  } while (!eofOut && pass);
+
+  if (pass && nOut != widthG*height) {
+    cout << "FAILED. Incorrect output size." << endl;
+    pass = false;
+  }
+
+  if (pass) { cout << "PASSED." << endl; }
+
+  delete[] img;
+  return pass;
+}
+
+// Check that the 1-PPC configuration of the N-PPC window is a drop-in replacement for ac_window_2d_flag.
+template <class T, int K_SZ, int W_MAX, int WMODE>
+bool test_driver_1ppc(int width, int height)
+{
+  cout << "TEST: ac_window_2d_flag_ppc K_SZ: " << K_SZ << " PPC: 1 vs. ac_window_2d_flag                 SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_window_2d_flag<T, K_SZ, K_SZ, W_MAX, WMODE> winRef;
+  ac_window_2d_flag_ppc<T, K_SZ, K_SZ, W_MAX, WMODE, 1> winPpc;
+  int i = 0, j = 0;
+  bool inRead = true, eofOut = false;
+  do {
+    T pixIn = inRead ? T(rand() % 256) : T(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    winRef.write(pixIn, sof, eof, sol, eol);
+    winPpc.write(typename ac_window_2d_flag_ppc<T, K_SZ, K_SZ, W_MAX, WMODE, 1>::ppc_type(pixIn), sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool f0[4], f1[4];
+    winRef.readFlags(f0[0], f0[1], f0[2], f0[3]);
+    winPpc.readFlags(f1[0], f1[1], f1[2], f1[3]);
+    eofOut = f0[1];
+    bool match = winRef.valid() == winPpc.valid();
+    for (int k = 0; k < 4; k++) { match = match && f0[k] == f1[k]; }
+    for (int r = -K_SZ/2; r <= K_SZ/2 && winRef.valid(); r++) {
+      for (int c = -K_SZ/2; c <= K_SZ/2; c++) {
+        match = match && winRef(r, c) == winPpc(0, r, c);
+      }
+    }
+    if (!match) {
+      cout << "FAILED. Output differs from ac_window_2d_flag." << endl;
+      return false;
+    }
+  } while (!eofOut);
+
+  cout << "PASSED." << endl;
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "-------------------- Running rtest_ac_window_2d_flag_ppc.cpp ---------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  typedef ac_int<8, false> pixType;
+
+  all_tests_pass = test_driver<pixType, 3, 64, AC_CLIP,                   1>(20, 9)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 64, AC_CLIP,                   2>(20, 9)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_MIRROR,                 2>(22, 11) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_MIRROR|AC_SINGLEPORT,   2>(24, 11) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 64, AC_BOUNDARY,               4>(24, 8)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 7, 64, AC_MIRROR,                 4>(32, 10) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 7, 64, AC_CLIP|AC_SINGLEPORT,     8>(48, 10) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 64, AC_BOUNDARY|AC_SINGLEPORT, 8>(32, 6)  && all_tests_pass;
+
+  all_tests_pass = test_driver_1ppc<pixType, 3, 64, AC_CLIP>(17, 7)   && all_tests_pass;
+  all_tests_pass = test_driver_1ppc<pixType, 5, 64, AC_MIRROR>(17, 7) && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_flag_ppc - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_flag_ppc - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,228 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+using namespace std;
+
+// Filter a width x height image with the separable kernel kv x kh, once as a full K_ROW x K_COL window
+// convolution, and once as a vertical 1D filter of the ac_window_2d_flag columns followed by a horizontal
+// 1D filter in ac_window_1d_flag. The outputs and output flags of both versions must match.
+template <int K_ROW, int K_COL, int W_MAX, int WMODE>
+bool test_driver(int width, int height)
+{
+  typedef ac_int<8, false> pixType;
+  typedef ac_int<24, true> sumType;
+
+  cout << "TEST: ac_window_2d_flag separable K_ROW: " << K_ROW << " K_COL: " << K_COL << " WMODE: ";
+  cout.width(8);
+  cout << left << ((WMODE & AC_CLIP) ? "CLIP" : ((WMODE & AC_MIRROR) ? "MIRROR" : "BOUNDARY"));
+  cout << " USE_SP: " << ((WMODE & AC_SINGLEPORT) ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  int kv[K_ROW], kh[K_COL];
+  int kvSum = 0;
+  for (int r = 0; r < K_ROW; r++) {
+    kv[r] = rand() % 15 - 7;
+    kvSum += kv[r];
+  }
+  for (int c = 0; c < K_COL; c++) {
+    kh[c] = rand() % 15 - 7;
+  }
+
+  const pixType bval = 9;
+  ac_window_2d_flag<pixType, K_ROW, K_COL, W_MAX, WMODE> win2d(bval);
+  ac_window_2d_flag<pixType, K_ROW, K_COL, W_MAX, WMODE> winV(bval);
+  // With AC_BOUNDARY, columns outside the frame are the vertical filter of a column of boundary values.
+  ac_window_1d_flag<sumType, K_COL, WMODE &(AC_CLIP|AC_MIRROR|AC_BOUNDARY)> winH(sumType(kvSum*bval.to_int()));
+
+  int i = 0, j = 0, nOut = 0, nOutSep = 0;
+  bool inRead = true, eofOut = false, pass = true;
+  sumType *out2d = new sumType[width*height];
+  bool *flags2d = new bool[4*width*height];
+  do {
+    pixType pixIn = inRead ? pixType(rand() % 256) : pixType(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    win2d.write(pixIn, sof, eof, sol, eol);
+    winV.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool sofOut, solOut, eolOut;
+    win2d.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (win2d.valid() && nOut < width*height) {
+      sumType acc = 0;
+      for (int r = 0; r < K_ROW; r++) {
+        for (int c = 0; c < K_COL; c++) {
+          acc += kv[r]*kh[c]*win2d(r - K_ROW/2, c - K_COL/2).to_int();
+        }
+      }
+      out2d[nOut] = acc;
+      flags2d[4*nOut + 0] = sofOut;
+      flags2d[4*nOut + 1] = eofOut;
+      flags2d[4*nOut + 2] = solOut;
+      flags2d[4*nOut + 3] = eolOut;
+      nOut++;
+    }
+
+    if (winV.column_valid()) {
+      bool csof, ceof, csol, ceol;
+      winV.readColumnFlags(csof, ceof, csol, ceol);
+      sumType vacc = 0;
+      for (int r = 0; r < K_ROW; r++) {
+        vacc += kv[r]*winV.column(r - K_ROW/2).to_int();
+      }
+      winH.write(vacc, csof, ceof, csol, ceol);
+      if (winH.valid() && nOutSep < nOut) {
+        bool hsof, heof, hsol, heol;
+        winH.readFlags(hsof, heof, hsol, heol);
+        sumType hacc = 0;
+        for (int c = 0; c < K_COL; c++) {
+          hacc += kh[c]*winH[c - K_COL/2].to_int();
+        }
+        if (hacc != out2d[nOutSep] || hsof != flags2d[4*nOutSep + 0] || heof != flags2d[4*nOutSep + 1] ||
+            hsol != flags2d[4*nOutSep + 2] || heol != flags2d[4*nOutSep + 3]) {
+          cout << "FAILED. Mismatch at output " << nOutSep << "." << endl;
+          pass = false;
+        }
+        nOutSep++;
+      }
+    }
+  } while (!eofOut && pass);
+
+  if (pass && (nOut != width*height || nOutSep != nOut)) {
+    cout << "FAILED. Incorrect output size." << endl;
+    pass = false;
+  }
+
+  if (pass) { cout << "PASSED." << endl; }
+
+  delete[] out2d;
+  delete[] flags2d;
+  return pass;
+}
+
+// A default constructed AC_BOUNDARY ac_window_1d_flag must pad with 0, whatever its storage held before.
+// The window is constructed over storage filled with ones, and compared to a window constructed with a
+// boundary value of 0. The window holds int, which, like ac_int, is not initialized by default.
+template <int AC_WN>
+bool test_default_boundary(int width, int height)
+{
+  typedef ac_int<8, false> pixType;
+  typedef ac_window_1d_flag<int, AC_WN, AC_BOUNDARY> windowType;
+
+  cout << "TEST: ac_window_1d_flag default boundary AC_WN: " << AC_WN;
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  union {
+    unsigned char bytes[sizeof(windowType)];
+    double align;
+  } storage;
+  memset(storage.bytes, 0xff, sizeof(storage.bytes));
+  windowType *winDef = new (storage.bytes) windowType();
+  windowType winRef(0);
+
+  int nOut = 0;
+  bool pass = true;
+  for (int n = 0; n < 2*width*height && nOut < width*height && pass; n++) {
+    int i = (n/width) % height, j = n % width;
+    bool inRead = n < width*height;
+    pixType pixIn = inRead ? pixType(rand() % 256) : pixType(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    winDef->write(pixIn.to_int(), sof, eof, sol, eol);
+    winRef.write(pixIn.to_int(), sof, eof, sol, eol);
+    if (winRef.valid()) {
+      bool dsof, deof, dsol, deol, rsof, reof, rsol, reol;
+      winDef->readFlags(dsof, deof, dsol, deol);
+      winRef.readFlags(rsof, reof, rsol, reol);
+      if (!winDef->valid() || dsof != rsof || deof != reof || dsol != rsol || deol != reol) { pass = false; }
+      for (int c = 0; c < AC_WN; c++) {
+        if ((*winDef)[c - AC_WN/2] != winRef[c - AC_WN/2]) { pass = false; }
+      }
+      if (!pass) { cout << "FAILED. Mismatch at output " << nOut << "." << endl; }
+      nOut++;
+    }
+  }
+  winDef->~windowType();
+
+  if (pass && nOut != width*height) {
+    cout << "FAILED. Incorrect output size." << endl;
+    pass = false;
+  }
+
+  if (pass) { cout << "PASSED." << endl; }
+
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "----------------- Running rtest_ac_window_2d_flag_separable.cpp ------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver< 3,  3, 64, AC_CLIP>(20, 9)                  && all_tests_pass;
+  all_tests_pass = test_driver< 5,  5, 64, AC_MIRROR>(21, 12)               && all_tests_pass;
+  all_tests_pass = test_driver< 5,  5, 64, AC_BOUNDARY>(16, 7)              && all_tests_pass;
+  all_tests_pass = test_driver< 3,  5, 64, AC_CLIP|AC_SINGLEPORT>(24, 8)    && all_tests_pass;
+  all_tests_pass = test_driver< 5,  3, 64, AC_BOUNDARY|AC_SINGLEPORT>(24, 8) && all_tests_pass;
+  all_tests_pass = test_driver<11, 11, 64, AC_MIRROR>(32, 16)               && all_tests_pass;
+  all_tests_pass = test_default_boundary<5>(16, 4)                          && all_tests_pass;
+  all_tests_pass = test_default_boundary<7>(9, 3)                           && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_flag_separable - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_flag_separable - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,125 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag.h>
+
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+// Stream a random width x height image through a window with a narrower line buffer storage type ST, and
+// through a window without storage conversion that is fed with the same pixels converted to ST and back.
+// Both must produce identical windows and flags.
+template <class T, class ST, int K_SZ, int W_MAX, int WMODE>
+bool test_driver(const char *typeName, int width, int height)
+{
+  cout << "TEST: ac_window_2d_flag storage type ST: ";
+  cout.width(36);
+  cout << left << typeName << " K_SZ: " << K_SZ;
+  cout << " USE_SP: " << ((WMODE & AC_SINGLEPORT) ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  ac_window_2d_flag<T, K_SZ, K_SZ, W_MAX, WMODE> winRef;
+  ac_window_2d_flag<T, K_SZ, K_SZ, W_MAX, WMODE, ST> winST;
+  int i = 0, j = 0, nOut = 0;
+  bool inRead = true, eofOut = false, pass = true;
+  do {
+    T pixIn = 0;
+    if (inRead) { pixIn.set_slc(0, ac_int<T::width, false>(rand())); }
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    winRef.write(T(ST(pixIn)), sof, eof, sol, eol);
+    winST.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool f0[4], f1[4];
+    winRef.readFlags(f0[0], f0[1], f0[2], f0[3]);
+    winST.readFlags(f1[0], f1[1], f1[2], f1[3]);
+    eofOut = f0[1];
+    pass = (winRef.valid() == winST.valid());
+    for (int k = 0; k < 4; k++) { pass = pass && f0[k] == f1[k]; }
+    if (winRef.valid()) {
+      for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+        for (int c = -K_SZ/2; c <= K_SZ/2; c++) {
+          pass = pass && winRef(r, c) == winST(r, c);
+        }
+      }
+      nOut++;
+    }
+  } while (!eofOut && pass);
+
+  pass = pass && (nOut == width*height);
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "---------------- Running rtest_ac_window_2d_flag_storage.cpp ---------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  typedef ac_fixed<24, 8, false> fxType;
+  typedef ac_fixed<12, 8, false, AC_RND, AC_SAT> fxStType;
+  typedef ac_fixed<16, 8, false> fx16Type;
+  typedef ac_fixed<20, 6, true> sfxType;
+  typedef ac_fixed<10, 4, true, AC_RND_CONV, AC_SAT_SYM> sfxStType;
+  typedef ac_int<16, false> intType;
+  typedef ac_int<8, false> intStType;
+
+  all_tests_pass = test_driver<fxType,  fxStType,  3, 64, AC_BOUNDARY>("ac_fixed<12,8,false,AC_RND,AC_SAT>", 37, 9)                    && all_tests_pass;
+  all_tests_pass = test_driver<fxType,  fxStType,  3, 64, AC_BOUNDARY|AC_SINGLEPORT>("ac_fixed<12,8,false,AC_RND,AC_SAT>", 24, 8)      && all_tests_pass;
+  all_tests_pass = test_driver<fx16Type, fxStType, 5, 64, AC_MIRROR|AC_PACK4>("ac_fixed<12,8,false,AC_RND,AC_SAT>", 18, 10)            && all_tests_pass;
+  all_tests_pass = test_driver<sfxType, sfxStType, 5, 64, AC_CLIP>("ac_fixed<10,4,true,AC_RND_CONV,AC_SAT_SYM>", 23, 7)                && all_tests_pass;
+  all_tests_pass = test_driver<sfxType, sfxStType, 5, 64, AC_MIRROR|AC_SINGLEPORT>("ac_fixed<10,4,true,AC_RND_CONV,AC_SAT_SYM>", 20, 10) && all_tests_pass;
+  all_tests_pass = test_driver<intType, intStType, 3, 64, AC_CLIP|AC_REWIND>("ac_int<8,false>", 21, 8)                                  && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_flag_storage - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_flag_storage - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag_flush_support.h>
+#include "ac_window_2d_ref.h"
+
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+// Process a width x height frame as vertical stripes of up to CORE_W output columns, with a window whose
+// line buffers are only W_MAX columns deep. Every valid window and its output flags are compared against
+// the reference model for the full frame.
+template <class T, int K_SZ, int W_MAX, int WMODE, int CORE_W>
+bool test_driver(int width, int height)
+{
+  typedef ac_window_2d_flag_flush_support<T, K_SZ, K_SZ, W_MAX, WMODE | AC_STRIPE> windType;
+  const T bval = 5;
+
+  cout << "TEST: ac_window_2d_flag_flush_support AC_STRIPE K_SZ: " << K_SZ << " W_MAX: " << W_MAX << " CORE_W: " << CORE_W;
+  cout << " WMODE: ";
+  cout.width(8);
+  cout << left << ((WMODE & AC_CLIP) ? "CLIP" : ((WMODE & AC_MIRROR) ? "MIRROR" : "BOUNDARY"));
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  int *img = new int[width*height];
+  for (int k = 0; k < width*height; k++) {
+    img[k] = rand() % 256;
+  }
+
+  windType acWindObj(bval);
+  bool pass = true;
+  int nOut = 0;
+  const int nStripes = windType::stripeCount(width, CORE_W);
+  for (int s = 0; s < nStripes && pass; s++) {
+    int start, len;
+    bool haloL, haloR;
+    windType::stripeRange(width, CORE_W, s, start, len, haloL, haloR);
+    acWindObj.setStripe(haloL, haloR);
+    const int coreStart = haloL ? start + K_SZ/2 : start;
+    const int coreW = len - (haloL ? K_SZ/2 : 0) - (haloR ? K_SZ/2 : 0);
+    int oi = 0, oj = 0; // Output row and column counters, in the stripe core.
+    bool eofSeen = false;
+    for (int i = 0; i < height + K_SZ/2 && pass; i++) {
+      // The column loop covers the whole stripe and its flushing iterations, as for a frame of width len.
+      for (int j = 0; j < len + K_SZ/2 && pass; j++) {
+        T pixIn = (i < height && j < len) ? T(img[i*width + start + j]) : T(0);
+        bool sol = (j == 0);
+        bool sof = (i == 0) && sol;
+        bool eol = (j == len - 1);
+        bool eof = (i == height - 1) && eol;
+        acWindObj.write(pixIn, sof, eof, sol, eol);
+        bool sofOut, eofOut, solOut, eolOut;
+        acWindObj.readFlags(sofOut, eofOut, solOut, eolOut);
+        eofSeen |= eofOut;
+        if (acWindObj.valid()) {
+          if (solOut != (oj == 0) || eolOut != (oj == coreW - 1) || sofOut != (oi == 0 && oj == 0) || eofOut != (oi == height - 1 && oj == coreW - 1)) {
+            cout << "FAILED. Unexpected output flag value(s) in stripe " << s << " at row " << oi << ", column " << oj << "." << endl;
+            pass = false;
+          }
+          for (int r = -K_SZ/2; r <= K_SZ/2 && pass; r++) {
+            for (int c = -K_SZ/2; c <= K_SZ/2 && pass; c++) {
+              if (acWindObj(r, c) != refTap<T, WMODE>(img, width, height, oi, coreStart + oj, r, c, bval)) {
+                cout << "FAILED. Window mismatch in stripe " << s << " at row " << oi << ", column " << oj << "." << endl;
+                pass = false;
+              }
+            }
+          }
+          nOut++;
+          oj++;
+          if (oj == coreW) {
+            oj = 0;
+            oi++;
+          }
+        }
+      }
+      if (eofSeen) {
+        break; // Break once the line with the last pixel of the stripe core output has been processed.
+      }
+    }
+  }
+
+  if (pass && nOut != width*height) {
+    cout << "FAILED. Incorrect output size." << endl;
+    pass = false;
+  }
+
+  if (pass) { cout << "PASSED." << endl; }
+
+  delete[] img;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------- Running rtest_ac_window_2d_flag_stripe.cpp -------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  typedef ac_int<8, false> pixType;
+
+  all_tests_pass = test_driver<pixType, 3, 16, AC_CLIP,     14>(40, 9)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 16, AC_MIRROR,   12>(40, 10) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 16, AC_BOUNDARY, 12>(37, 8)  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 7, 24, AC_MIRROR,   18>(64, 12) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 16, AC_BOUNDARY, 14>(14, 6)  && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_flag_stripe - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_flag_stripe - PASSED" << endl;
+
+  return 0;
+}
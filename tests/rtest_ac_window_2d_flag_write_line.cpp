@@ -0,0 +1,149 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag.h>
+
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+// Window output recorded for every valid window: the flags followed by all window taps.
+template <class T, int K_ROW, int K_COL, int W_MAX, int WMODE>
+struct windRecorder {
+  int *rec;
+  int nRec;
+  windRecorder(int *r) : rec(r), nRec(0) {}
+  void operator()(const ac_window_2d_flag<T, K_ROW, K_COL, W_MAX, WMODE> &w, bool sof, bool eof, bool sol, bool eol) {
+    rec[nRec++] = sof + 2*eof + 4*sol + 8*eol;
+    for (int r = 0; r < K_ROW; r++) {
+      for (int c = 0; c < K_COL; c++) {
+        rec[nRec++] = w(r - K_ROW/2, c - K_COL/2).to_int();
+      }
+    }
+  }
+};
+
+// Stream a width x height image through the window with write_line() and flush(), and compare the output
+// with that of the pixel-by-pixel write() processing loop used by the kernels.
+template <class T, int K_ROW, int K_COL, int W_MAX, int WMODE>
+bool test_driver(int width, int height)
+{
+  typedef ac_window_2d_flag<T, K_ROW, K_COL, W_MAX, WMODE> windType;
+
+  cout << "TEST: ac_window_2d_flag write_line() K_ROW: " << K_ROW << " K_COL: " << K_COL << " WMODE: ";
+  cout.width(8);
+  cout << left << ((WMODE & AC_CLIP) ? "CLIP" : ((WMODE & AC_MIRROR) ? "MIRROR" : "BOUNDARY"));
+  cout << " USE_SP: " << ((WMODE & AC_SINGLEPORT) ? "true " : "false");
+  cout << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  T *img = new T[width*height];
+  for (int k = 0; k < width*height; k++) {
+    img[k] = rand() % 256;
+  }
+  const int recSize = (width*height + 1)*(K_ROW*K_COL + 1);
+  int *recRef = new int[recSize];
+  int *recLine = new int[recSize];
+
+  // Reference: pixel-by-pixel processing loop.
+  windType winRef(T(7));
+  windRecorder<T, K_ROW, K_COL, W_MAX, WMODE> ref(recRef);
+  int i = 0, j = 0;
+  bool inRead = true, eofOut = false;
+  do {
+    T pixIn = inRead ? img[i*width + j] : T(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    winRef.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+    bool sofOut, solOut, eolOut;
+    winRef.readFlags(sofOut, eofOut, solOut, eolOut);
+    if (winRef.valid()) { ref(winRef, sofOut, eofOut, solOut, eolOut); }
+  } while (!eofOut);
+
+  // Line-at-a-time processing.
+  windType winLine(T(7));
+  windRecorder<T, K_ROW, K_COL, W_MAX, WMODE> line(recLine);
+  bool eofLine = false;
+  for (int y = 0; y < height; y++) {
+    eofLine = winLine.write_line(img + y*width, width, y == 0, y == height - 1, line) || eofLine;
+  }
+  if (!eofLine) { eofLine = winLine.flush(width, line); }
+
+  bool pass = eofLine && (line.nRec == ref.nRec) && (ref.nRec == width*height*(K_ROW*K_COL + 1));
+  for (int k = 0; k < ref.nRec && pass; k++) {
+    pass = (recRef[k] == recLine[k]);
+  }
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+
+  delete[] img;
+  delete[] recRef;
+  delete[] recLine;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "---------------- Running rtest_ac_window_2d_flag_write_line.cpp ------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  typedef ac_int<8, false> pixType;
+
+  all_tests_pass = test_driver<pixType, 3, 3, 64, AC_CLIP>(20, 9)                  && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 5, 64, AC_MIRROR>(21, 12)               && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 5, 5, 64, AC_BOUNDARY>(16, 7)              && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 5, 64, AC_CLIP|AC_SINGLEPORT>(24, 8)    && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 7, 7, 64, AC_MIRROR|AC_SINGLEPORT>(32, 10) && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 4, 4, 64, AC_MIRROR>(18, 9)                && all_tests_pass;
+  all_tests_pass = test_driver<pixType, 3, 3, 64, AC_CLIP>(4, 3)                   && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_flag_write_line - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_flag_write_line - PASSED" << endl;
+
+  return 0;
+}
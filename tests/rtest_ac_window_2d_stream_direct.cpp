@@ -0,0 +1,163 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+// Use the direct-addressing simulation model of ac_window_2d_stream.
+#define AC_WINDOW_2D_STREAM_DIRECT_SIM
+#include <ac_window_2d_stream.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+typedef ac_int<10, false> pixType;
+
+// Stream two frames, stored back to back in a host array, through ac_window_2d_stream with the direct
+// model, and check every window and valid() against ac_window_2d_flag written with the same pixels and flags.
+template<int K_ROW, int K_COL, int WMODE>
+bool test_driver(const char *modeName, int rows, int cols)
+{
+  cout << "TEST: ac_window_2d_stream direct K: " << K_ROW << "x" << K_COL << " WMODE: ";
+  cout.width(22);
+  cout << left << modeName << " SIZE: " << cols << "x" << rows << " RESULT: ";
+
+  const int nPix = rows*cols;
+  // The third frame only provides the pixels that flush the line buffer model.
+  vector<pixType> img(3*nPix);
+  for (int k = 0; k < 2*nPix; k++) { img[k] = rand() & 1023; }
+
+  ac_window_2d_stream<pixType, K_ROW, K_COL, 64, 64, WMODE> win;
+  ac_window_2d_flag<pixType, K_ROW, K_COL, 64, WMODE> winRef;
+  win.write(&img[0], rows, cols);
+
+  const bool lin = (WMODE & AC_LIN_INDEX) != 0;
+  bool pass = true;
+  int nOut = 0;
+  for (int k = 0; k < 3*nPix && nOut < 2*nPix; k++) {
+    int i = (k/cols)%rows, j = k%cols;
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == cols - 1);
+    bool eof = (i == rows - 1) && eol;
+    winRef.write(img[k], sof, eof, sol, eol);
+    win++;
+    pass = pass && (win.valid() == winRef.valid());
+    if (winRef.valid()) {
+      for (int r = -K_ROW/2; r <= K_ROW/2; r++) {
+        for (int c = -K_COL/2; c <= K_COL/2; c++) {
+          int rr = lin ? r + K_ROW/2 : r, cc = lin ? c + K_COL/2 : c;
+          pass = pass && (win(rr, cc) == winRef(rr, cc));
+        }
+      }
+      nOut++;
+    }
+  }
+  pass = pass && (nOut == 2*nPix);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+// Stream N_FRAMES frames, each in its own host array that is passed to write() before the first pixel of
+// the frame, and a flush frame. Every window and valid() of the direct model are checked against the line
+// buffer model of ac_window_2d_stream, written with the same arrays.
+template<int K_ROW, int K_COL, int WMODE>
+bool test_driver_arrays(const char *modeName, int rows, int cols)
+{
+  const int N_FRAMES = 3;
+  cout << "TEST: ac_window_2d_stream direct/line buffer K: " << K_ROW << "x" << K_COL << " WMODE: ";
+  cout.width(9);
+  cout << left << modeName << " SIZE: " << cols << "x" << rows << " FRAMES: " << N_FRAMES << " RESULT: ";
+
+  const int nPix = rows*cols;
+  // The last array only provides the pixels that flush the line buffer model.
+  vector<vector<pixType> > frames(N_FRAMES + 1, vector<pixType>(nPix));
+  for (int f = 0; f < N_FRAMES; f++) {
+    for (int k = 0; k < nPix; k++) { frames[f][k] = rand() & 1023; }
+  }
+
+  ac_window_2d_stream<pixType, K_ROW, K_COL, 64, 64, WMODE, true> win;
+  ac_window_2d_stream<pixType, K_ROW, K_COL, 64, 64, WMODE, false> winRef;
+
+  bool pass = true;
+  int nOut = 0;
+  for (int f = 0; f <= N_FRAMES && nOut < N_FRAMES*nPix; f++) {
+    win.write(&frames[f][0], rows, cols);
+    winRef.write(&frames[f][0], rows, cols);
+    for (int k = 0; k < nPix && nOut < N_FRAMES*nPix; k++) {
+      win++;
+      winRef++;
+      pass = pass && (win.valid() == winRef.valid());
+      if (winRef.valid()) {
+        for (int r = -K_ROW/2; r <= K_ROW/2; r++) {
+          for (int c = -K_COL/2; c <= K_COL/2; c++) {
+            pass = pass && (win(r, c) == winRef(r, c));
+          }
+        }
+        nOut++;
+      }
+    }
+  }
+  pass = pass && (nOut == N_FRAMES*nPix);
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_window_2d_stream_direct.cpp ------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver<3, 3, AC_CLIP>("AC_CLIP", 9, 17)                                  && all_tests_pass;
+  all_tests_pass = test_driver<5, 5, AC_MIRROR>("AC_MIRROR", 11, 20)                             && all_tests_pass;
+  all_tests_pass = test_driver<3, 5, AC_MIRROR>("AC_MIRROR", 8, 12)                              && all_tests_pass;
+  all_tests_pass = test_driver<7, 3, AC_CLIP>("AC_CLIP", 10, 9)                                  && all_tests_pass;
+  all_tests_pass = test_driver<5, 5, AC_MIRROR|AC_LIN_INDEX>("AC_MIRROR|AC_LIN_INDEX", 7, 16)    && all_tests_pass;
+  all_tests_pass = test_driver<3, 3, AC_CLIP|AC_SINGLEPORT>("AC_CLIP|AC_SINGLEPORT", 6, 24)      && all_tests_pass;
+  all_tests_pass = test_driver_arrays<3, 3, AC_CLIP>("AC_CLIP", 9, 17)                           && all_tests_pass;
+  all_tests_pass = test_driver_arrays<5, 5, AC_MIRROR>("AC_MIRROR", 11, 20)                      && all_tests_pass;
+  all_tests_pass = test_driver_arrays<7, 3, AC_CLIP>("AC_CLIP", 10, 9)                           && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_stream_direct - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_stream_direct - PASSED" << endl;
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_2d_flag.h>
+#include <ac_window_2d_subview.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+typedef ac_int<8, false> pixType;
+
+// Append the contents of the K_SZ x K_SZ view of an output window to out.
+template<class VIEW_TYPE, int K_SZ, class WINDOW_TYPE>
+void record(const WINDOW_TYPE &win, vector<pixType> &out)
+{
+  VIEW_TYPE view(win);
+  const bool lin = (WINDOW_TYPE::WMODE & AC_LIN_INDEX) != 0;
+  for (int r = -K_SZ/2; r <= K_SZ/2; r++) {
+    for (int c = -K_SZ/2; c <= K_SZ/2; c++) {
+      out.push_back(lin ? view(r + K_SZ/2, c + K_SZ/2) : view(r, c));
+    }
+  }
+}
+
+// View of the whole window, for the reference windows.
+template<class WINDOW_TYPE>
+struct identityView {
+  const WINDOW_TYPE &w;
+  identityView(const WINDOW_TYPE &win) : w(win) { }
+  const pixType &operator()(int r, int c) const { return w(r, c); }
+};
+
+// Compare the 3x3 and 5x5 sub-views of a 7x7 window against separate 3x3 and 5x5 windows with the same
+// window mode.
+template<int W_MAX, int WMODE>
+bool test_driver(const char *modeName, int width, int height)
+{
+  cout << "TEST: ac_window_2d_subview WMODE: ";
+  cout.width(22);
+  cout << left << modeName << " SIZE: " << width << "x" << height << " RESULT: ";
+
+  typedef ac_window_2d_flag<pixType, 7, 7, W_MAX, WMODE> wind7Type;
+  typedef ac_window_2d_flag<pixType, 5, 5, W_MAX, WMODE> wind5Type;
+  typedef ac_window_2d_flag<pixType, 3, 3, W_MAX, WMODE> wind3Type;
+  wind7Type win7(9);
+  wind5Type win5(9);
+  wind3Type win3(9);
+
+  vector<pixType> img(width*height);
+  for (int k = 0; k < width*height; k++) { img[k] = rand() & 255; }
+
+  vector<pixType> sub3, sub5, ref3, ref5;
+  vector<int> flags7, flags5, flags3;
+  int i = 0, j = 0, k = 0;
+  bool inRead = true, eof7 = false, eof5 = false, eof3 = false;
+  do {
+    pixType pixIn = inRead ? img[k++] : pixType(0);
+    bool sol = (j == 0);
+    bool sof = (i == 0) && sol;
+    bool eol = (j == width - 1);
+    bool eof = (i == height - 1) && eol;
+    win7.write(pixIn, sof, eof, sol, eol);
+    win5.write(pixIn, sof, eof, sol, eol);
+    win3.write(pixIn, sof, eof, sol, eol);
+    if (eof) { inRead = false; }
+    j++;
+    if (j == width) {
+      j = 0;
+      i++;
+      if (i == height) { i = 0; }
+    }
+
+    bool f[4];
+    if (!eof7) {
+      win7.readFlags(f[0], f[1], f[2], f[3]);
+      if (win7.valid()) {
+        record<ac_window_2d_subview<wind7Type, 3, 3>, 3>(win7, sub3);
+        record<ac_window_2d_subview<wind7Type, 5, 5>, 5>(win7, sub5);
+        flags7.push_back(f[0]*8 + f[1]*4 + f[2]*2 + f[3]);
+      }
+      eof7 = f[1];
+    }
+    if (!eof5) {
+      win5.readFlags(f[0], f[1], f[2], f[3]);
+      if (win5.valid()) {
+        record<identityView<wind5Type>, 5>(win5, ref5);
+        flags5.push_back(f[0]*8 + f[1]*4 + f[2]*2 + f[3]);
+      }
+      eof5 = f[1];
+    }
+    if (!eof3) {
+      win3.readFlags(f[0], f[1], f[2], f[3]);
+      if (win3.valid()) {
+        record<identityView<wind3Type>, 3>(win3, ref3);
+        flags3.push_back(f[0]*8 + f[1]*4 + f[2]*2 + f[3]);
+      }
+      eof3 = f[1];
+    }
+  } while (!(eof7 && eof5 && eof3));
+
+  bool pass = (int)flags7.size() == width*height && flags7 == flags5 && flags7 == flags3;
+  pass = pass && sub3 == ref3 && sub5 == ref5;
+
+  cout << (pass ? "PASSED." : "FAILED.") << endl;
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------ Running rtest_ac_window_2d_subview.cpp ------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  all_tests_pass = test_driver<64, AC_CLIP>("AC_CLIP", 20, 11)                                && all_tests_pass;
+  all_tests_pass = test_driver<64, AC_MIRROR>("AC_MIRROR", 17, 9)                             && all_tests_pass;
+  all_tests_pass = test_driver<64, AC_BOUNDARY>("AC_BOUNDARY", 32, 8)                         && all_tests_pass;
+  all_tests_pass = test_driver<64, AC_MIRROR|AC_LIN_INDEX>("AC_MIRROR|AC_LIN_INDEX", 12, 12)  && all_tests_pass;
+  all_tests_pass = test_driver<64, AC_CLIP|AC_SINGLEPORT>("AC_CLIP|AC_SINGLEPORT", 24, 10)    && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_2d_subview - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_2d_subview - PASSED" << endl;
+
+  return 0;
+}
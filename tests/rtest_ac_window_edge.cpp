@@ -0,0 +1,183 @@
+/**************************************************************************
+ *                                                                        *
+ *  Algorithmic C (tm) Image Processing Library                           *
+ *                                                                        *
+ *  Software Version: 2025.4                                              *
+ *                                                                        *
+ *  Release Date    : Tue Nov 11 18:01:30 PST 2025                        *
+ *  Release Type    : Production Release                                  *
+ *  Release Build   : 2025.4.0                                            *
+ *                                                                        *
+ *  Copyright 2019 Siemens                                                *
+ *                                                                        *
+ **************************************************************************
+ *  Licensed under the Apache License, Version 2.0 (the "License");       *
+ *  you may not use this file except in compliance with the License.      * 
+ *  You may obtain a copy of the License at                               *
+ *                                                                        *
+ *      http://www.apache.org/licenses/LICENSE-2.0                        *
+ *                                                                        *
+ *  Unless required by applicable law or agreed to in writing, software   * 
+ *  distributed under the License is distributed on an "AS IS" BASIS,     * 
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or       *
+ *  implied.                                                              * 
+ *  See the License for the specific language governing permissions and   * 
+ *  limitations under the License.                                        *
+ **************************************************************************
+ *                                                                        *
+ *  The most recent version of this package is available at github.       *
+ *                                                                        *
+ *************************************************************************/
+#include <ac_window_1d_flag.h>
+
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+// Ungated reference for the boundary muxes of ac_window_edge(): the clip, mirror and boundary loops as
+// ac_window_1d_flag and ac_window_2d_flag ran them for every pixel, with the mirror taps read at a run-time
+// reflection point m.
+template <int WN, int N, int EOFS, int WMODE>
+void refEdge(int *w, const bool *st, const bool *en, int bval)
+{
+  bool s, e;
+  int m = 0;
+  if (WMODE & AC_CLIP) {
+    s = false;
+    for (int i=WN/2-1; i>=0; i--) {
+      s |= st[i+1];
+      w[i] = s ? w[i+1] : w[i];
+    }
+    e = false;
+    for (int i=WN/2+1; i<WN; i++) {
+      e |= en[i-1+EOFS];
+      w[i] = e ? w[i-1] : w[i];
+    }
+  }
+  if (WMODE & AC_MIRROR) {
+    s = false;
+    for (int i=WN/2-1; i>=0; i--) {
+      s |= st[i+1];
+      if (st[i+1]) { m = i+1; }
+      w[i] = s ? w[m*2-i] : w[i];
+    }
+    e = false;
+    for (int i=WN/2+1; i<N; i++) {
+      e |= en[i-1+EOFS];
+      if (en[i-1+EOFS]) { m = i-1; }
+      w[i] = e ? w[m*2-i] : w[i];
+    }
+  }
+  if (WMODE & AC_BOUNDARY) {
+    s = false;
+    for (int i=WN/2-1; i>=0; i--) {
+      s |= st[i+1];
+      w[i] = s ? bval : w[i];
+    }
+    e = false;
+    for (int i=WN/2+1; i<WN; i++) {
+      e |= en[i-1+EOFS];
+      w[i] = e ? bval : w[i];
+    }
+  }
+}
+
+// Runs ac_window_edge() (with the interior path of simulation), the ungated chain of ac_window_edge_mux
+// specializations (as built in synthesis) and refEdge() on the same taps, for no flag and for a single
+// start and/or end flag at every position, and checks that all three agree.
+template <int WN, int N, int EOFS, int WMODE>
+bool test_driver()
+{
+  cout << "TEST: ac_window_edge WN: " << WN << " N: " << N << " EOFS: " << EOFS << " WMODE: ";
+  cout.width(8);
+  cout << left << ((WMODE & AC_CLIP) ? "CLIP" : ((WMODE & AC_MIRROR) ? "MIRROR" : "BOUNDARY"));
+  cout << " RESULT: ";
+
+  const int NF = N + 1; // Size of the flag arrays, large enough for the end flags at offset EOFS.
+  const int bval = -1;
+  int nEdge = 0, nInterior = 0;
+  bool pass = true;
+
+  // Flag position N means that no flag is set.
+  for (int ps=0; ps<=N && pass; ps++) {
+    for (int pe=0; pe<=N && pass; pe++) {
+      bool st[NF], en[NF];
+      for (int i=0; i<NF; i++) {
+        st[i] = (i == ps);
+        en[i] = (i == pe);
+      }
+
+      int data[N], gated[N], ungated[N], ref[N];
+      for (int i=0; i<N; i++) {
+        data[i] = rand() % 256;
+        gated[i] = ungated[i] = ref[i] = data[i];
+      }
+
+      ac_window_edge<WN, N, EOFS, WMODE>(gated, st, en, bval);
+      ac_window_edge_mux<WN, N, EOFS, WMODE&AC_CLIP>::apply(ungated, st, en, bval);
+      ac_window_edge_mux<WN, N, EOFS, WMODE&AC_MIRROR>::apply(ungated, st, en, bval);
+      ac_window_edge_mux<WN, N, EOFS, WMODE&AC_BOUNDARY>::apply(ungated, st, en, bval);
+      refEdge<WN, N, EOFS, WMODE>(ref, st, en, bval);
+
+      bool edge = false;
+      for (int i=0; i<N; i++) {
+        edge |= (ref[i] != data[i]);
+        if (gated[i] != ref[i] || ungated[i] != ref[i]) {
+          cout << "FAILED. Start flag: " << ps << " end flag: " << pe << " tap: " << i << " gated: " << gated[i];
+          cout << " ungated: " << ungated[i] << " reference: " << ref[i] << endl;
+          pass = false;
+          break;
+        }
+      }
+      if (edge) { nEdge++; } else { nInterior++; }
+    }
+  }
+
+  // Both the edge and the interior paths must have been exercised.
+  if (pass && (nEdge == 0 || nInterior == 0)) {
+    cout << "FAILED. Edge patterns: " << nEdge << " interior patterns: " << nInterior << endl;
+    pass = false;
+  }
+
+  if (pass) { cout << "PASSED." << endl; }
+
+  return pass;
+}
+
+int main(int argc, char *argv[])
+{
+  cout << "==================================================================================" << endl;
+  cout << "------------------------ Running rtest_ac_window_edge.cpp ------------------------" << endl;
+  cout << "==================================================================================" << endl;
+
+  bool all_tests_pass = true;
+
+  // Line edges (ac_window_1d_flag and the horizontal stage of ac_window_2d_flag), end flag at the tap.
+  all_tests_pass = test_driver<3, 3, 0, AC_CLIP>()     && all_tests_pass;
+  all_tests_pass = test_driver<5, 5, 0, AC_CLIP>()     && all_tests_pass;
+  all_tests_pass = test_driver<4, 4, 0, AC_CLIP>()     && all_tests_pass;
+  all_tests_pass = test_driver<3, 3, 0, AC_MIRROR>()   && all_tests_pass;
+  all_tests_pass = test_driver<7, 7, 0, AC_MIRROR>()   && all_tests_pass;
+  all_tests_pass = test_driver<4, 5, 0, AC_MIRROR>()   && all_tests_pass;
+  all_tests_pass = test_driver<5, 5, 0, AC_BOUNDARY>() && all_tests_pass;
+  all_tests_pass = test_driver<4, 4, 0, AC_BOUNDARY>() && all_tests_pass;
+
+  // Frame edges (vertical stage of ac_window_2d_flag), end flag stored one tap higher.
+  all_tests_pass = test_driver<3, 3, 1, AC_CLIP>()     && all_tests_pass;
+  all_tests_pass = test_driver<4, 4, 1, AC_CLIP>()     && all_tests_pass;
+  all_tests_pass = test_driver<5, 5, 1, AC_MIRROR>()   && all_tests_pass;
+  all_tests_pass = test_driver<6, 7, 1, AC_MIRROR>()   && all_tests_pass;
+  all_tests_pass = test_driver<7, 7, 1, AC_BOUNDARY>() && all_tests_pass;
+
+  cout << "  Testbench finished." << endl;
+
+  // Notify the user whether or not the test was a failure.
+  if (!all_tests_pass) {
+    cout << "  ac_window_edge - FAILED" << endl;
+    return -1;
+  }
+
+  cout << "  ac_window_edge - PASSED" << endl;
+
+  return 0;
+}